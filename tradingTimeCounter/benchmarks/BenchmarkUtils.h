@@ -0,0 +1,57 @@
+#pragma once
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace TradingTimeCounter {
+namespace BenchmarkUtils {
+
+/**
+ * @brief Keep a value alive so the optimiser cannot drop the work producing it
+ * @param value Value to keep
+ */
+template <typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* sink;
+    sink = &value;
+#endif
+}
+
+/**
+ * @brief Run a function repeatedly and return the best wall time
+ * @param function Work to measure
+ * @param repetitions Number of runs
+ * @return Fastest run in nanoseconds
+ */
+template <typename F>
+inline double bestOfNs(F&& function, int repetitions = 5) {
+    double best = 0.0;
+    for (int i = 0; i < repetitions; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        function();
+        double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        if (i == 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Print one benchmark result line
+ * @param name Result label
+ * @param value Measured value
+ * @param unit Unit of the value
+ */
+inline void report(const std::string& name, double value, const std::string& unit) {
+    std::cout << "  " << std::left << std::setw(44) << name << std::right << std::setw(12)
+              << std::fixed << std::setprecision(2) << value << " " << unit << std::endl;
+}
+
+} // namespace BenchmarkUtils
+} // namespace TradingTimeCounter
@@ -0,0 +1,168 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BenchmarkUtils.h"
+#include "tradingTimeCounter/AlertPlan.h"
+#include "tradingTimeCounter/CountdownTimer.h"
+#include "tradingTimeCounter/SoftwareRenderer.h"
+#include "tradingTimeCounter/TscClock.h"
+
+using namespace TradingTimeCounter;
+
+namespace {
+
+const int SWITCHES = 200;
+const std::uint32_t LIVE_MS = 12000;                 // Real run: the last 12 seconds
+
+/**
+ * @brief Countdown text for a given number of seconds remaining ("MM:SS")
+ */
+std::string formatCountdown(int seconds) {
+    char text[8];
+    std::snprintf(text, sizeof(text), "%02d:%02d", seconds / 60 % 100, seconds % 60);
+    return text;
+}
+
+/**
+ * @brief Cost of a stage change: rebuilding the renderer vs swapping a style index
+ */
+void measureStyleSwitch() {
+    DisplayConfig base;
+    base.windowWidth = 480;
+    base.windowHeight = 160;
+    base.fontSize = 64;
+    base.opacity = 200;
+
+    DisplayStyle amber = DisplayStyle::fromConfig(base);
+    amber.textColor = DisplayConfig::Color(255, 191, 0);
+    DisplayStyle red = DisplayStyle::fromConfig(base);
+    red.textColor = DisplayConfig::Color(255, 40, 40);
+    red.isBold = true;
+    std::vector<DisplayStyle> styles = {DisplayStyle::fromConfig(base), amber, red};
+
+    // Previous approach: every stage change reconfigures (colours, font weight)
+    SoftwareRenderer rebuilt;
+    rebuilt.configure(base);
+    double rebuildNs = BenchmarkUtils::bestOfNs([&]() {
+        for (int i = 0; i < SWITCHES; ++i) {
+            rebuilt.configure(styles[i % 3].applyTo(base));
+            BenchmarkUtils::doNotOptimize(rebuilt.render(formatCountdown(i)));
+        }
+    });
+
+    // Style table resolved once; a stage change selects an index
+    SoftwareRenderer indexed;
+    indexed.configure(base);
+    indexed.setStyles(styles);
+    double selectNs = BenchmarkUtils::bestOfNs([&]() {
+        for (int i = 0; i < SWITCHES; ++i) {
+            indexed.selectStyle(static_cast<std::size_t>(i % 3));
+            BenchmarkUtils::doNotOptimize(indexed.render(formatCountdown(i)));
+        }
+    });
+
+    BenchmarkUtils::report("stage change, configure + render", rebuildNs / SWITCHES / 1000.0, "us");
+    BenchmarkUtils::report("stage change, selectStyle + render", selectNs / SWITCHES / 1000.0, "us");
+}
+
+/**
+ * @brief Records how late each alert stage fires after its threshold
+ */
+class AlertRecorder : public ITimerCallback {
+public:
+    explicit AlertRecorder(const AlertPlan& plan)
+        : m_plan(plan)
+        , m_deadlineNs(0) {
+    }
+
+    void setDeadlineNs(std::int64_t deadlineNs) { m_deadlineNs.store(deadlineNs); }
+
+    void onTimerAlert(int stage) override {
+        std::int64_t thresholdNs = m_deadlineNs.load() - static_cast<std::int64_t>(m_plan.getStages()[stage].thresholdMs) * 1000000;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_alerts.push_back(std::make_pair(stage, static_cast<double>(TscClock::nowNs() - thresholdNs)));
+        if (m_plan.flashesAt(stage)) {
+            m_flashStartMs = m_plan.getStages()[stage].thresholdMs;
+        }
+    }
+    void onTimerFlash(bool) override {
+        // The k-th toggle is due k flash phases after the flashing stage began
+        std::uint32_t toggleMs = m_flashStartMs - static_cast<std::uint32_t>(m_flashCount) * AlertPlan::FLASH_PHASE_MS;
+        double latenessNs = static_cast<double>(TscClock::nowNs() - (m_deadlineNs.load() - static_cast<std::int64_t>(toggleMs) * 1000000));
+        ++m_flashCount;
+        m_worstFlashNs = latenessNs > m_worstFlashNs ? latenessNs : m_worstFlashNs;
+    }
+    void onTimerUpdate(int) override {}
+    void onTimerCompleted() override { m_completed = true; }
+    void onTimerStarted() override {}
+    void onTimerStopped() override {}
+    void onTimerResync(int) override {}
+
+    bool isCompleted() const { return m_completed.load(); }
+
+    std::vector<std::pair<int, double>> takeAlerts() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_alerts;
+    }
+
+    int getFlashCount() const { return m_flashCount; }
+    double getWorstFlashNs() const { return m_worstFlashNs; }
+
+private:
+    AlertPlan m_plan;
+    std::atomic<std::int64_t> m_deadlineNs;
+    std::atomic<bool> m_completed{false};
+    std::mutex m_mutex;
+    std::vector<std::pair<int, double>> m_alerts;
+    std::uint32_t m_flashStartMs = 0;                // Callbacks run on the timer thread, one at a time
+    int m_flashCount = 0;
+    double m_worstFlashNs = 0.0;
+};
+
+/**
+ * @brief Run a real countdown through its final seconds and time the alert stages
+ */
+void measureLiveAlerts() {
+    AlertPlan plan;
+    plan.addStage(AlertStage{10000, 2, AlertAction::None});
+    plan.addStage(AlertStage{3000, 2, AlertAction::Flash});
+
+    auto recorder = std::make_shared<AlertRecorder>(plan);
+    CountdownTimer timer(1);
+    timer.setAlertPlan(plan);
+    timer.setCallback(recorder);
+    timer.restoreRemaining(LIVE_MS);
+
+    // Taken before start(), so the true deadline is no earlier and lateness is an upper bound
+    TscClock::waitForCalibration();
+    recorder->setDeadlineNs(TscClock::nowNs() + static_cast<std::int64_t>(LIVE_MS) * 1000000);
+    timer.start();
+    while (!recorder->isCompleted()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+
+    BenchmarkUtils::report("live " + std::to_string(LIVE_MS / 1000) + " s: wakeups",
+                           static_cast<double>(timer.getWakeupCount()), "");
+    for (const auto& alert : recorder->takeAlerts()) {
+        std::string name = "live: T-" + std::to_string(plan.getStages()[alert.first].thresholdMs / 1000) + "s alert lateness";
+        BenchmarkUtils::report(name, alert.second / 1000.0, "us");
+    }
+    BenchmarkUtils::report("live: flash toggles", static_cast<double>(recorder->getFlashCount()), "");
+    BenchmarkUtils::report("live: worst flash toggle lateness", recorder->getWorstFlashNs() / 1000.0, "us");
+}
+
+} // namespace
+
+int main() {
+    std::cout << "Alert stages (" << SWITCHES << " stage changes)" << std::endl;
+    measureStyleSwitch();
+    measureLiveAlerts();
+    return 0;
+}
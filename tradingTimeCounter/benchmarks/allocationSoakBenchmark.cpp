@@ -0,0 +1,145 @@
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include "BenchmarkUtils.h"
+#include "tradingTimeCounter/ShardedTimerScheduler.h"
+
+using namespace TradingTimeCounter;
+
+namespace {
+
+std::atomic<std::uint64_t> g_allocations{0};
+
+} // namespace
+
+// Count every heap allocation made through operator new
+void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size ? size : 1)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t size) { return operator new(size); }
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete[](void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, std::size_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, std::size_t) noexcept { std::free(memory); }
+
+namespace {
+
+const std::size_t SHARDS = 4;
+const std::uint64_t KEYS = 100000;                   // Keyed alerts (symbol x timeframe)
+const std::int64_t BAR_NS = 60LL * 1000000000;       // One-minute bars, virtual time
+const std::int64_t STEP_NS = 100000000;              // Clock advances 100 ms per runDue()
+const int WARMUP_BARS = 5;
+const int SOAK_BARS = 100;
+const std::uint64_t REARM_PER_BAR = KEYS / 5;        // Alerts cancelled and re-added from outside each bar
+
+std::uint64_t mix(std::uint64_t value) {
+    value ^= value >> 33;
+    value *= 0xFF51AFD7ED558CCDULL;
+    return value ^ (value >> 33);
+}
+
+/**
+ * @brief Resident set size in KiB (Linux), 0 elsewhere
+ */
+double residentKiB() {
+    double kib = 0.0;
+#ifdef __linux__
+    if (std::FILE* file = std::fopen("/proc/self/statm", "r")) {
+        unsigned long size = 0;
+        unsigned long resident = 0;
+        if (std::fscanf(file, "%lu %lu", &size, &resident) == 2) {
+            kib = resident * 4.0;
+        }
+        std::fclose(file);
+    }
+#endif
+    return kib;
+}
+
+/**
+ * @brief Previous layout: the same churn on a default-allocated key map
+ */
+double heapMapAllocationsPerBar() {
+    std::unordered_map<std::uint64_t, TimerHandle> handles;
+    handles.reserve(KEYS);
+    for (std::uint64_t key = 0; key < KEYS; ++key) {
+        handles.emplace(key, TimerHandle());
+    }
+    std::uint64_t before = g_allocations.load();
+    for (int bar = 0; bar < 10; ++bar) {
+        for (std::uint64_t i = 0; i < REARM_PER_BAR; ++i) {
+            std::uint64_t key = mix(bar * REARM_PER_BAR + i) % KEYS;
+            handles.erase(key);
+            handles.emplace(key, TimerHandle());
+        }
+    }
+    return static_cast<double>(g_allocations.load() - before) / 10;
+}
+
+} // namespace
+
+int main() {
+    std::cout << "Allocation soak: " << KEYS << " alerts on " << SHARDS << " shards, re-armed every bar" << std::endl;
+    BenchmarkUtils::report("default-allocated key map: allocations/bar", heapMapAllocationsPerBar(), "");
+
+    ShardedTimerScheduler* owner = nullptr;
+    std::uint64_t expiries = 0;
+    ShardedTimerScheduler scheduler([&](std::uint64_t key, std::int64_t deadlineNs) {
+        // Re-arm for the next bar from the shard that owns the key
+        owner->add(key, deadlineNs + BAR_NS);
+        ++expiries;
+    }, SHARDS);
+    owner = &scheduler;
+
+    std::int64_t nowNs = BAR_NS;
+    for (std::uint64_t key = 0; key < KEYS; ++key) {
+        scheduler.add(key, nowNs + static_cast<std::int64_t>(mix(key) % BAR_NS));
+    }
+
+    std::uint64_t allocationsBefore = 0;
+    double rssStart = 0.0;
+    double rssPeak = 0.0;
+    for (int bar = 0; bar < WARMUP_BARS + SOAK_BARS; ++bar) {
+        if (bar == WARMUP_BARS) {
+            allocationsBefore = g_allocations.load();
+            expiries = 0;
+            rssStart = residentKiB();
+        }
+
+        // Strategy churn: move some alerts to a new time within the next bar
+        for (std::uint64_t i = 0; i < REARM_PER_BAR; ++i) {
+            std::uint64_t key = mix(bar * REARM_PER_BAR + i) % KEYS;
+            scheduler.cancel(key);
+            scheduler.add(key, nowNs + BAR_NS + static_cast<std::int64_t>(mix(key + bar) % BAR_NS));
+        }
+        for (std::int64_t end = nowNs + BAR_NS; nowNs < end; nowNs += STEP_NS) {
+            scheduler.runDue(nowNs);
+        }
+        if (bar >= WARMUP_BARS) {
+            rssPeak = std::max(rssPeak, residentKiB());
+        }
+    }
+    std::uint64_t soakAllocations = g_allocations.load() - allocationsBefore;
+
+    BenchmarkUtils::report("pooled scheduler: expiries", static_cast<double>(expiries), "");
+    BenchmarkUtils::report("pooled scheduler: add/cancel commands", static_cast<double>(SOAK_BARS * REARM_PER_BAR * 2 + expiries), "");
+    BenchmarkUtils::report("pooled scheduler: allocations over soak", static_cast<double>(soakAllocations), "");
+    BenchmarkUtils::report("RSS at soak start", rssStart, "KiB");
+    BenchmarkUtils::report("RSS peak during soak", rssPeak, "KiB");
+    for (std::size_t i = 0; i < SHARDS; ++i) {
+        ShardStats stats = scheduler.getStats(i);
+        std::string prefix = "shard " + std::to_string(i);
+        BenchmarkUtils::report(prefix + ": timers (high water)", static_cast<double>(stats.timersHighWater), "");
+        BenchmarkUtils::report(prefix + ": record pool", stats.poolBytes / 1024.0, "KiB");
+    }
+    return 0;
+}
@@ -0,0 +1,87 @@
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "BenchmarkUtils.h"
+#include "tradingTimeCounter/BoundaryBatch.h"
+
+using namespace TradingTimeCounter;
+
+namespace {
+
+const std::size_t TUPLE_COUNT = 10000;
+const int ITERATIONS = 200;
+
+/**
+ * @brief One watchlist entry evaluated the way an aligned CountdownTimer arms itself
+ */
+struct IndividualTimer {
+    std::chrono::seconds period;
+    std::chrono::seconds offset;
+
+    std::int32_t remainingSeconds() const {
+        auto sinceEpoch = std::chrono::system_clock::now().time_since_epoch() - offset;
+        auto intoPeriod = sinceEpoch % period;
+        return static_cast<std::int32_t>(std::chrono::ceil<std::chrono::seconds>(period - intoPeriod).count());
+    }
+};
+
+} // namespace
+
+int main() {
+    const std::int32_t timeframes[] = {60, 180, 300, 900, 1800, 3600, 14400, 86400};
+    std::mt19937 rng(3);
+
+    std::vector<std::int32_t> periods(TUPLE_COUNT);
+    std::vector<std::int32_t> offsets(TUPLE_COUNT);
+    std::vector<IndividualTimer> timers(TUPLE_COUNT);
+    for (std::size_t i = 0; i < TUPLE_COUNT; ++i) {
+        periods[i] = timeframes[rng() % 8];
+        offsets[i] = static_cast<std::int32_t>(rng() % 3600);
+        timers[i] = IndividualTimer{std::chrono::seconds(periods[i]), std::chrono::seconds(offsets[i])};
+    }
+
+    std::int64_t now = std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    std::vector<std::int32_t> remaining(TUPLE_COUNT);
+    std::vector<std::int32_t> reference(TUPLE_COUNT);
+
+    std::cout << "Batch next-boundary computation, " << TUPLE_COUNT << " tuples (selected kernel: "
+              << getSimdLevelName(getSimdLevel()) << ")" << std::endl;
+
+    // Cross-check every kernel against the scalar result over a range of times
+    BoundaryBatch::computeRemainingWith(SimdLevel::Scalar, periods.data(), offsets.data(), TUPLE_COUNT, now, reference.data());
+    std::size_t mismatches = 0;
+    for (SimdLevel level : {SimdLevel::SSE2, SimdLevel::AVX2}) {
+        for (std::int64_t t = now; t < now + 7200; t += 7) {
+            BoundaryBatch::computeRemainingWith(SimdLevel::Scalar, periods.data(), offsets.data(), TUPLE_COUNT, t, reference.data());
+            BoundaryBatch::computeRemainingWith(level, periods.data(), offsets.data(), TUPLE_COUNT, t, remaining.data());
+            for (std::size_t i = 0; i < TUPLE_COUNT; ++i) {
+                mismatches += remaining[i] != reference[i];
+            }
+        }
+    }
+    std::cout << "  Kernel mismatches vs scalar: " << mismatches << std::endl;
+
+    for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2}) {
+        double ns = BenchmarkUtils::bestOfNs([&]() {
+            for (int i = 0; i < ITERATIONS; ++i) {
+                BoundaryBatch::computeRemainingWith(level, periods.data(), offsets.data(), TUPLE_COUNT, now + i, remaining.data());
+                BenchmarkUtils::doNotOptimize(remaining[0]);
+            }
+        });
+        BenchmarkUtils::report(std::string("batch, ") + getSimdLevelName(level), ns / ITERATIONS / 1000.0, "us/batch");
+    }
+
+    double individualNs = BenchmarkUtils::bestOfNs([&]() {
+        for (int i = 0; i < ITERATIONS; ++i) {
+            for (std::size_t j = 0; j < TUPLE_COUNT; ++j) {
+                remaining[j] = timers[j].remainingSeconds();
+            }
+            BenchmarkUtils::doNotOptimize(remaining[0]);
+        }
+    });
+    BenchmarkUtils::report("individual timers (clock read per timer)", individualNs / ITERATIONS / 1000.0, "us/batch");
+    return 0;
+}
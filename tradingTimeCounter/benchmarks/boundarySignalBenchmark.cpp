@@ -0,0 +1,161 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "BenchmarkUtils.h"
+#include "tradingTimeCounter/BoundarySignal.h"
+
+using namespace TradingTimeCounter;
+
+namespace {
+
+const int ROUNDS = 50;
+const int MAX_WAITERS = 100;
+const char* const LABEL = "benchmark";
+
+/**
+ * @brief Results the waiter processes write into an anonymous shared mapping
+ */
+struct SharedResults {
+    std::atomic<int> armed;                              // Waiters about to block for the current round
+    std::atomic<int> woken;                              // Waiters that handled the current round
+    std::atomic<std::int64_t> latencyNs[ROUNDS * MAX_WAITERS];
+};
+
+std::int64_t steadyNowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+double percentile(std::vector<double> values, double fraction) {
+    std::sort(values.begin(), values.end());
+    return values[static_cast<std::size_t>(fraction * (values.size() - 1))];
+}
+
+/**
+ * @brief Waiter process: block on the slot each round and record the wake latency
+ */
+void runWaiter(const std::string& path, int index, int waiters, SharedResults* results) {
+    BoundarySubscriber subscriber;
+    int slot = subscriber.open(path) ? subscriber.find(LABEL) : -1;
+    std::uint32_t seen = subscriber.getSequence(slot);
+    for (int round = 0; round < ROUNDS; ++round) {
+        results->armed.fetch_add(1);
+        if (!subscriber.wait(slot, seen, std::chrono::milliseconds(5000))) {
+            break;
+        }
+        std::int64_t wokenNs = steadyNowNs();
+        seen = subscriber.getSequence(slot);
+
+        // The publisher stores its steady-clock signal time as the boundary
+        results->latencyNs[round * waiters + index].store(wokenNs - subscriber.getBoundaryNs(slot));
+        results->woken.fetch_add(1);
+    }
+}
+
+/**
+ * @brief Publisher cost of signal() when nobody is waiting (no system call)
+ */
+void measureUncontendedSignal(BoundaryPublisher& publisher, int slot) {
+    const int signals = 1000000;
+    double signalNs = BenchmarkUtils::bestOfNs([&]() {
+        for (int i = 0; i < signals; ++i) {
+            publisher.signal(slot, i);
+        }
+    });
+    BenchmarkUtils::report("signal(), no waiters", signalNs / signals, "ns");
+}
+
+/**
+ * @brief Fork waiter processes and time boundary wakeups across processes
+ */
+void measureWaiters(BoundaryPublisher& publisher, int slot, const std::string& path, int waiters,
+                    SharedResults* results) {
+    results->armed = 0;
+    results->woken = 0;
+    std::vector<pid_t> children;
+    for (int i = 0; i < waiters; ++i) {
+        pid_t pid = fork();
+        if (pid == 0) {
+            runWaiter(path, i, waiters, results);
+            _exit(0);
+        }
+        children.push_back(pid);
+    }
+
+    std::vector<double> latencies;
+    std::vector<double> lastWaiter;
+    std::vector<double> signalCost;
+    for (int round = 0; round < ROUNDS; ++round) {
+        // Every waiter armed, plus time to reach FUTEX_WAIT
+        while (results->armed.load() < waiters * (round + 1)) {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2 + waiters / 10));
+
+        std::int64_t signalledNs = steadyNowNs();
+        publisher.signal(slot, signalledNs);
+        signalCost.push_back(static_cast<double>(steadyNowNs() - signalledNs));
+        while (results->woken.load() < waiters * (round + 1)) {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+
+        double slowest = 0.0;
+        for (int i = 0; i < waiters; ++i) {
+            double latency = static_cast<double>(results->latencyNs[round * waiters + i].load());
+            latencies.push_back(latency);
+            slowest = std::max(slowest, latency);
+        }
+        lastWaiter.push_back(slowest);
+    }
+    for (pid_t child : children) {
+        waitpid(child, nullptr, 0);
+    }
+
+    std::string prefix = std::to_string(waiters) + (waiters == 1 ? " waiter" : " waiters");
+    BenchmarkUtils::report(prefix + ": signal() with FUTEX_WAKE p50", percentile(signalCost, 0.5) / 1000.0, "us");
+    BenchmarkUtils::report(prefix + ": wake latency p50", percentile(latencies, 0.5) / 1000.0, "us");
+    BenchmarkUtils::report(prefix + ": wake latency p99", percentile(latencies, 0.99) / 1000.0, "us");
+    BenchmarkUtils::report(prefix + ": last waiter awake p50", percentile(lastWaiter, 0.5) / 1000.0, "us");
+}
+
+} // namespace
+
+int main() {
+    std::string path = "/dev/shm/boundarySignalBenchmark." + std::to_string(getpid());
+    BoundaryPublisher publisher;
+    if (!publisher.open(path)) {
+        path = "boundarySignalBenchmark." + std::to_string(getpid());
+        if (!publisher.open(path)) {
+            return 1;
+        }
+    }
+    int slot = publisher.publish(LABEL, 300);
+
+    void* shared = mmap(nullptr, sizeof(SharedResults), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (shared == MAP_FAILED) {
+        std::cerr << "boundarySignalBenchmark: Failed to map results" << std::endl;
+        return 1;
+    }
+    SharedResults* results = static_cast<SharedResults*>(shared);
+
+    std::cout << "Cross-process boundary wakeups (" << ROUNDS << " boundaries, "
+              << std::thread::hardware_concurrency() << " CPUs)" << std::endl;
+    measureUncontendedSignal(publisher, slot);
+    for (int waiters : {1, 10, 100}) {
+        measureWaiters(publisher, slot, path, waiters, results);
+    }
+
+    munmap(shared, sizeof(SharedResults));
+    publisher.close();
+    std::remove(path.c_str());
+    return 0;
+}
@@ -0,0 +1,104 @@
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "BenchmarkUtils.h"
+#include "tradingTimeCounter/BoundaryBatch.h"
+#include "tradingTimeCounter/CountdownTimer.h"
+#include "tradingTimeCounter/ttc.h"
+
+using namespace TradingTimeCounter;
+
+namespace {
+
+const int CALLS = 10000000;
+const std::size_t BATCH = 10000;
+
+/**
+ * @brief Report C++ and C ABI cost of the same operation side by side
+ */
+template <typename CppCall, typename CCall>
+void compare(const std::string& name, int calls, CppCall cppCall, CCall cCall) {
+    double cppNs = BenchmarkUtils::bestOfNs([&]() {
+        for (int i = 0; i < calls; ++i) {
+            cppCall(i);
+        }
+    });
+    double cNs = BenchmarkUtils::bestOfNs([&]() {
+        for (int i = 0; i < calls; ++i) {
+            cCall(i);
+        }
+    });
+    BenchmarkUtils::report(name + ", C++ API", cppNs / calls, "ns/call");
+    BenchmarkUtils::report(name + ", C ABI", cNs / calls, "ns/call");
+}
+
+} // namespace
+
+int main() {
+    std::cout << "libttc C ABI (version " << ttc_abi_version() << ") vs C++ API" << std::endl;
+
+    CountdownTimer timer(5);
+    timer.setWallClockAligned(true);
+    timer.start();
+    ttc_timer* handle = ttc_bar_timer_create(5);
+    ttc_timer_start(handle);
+
+    compare("snapshot", CALLS,
+        [&](int) { BenchmarkUtils::doNotOptimize(timer.getSnapshot()); },
+        [&](int) {
+            ttc_snapshot snapshot;
+            ttc_timer_get_snapshot(handle, &snapshot);
+            BenchmarkUtils::doNotOptimize(snapshot);
+        });
+
+    compare("format MM:SS", CALLS / 10,
+        [&](int) { BenchmarkUtils::doNotOptimize(timer.getFormattedTime()); },
+        [&](int) {
+            char text[16];
+            ttc_timer_format(handle, text, sizeof(text));
+            BenchmarkUtils::doNotOptimize(text);
+        });
+
+    const std::int64_t now = 1700000000;
+    const std::int32_t period = 300;
+    const std::int32_t offset = 0;
+    compare("seconds to boundary (1 pair)", CALLS,
+        [&](int i) {
+            std::int32_t remaining;
+            BoundaryBatch::computeRemaining(&period, &offset, 1, now + i, &remaining);
+            BenchmarkUtils::doNotOptimize(remaining);
+        },
+        [&](int i) { BenchmarkUtils::doNotOptimize(ttc_seconds_to_boundary(now + i, period, offset)); });
+
+    std::vector<std::int32_t> periods(BATCH);
+    std::vector<std::int32_t> offsets(BATCH);
+    std::vector<std::int32_t> remaining(BATCH);
+    for (std::size_t i = 0; i < BATCH; ++i) {
+        periods[i] = 60 * static_cast<std::int32_t>(1 + i % 60);
+        offsets[i] = static_cast<std::int32_t>(i % 60);
+    }
+    compare("10k-pair boundary batch", 1000,
+        [&](int i) {
+            BoundaryBatch::computeRemaining(periods.data(), offsets.data(), BATCH, now + i, remaining.data());
+            BenchmarkUtils::doNotOptimize(remaining.data());
+        },
+        [&](int i) {
+            ttc_seconds_to_boundary_batch(periods.data(), offsets.data(), BATCH, now + i, remaining.data());
+            BenchmarkUtils::doNotOptimize(remaining.data());
+        });
+
+    ttc_session_status status;
+    double sessionNs = BenchmarkUtils::bestOfNs([&]() {
+        for (int i = 0; i < CALLS; ++i) {
+            ttc_session_status_at(now + i, 34200, 57600, &status);
+            BenchmarkUtils::doNotOptimize(status);
+        }
+    });
+    BenchmarkUtils::report("session status, C ABI", sessionNs / CALLS, "ns/call");
+
+    ttc_timer_destroy(handle);
+    timer.stop();
+    return 0;
+}
@@ -0,0 +1,142 @@
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <vector>
+#include "BenchmarkUtils.h"
+#include "tradingTimeCounter/InlineExecutor.h"
+#include "tradingTimeCounter/TimerAwaitables.h"
+#include "tradingTimeCounter/VirtualClock.h"
+
+using namespace TradingTimeCounter;
+
+namespace {
+
+const int STRATEGIES = 10000;
+const int SIMULATED_SECONDS = 3600;
+const std::int64_t NS_PER_SECOND = 1000000000LL;
+
+std::uint64_t g_frameBytes = 0;
+std::uint64_t g_frames = 0;
+std::uint64_t g_liveFrames = 0;
+
+/**
+ * @brief DetachedTask whose promise counts the coroutine frames it allocates
+ */
+struct CountedTask {
+    struct promise_type {
+        static void* operator new(std::size_t size) {
+            ++g_frames;
+            ++g_liveFrames;
+            g_frameBytes += size;
+            return ::operator new(size);
+        }
+
+        static void operator delete(void* frame, std::size_t size) noexcept {
+            --g_liveFrames;
+            ::operator delete(frame, size);
+        }
+
+        CountedTask get_return_object() noexcept { return CountedTask(); }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+};
+
+/**
+ * @brief Strategy that acts on every bar close for a number of bars
+ */
+CountedTask barStrategy(const CoroutineClock& clock, std::chrono::seconds period, int bars, std::uint64_t& resumes) {
+    for (int i = 0; i < bars; ++i) {
+        co_await clock.untilNextBar(period);
+        ++resumes;
+    }
+}
+
+/**
+ * @brief The same strategy as a self-rescheduling callback
+ */
+struct CallbackStrategy {
+    DeadlineScheduler* scheduler;
+    IExecutor* executor;
+    std::int64_t periodNs;
+    int remainingBars;
+    std::uint64_t* resumes;
+
+    void arm() {
+        std::int64_t next = CoroutineClock::nextBoundaryNs(scheduler->nowNs(), periodNs, 0);
+        scheduler->schedule(next, *executor, [this]() { onBar(); });
+    }
+
+    void onBar() {
+        ++*resumes;
+        if (--remainingBars > 0) {
+            arm();
+        }
+    }
+};
+
+} // namespace
+
+int main() {
+    const std::chrono::seconds periods[] = {std::chrono::seconds(60), std::chrono::seconds(300), std::chrono::seconds(900)};
+    const std::int64_t start = 1700000000LL * NS_PER_SECOND;
+
+    std::cout << "Coroutine awaitables, " << STRATEGIES << " strategies over " << SIMULATED_SECONDS
+              << " s of virtual time" << std::endl;
+
+    // Coroutines suspended on bar boundaries
+    auto clock = std::make_shared<VirtualClock>(start);
+    DeadlineScheduler scheduler(clock);
+    InlineExecutor executor;
+    CoroutineClock coroutineClock(scheduler, executor);
+
+    std::uint64_t resumes = 0;
+    for (int i = 0; i < STRATEGIES; ++i) {
+        std::chrono::seconds period = periods[i % 3];
+        barStrategy(coroutineClock, period, static_cast<int>(SIMULATED_SECONDS / period.count()), resumes);
+    }
+    std::uint64_t spawnFrames = g_frames;
+    std::cout << "  Suspended: " << scheduler.getPendingCount() << " coroutines, 0 threads, "
+              << g_frameBytes / spawnFrames << " bytes per coroutine frame" << std::endl;
+
+    auto begin = std::chrono::steady_clock::now();
+    for (int second = 1; second <= SIMULATED_SECONDS; ++second) {
+        clock->advanceTo(start + second * NS_PER_SECOND);
+        scheduler.runDue(clock->nowNs());
+    }
+    double coroutineNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count();
+    std::uint64_t resumeFrames = g_frames - spawnFrames;
+
+    // Callback baseline on the same scheduler
+    auto callbackClock = std::make_shared<VirtualClock>(start);
+    DeadlineScheduler callbackScheduler(callbackClock);
+    std::uint64_t callbackResumes = 0;
+    std::vector<CallbackStrategy> strategies(STRATEGIES);
+    for (int i = 0; i < STRATEGIES; ++i) {
+        std::chrono::seconds period = periods[i % 3];
+        strategies[i] = CallbackStrategy{&callbackScheduler, &executor, period.count() * NS_PER_SECOND,
+                                         static_cast<int>(SIMULATED_SECONDS / period.count()), &callbackResumes};
+        strategies[i].arm();
+    }
+    begin = std::chrono::steady_clock::now();
+    for (int second = 1; second <= SIMULATED_SECONDS; ++second) {
+        callbackClock->advanceTo(start + second * NS_PER_SECOND);
+        callbackScheduler.runDue(callbackClock->nowNs());
+    }
+    double callbackNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count();
+
+    std::cout << "  Resumes: " << resumes << " (callbacks: " << callbackResumes << "), pending after run: "
+              << scheduler.getPendingCount() << std::endl;
+    BenchmarkUtils::report("co_await untilNextBar, per resume", coroutineNs / resumes, "ns");
+    BenchmarkUtils::report("self-rescheduling callback, per fire", callbackNs / callbackResumes, "ns");
+    BenchmarkUtils::report("frames allocated at spawn, per coroutine", static_cast<double>(spawnFrames) / STRATEGIES, "");
+    BenchmarkUtils::report("frames allocated per resume", static_cast<double>(resumeFrames) / resumes, "");
+    BenchmarkUtils::report("frames still allocated after the run", static_cast<double>(g_liveFrames), "");
+    return 0;
+}
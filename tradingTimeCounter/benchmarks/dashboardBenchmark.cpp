@@ -0,0 +1,89 @@
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "BenchmarkUtils.h"
+#include "tradingTimeCounter/BoundaryBatch.h"
+#include "tradingTimeCounter/CountdownTimer.h"
+#include "tradingTimeCounter/DashboardRenderer.h"
+
+using namespace TradingTimeCounter;
+
+namespace {
+
+const int ROWS = 500;
+const int TICKS = 300;
+
+} // namespace
+
+int main() {
+    DisplayConfig config;
+    config.fontSize = 14;
+
+    // A wall of bar countdowns: 1m..4h periods with assorted session offsets
+    const std::int32_t periods[] = {60, 180, 300, 900, 1800, 3600, 14400};
+    std::vector<std::int32_t> rowPeriods;
+    std::vector<std::int32_t> rowOffsets;
+    std::vector<DashboardRow> rows;
+    for (int i = 0; i < ROWS; ++i) {
+        std::int32_t period = periods[i % 7];
+        rowPeriods.push_back(period);
+        rowOffsets.push_back((i * 37) % period);
+        rows.push_back(DashboardRow{"SYM" + std::to_string(i) + " " + std::to_string(period / 60) + "m", std::string()});
+    }
+    std::vector<std::int32_t> remaining(ROWS);
+
+    DisplayPrecisionPolicy policy = DisplayPrecisionPolicy::fixedSeconds();
+    const std::int64_t start = 1700000000;
+    auto tick = [&](std::int64_t nowSeconds) {
+        BoundaryBatch::computeRemaining(rowPeriods.data(), rowOffsets.data(), rows.size(), nowSeconds, remaining.data());
+        for (std::size_t i = 0; i < rows.size(); ++i) {
+            rows[i].value = policy.format(static_cast<std::uint32_t>(remaining[i]) * 1000);
+        }
+    };
+
+    DashboardRenderer dashboard;
+    dashboard.configure(config);
+    tick(start);
+    dashboard.render(rows);
+    const DashboardLayout& layout = dashboard.getLayout();
+    std::cout << "Dashboard, " << ROWS << " rows, " << layout.width << "x" << layout.height
+              << " (selected kernel: " << getSimdLevelName(getSimdLevel()) << ")" << std::endl;
+
+    // Simulated 1 Hz ticks: batch boundaries, format, render only changed cells
+    std::size_t redrawnCells = 0;
+    double incrementalNs = BenchmarkUtils::bestOfNs([&]() {
+        redrawnCells = 0;
+        for (int i = 1; i <= TICKS; ++i) {
+            tick(start + i);
+            BenchmarkUtils::doNotOptimize(dashboard.render(rows));
+            redrawnCells += dashboard.getLastRedrawnCells();
+        }
+    });
+    const std::uint64_t layouts = dashboard.getLayoutCount();
+
+    double fullNs = BenchmarkUtils::bestOfNs([&]() {
+        for (int i = 1; i <= TICKS; ++i) {
+            tick(start + i);
+            dashboard.invalidate();
+            BenchmarkUtils::doNotOptimize(dashboard.render(rows));
+        }
+    });
+
+    double batchNs = BenchmarkUtils::bestOfNs([&]() {
+        for (int i = 1; i <= TICKS; ++i) {
+            tick(start + i);
+            BenchmarkUtils::doNotOptimize(rows.back().value);
+        }
+    });
+
+    BenchmarkUtils::report("boundaries + formatting", batchNs / TICKS / 1000.0, "us/tick");
+    BenchmarkUtils::report("tick, changed cells only", incrementalNs / TICKS / 1000.0, "us/tick");
+    BenchmarkUtils::report("tick, full relayout and redraw", fullNs / TICKS / 1000.0, "us/tick");
+    BenchmarkUtils::report("CPU at 1 Hz, changed cells only", incrementalNs / TICKS / 1e9 * 100.0, "%");
+    BenchmarkUtils::report("CPU at 1 Hz, full redraw", fullNs / TICKS / 1e9 * 100.0, "%");
+    std::cout << "  Layouts during " << TICKS << " incremental ticks: " << layouts - 1
+              << ", cells redrawn per tick: " << redrawnCells / TICKS << std::endl;
+    return 0;
+}
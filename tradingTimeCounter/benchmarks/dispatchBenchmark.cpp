@@ -0,0 +1,133 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BenchmarkUtils.h"
+#include "tradingTimeCounter/InlineExecutor.h"
+#include "tradingTimeCounter/TimerTable.h"
+#include "tradingTimeCounter/WorkStealingExecutor.h"
+
+using namespace TradingTimeCounter;
+
+namespace {
+
+const std::size_t TIMER_COUNT = 10000;
+const int ROUNDS = 5;
+const int WORK_ITERATIONS = 1500;
+const std::int64_t BOUNDARY_NS = 60LL * 1000000000LL;
+
+/**
+ * @brief Dispatch latencies of one boundary storm
+ */
+struct StormResult {
+    double p50Us = 0.0;                  ///< Median delay until a callback starts
+    double p99Us = 0.0;                  ///< 99th percentile delay
+    double maxUs = 0.0;                  ///< Delay of the last subscriber
+    double makespanUs = 0.0;             ///< Until every callback has finished
+};
+
+/**
+ * @brief Subscriber work: a short dependent computation, as a strategy would do
+ */
+std::uint64_t subscriberWork(std::uint64_t seed) {
+    std::uint64_t value = seed;
+    for (int i = 0; i < WORK_ITERATIONS; ++i) {
+        value = value * 6364136223846793005ULL + static_cast<std::uint64_t>(i);
+    }
+    return value;
+}
+
+/**
+ * @brief Expire TIMER_COUNT timers on one boundary and dispatch their callbacks
+ * @param executor Dispatch executor
+ * @param ordered Post each callback with postOrdered() keyed by timer instead of one batch
+ */
+StormResult runStorm(IExecutor& executor, bool ordered) {
+    TimerTable table(TIMER_COUNT);
+    for (std::uint32_t i = 0; i < TIMER_COUNT; ++i) {
+        table.add(BOUNDARY_NS, BOUNDARY_NS, i);
+    }
+    
+    std::vector<std::int64_t> delays(TIMER_COUNT);
+    std::vector<std::uint64_t> sinks(TIMER_COUNT);
+    std::atomic<std::size_t> finished(0);
+    std::vector<ExpiredTimer> expired;
+    std::vector<std::function<void()>> batch;
+    batch.reserve(TIMER_COUNT);
+    
+    auto start = std::chrono::steady_clock::now();
+    table.expire(BOUNDARY_NS, expired);
+    for (const ExpiredTimer& timer : expired) {
+        std::uint32_t id = timer.subscriberId;
+        auto callback = [&, id]() {
+            delays[id] = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+            sinks[id] = subscriberWork(id);
+            finished.fetch_add(1, std::memory_order_release);
+        };
+        if (ordered) {
+            executor.postOrdered(timer.handle.slot, callback);
+        } else {
+            batch.push_back(callback);
+        }
+    }
+    if (!ordered) {
+        executor.postBatch(batch);
+    }
+    while (finished.load(std::memory_order_acquire) < TIMER_COUNT) {
+        std::this_thread::yield();
+    }
+    
+    StormResult result;
+    result.makespanUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    std::sort(delays.begin(), delays.end());
+    result.p50Us = delays[TIMER_COUNT / 2] / 1000.0;
+    result.p99Us = delays[TIMER_COUNT * 99 / 100] / 1000.0;
+    result.maxUs = delays.back() / 1000.0;
+    BenchmarkUtils::doNotOptimize(sinks);
+    return result;
+}
+
+/**
+ * @brief Run several storms and report the one with the smallest tail
+ */
+void reportStorms(const std::string& name, IExecutor& executor, bool ordered) {
+    StormResult best;
+    for (int round = 0; round < ROUNDS; ++round) {
+        StormResult result = runStorm(executor, ordered);
+        if (round == 0 || result.maxUs < best.maxUs) {
+            best = result;
+        }
+    }
+    std::cout << "  " << name << std::endl;
+    BenchmarkUtils::report("    p50 dispatch delay", best.p50Us, "us");
+    BenchmarkUtils::report("    p99 dispatch delay", best.p99Us, "us");
+    BenchmarkUtils::report("    last subscriber", best.maxUs, "us");
+    BenchmarkUtils::report("    all callbacks done", best.makespanUs, "us");
+}
+
+} // namespace
+
+int main() {
+    std::cout << "Dispatch of " << TIMER_COUNT << " simultaneous expiries ("
+              << std::thread::hardware_concurrency() << " hardware threads)" << std::endl;
+    
+    InlineExecutor inlineExecutor;
+    reportStorms("inline on the timer thread", inlineExecutor, false);
+    
+    for (std::size_t threads : {1, 4, 16}) {
+        WorkStealingExecutor pool(threads);
+        reportStorms("work-stealing pool, " + std::to_string(threads) + " threads, one batch", pool, false);
+        ExecutorStats stats = pool.getStats();
+        std::cout << "    stolen " << stats.stolen << " of " << stats.posted << " tasks" << std::endl;
+    }
+    
+    WorkStealingExecutor orderedPool(4);
+    reportStorms("work-stealing pool, 4 threads, ordered per timer", orderedPool, true);
+    return 0;
+}
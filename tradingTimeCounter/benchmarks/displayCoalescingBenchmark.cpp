@@ -0,0 +1,110 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include "BenchmarkUtils.h"
+#include "tradingTimeCounter/CoalescingDisplayManager.h"
+
+using namespace TradingTimeCounter;
+
+namespace {
+
+const int TICKS = 300;
+const auto TICK_INTERVAL = std::chrono::milliseconds(20);   // Stand-in for one second
+const auto FRAME_INTERVAL = std::chrono::milliseconds(16);
+
+/**
+ * @brief Backend that only counts what reaches it
+ */
+class CountingDisplay : public IDisplayManager {
+public:
+    std::atomic<int> texts{0};
+    std::atomic<int> configs{0};
+
+    bool initialize(const DisplayConfig&) override { return true; }
+    void show() override { m_visible = true; }
+    void hide() override { m_visible = false; }
+    void updateText(const std::string&) override { ++texts; }
+    void updateConfig(const DisplayConfig&) override { ++configs; }
+    void setPositionLocked(bool) override {}
+    void getPosition(int& x, int& y) const override { x = 0; y = 0; }
+    void setPosition(int, int) override {}
+    bool isVisible() const override { return m_visible; }
+    void destroy() override {}
+    void setCloseCallback(std::function<void()>) override {}
+    void setPositionChangeCallback(std::function<void(int, int)>) override {}
+
+private:
+    bool m_visible = false;
+};
+
+std::string formatCountdown(int seconds) {
+    char text[8];
+    std::snprintf(text, sizeof(text), "%02d:%02d", seconds / 60 % 100, seconds % 60);
+    return text;
+}
+
+} // namespace
+
+int main() {
+    auto backend = std::make_unique<CountingDisplay>();
+    CountingDisplay* counting = backend.get();
+    CoalescingDisplayManager display(std::move(backend), FRAME_INTERVAL);
+    DisplayConfig config;
+    display.initialize(config);
+    display.show();
+
+    // App-like traffic: one update per tick, a resync burst every 10th tick,
+    // a slider drag every 50th, and the window hidden for the last quarter
+    std::cout << "Display coalescing, " << TICKS << " ticks" << std::endl;
+    int requests = 0;
+    for (int tick = 0; tick < TICKS; ++tick) {
+        std::string text = formatCountdown(TICKS - tick);
+        display.updateText(text);
+        ++requests;
+
+        if (tick % 10 == 0) {
+            display.updateText(text);                          // Resync to the same second
+            display.updateText(formatCountdown(TICKS - tick - 1));
+            ++requests;
+            ++requests;
+        }
+        if (tick % 50 == 0) {
+            for (int step = 0; step < 10; ++step) {
+                config.opacity = 150 + step;
+                display.updateConfig(config);
+                ++requests;
+            }
+        }
+        if (tick == TICKS * 3 / 4) {
+            display.hide();
+        }
+        std::this_thread::sleep_for(TICK_INTERVAL);
+    }
+    display.show();
+    std::this_thread::sleep_for(FRAME_INTERVAL * 2);
+
+    DisplayUpdateStats stats = display.getStats();
+    int presents = counting->texts.load() + counting->configs.load();
+    std::cout << "  Requests:            " << requests << std::endl;
+    std::cout << "  Backend presents:    " << presents << " (" << counting->texts.load() << " text, "
+              << counting->configs.load() << " config)" << std::endl;
+    std::cout << "  Duplicates dropped:  " << stats.droppedDuplicates << std::endl;
+    std::cout << "  Coalesced:           " << stats.coalesced << std::endl;
+    std::cout << "  Suppressed (hidden): " << stats.suppressedHidden << std::endl;
+    std::cout << "  Flush wakeups:       " << stats.flushWakeups << std::endl;
+
+    // Cost of a dropped duplicate on the tick path
+    const int calls = 100000;
+    double ns = BenchmarkUtils::bestOfNs([&]() {
+        for (int i = 0; i < calls; ++i) {
+            display.updateText("00:00");
+        }
+    });
+    BenchmarkUtils::report("updateText, duplicate", ns / calls, "ns/call");
+    display.destroy();
+    return 0;
+}
@@ -0,0 +1,147 @@
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "BenchmarkUtils.h"
+#include "tradingTimeCounter/NextEventAggregator.h"
+
+using namespace TradingTimeCounter;
+
+namespace {
+
+const std::int64_t NS_PER_SECOND = 1000000000;
+const std::int64_t START_NS = 1699862400LL * NS_PER_SECOND;    // 2023-11-13 08:00 UTC
+const std::int64_t TICK_NS = 100000000;                        // Overlay refresh every 100 ms
+const std::size_t TICKS = 36000;                               // One simulated hour
+const std::size_t TOP_K = 8;                                   // Ribbon length
+const int BAR_PERIODS_S[] = {1, 5, 15, 60, 300, 900, 3600, 14400};
+
+/**
+ * @brief Mixed population: a quarter bar closes, the rest session/economic/manual event lists
+ */
+std::vector<std::shared_ptr<ICountdownSource>> makeSources(std::size_t count) {
+    std::mt19937_64 rng(42);
+    std::vector<std::shared_ptr<ICountdownSource>> sources;
+    for (std::size_t i = 0; i < count; ++i) {
+        std::string label = "source " + std::to_string(i);
+        if (i % 4 == 0) {
+            sources.push_back(std::make_shared<BarCloseSource>(label, BAR_PERIODS_S[(i / 4) % 8], static_cast<int>(rng() % 60)));
+        } else {
+            // Up to 16 events over the day (sessions, releases, manual alarms)
+            std::vector<std::int64_t> times(1 + rng() % 16);
+            for (std::int64_t& time : times) {
+                time = START_NS + static_cast<std::int64_t>(rng() % (24ULL * 3600 * 1000)) * 1000000;
+            }
+            sources.push_back(std::make_shared<EventListSource>(label, times));
+        }
+    }
+    return sources;
+}
+
+/**
+ * @brief The per-tick rescan the aggregator replaces: ask every source, then merge by linear minimum
+ */
+void rescanUpcoming(const std::vector<std::shared_ptr<ICountdownSource>>& sources, std::int64_t nowNs,
+                    std::size_t count, std::vector<std::int64_t>& heads, std::vector<UpcomingEvent>& events) {
+    heads.resize(sources.size());
+    for (std::size_t i = 0; i < sources.size(); ++i) {
+        heads[i] = sources[i]->eventAfter(nowNs);
+    }
+    events.clear();
+    while (events.size() < count) {
+        std::size_t earliest = std::min_element(heads.begin(), heads.end()) - heads.begin();
+        if (heads[earliest] == ICountdownSource::NEVER) {
+            break;
+        }
+        UpcomingEvent event;
+        event.timeNs = heads[earliest];
+        event.source = earliest;
+        events.push_back(event);
+        heads[earliest] = sources[earliest]->eventAfter(heads[earliest]);
+    }
+}
+
+void measure(std::size_t sourceCount) {
+    std::vector<std::shared_ptr<ICountdownSource>> sources = makeSources(sourceCount);
+    NextEventAggregator aggregator(START_NS);
+    for (const auto& source : sources) {
+        aggregator.addSource(source);
+    }
+
+    // Both paths must list the same events (equal times may come in either source order)
+    std::size_t mismatches = 0;
+    std::vector<std::int64_t> heads;
+    std::vector<UpcomingEvent> expected;
+    std::vector<UpcomingEvent> actual;
+    for (std::size_t tick = 1; tick <= 3000; ++tick) {
+        std::int64_t nowNs = START_NS + static_cast<std::int64_t>(tick) * TICK_NS;
+        aggregator.advanceTo(nowNs);
+        aggregator.upcoming(TOP_K, actual);
+        rescanUpcoming(sources, nowNs, TOP_K, heads, expected);
+        bool same = actual.size() == expected.size();
+        for (std::size_t i = 0; same && i < actual.size(); ++i) {
+            same = actual[i].timeNs == expected[i].timeNs;
+        }
+        mismatches += same ? 0 : 1;
+    }
+
+    std::string prefix = std::to_string(sourceCount) + " sources";
+    double rescanNextNs = BenchmarkUtils::bestOfNs([&]() {
+        for (std::size_t tick = 1; tick <= TICKS; ++tick) {
+            rescanUpcoming(sources, START_NS + static_cast<std::int64_t>(tick) * TICK_NS, 1, heads, expected);
+            BenchmarkUtils::doNotOptimize(expected);
+        }
+    }, 3) / TICKS;
+    double rescanTopNs = BenchmarkUtils::bestOfNs([&]() {
+        for (std::size_t tick = 1; tick <= TICKS; ++tick) {
+            rescanUpcoming(sources, START_NS + static_cast<std::int64_t>(tick) * TICK_NS, TOP_K, heads, expected);
+            BenchmarkUtils::doNotOptimize(expected);
+        }
+    }, 3) / TICKS;
+
+    std::size_t fired = 0;
+    double aggregateNextNs = BenchmarkUtils::bestOfNs([&]() {
+        NextEventAggregator timed(START_NS);
+        for (const auto& source : sources) {
+            timed.addSource(source);
+        }
+        fired = 0;
+        for (std::size_t tick = 1; tick <= TICKS; ++tick) {
+            fired += timed.advanceTo(START_NS + static_cast<std::int64_t>(tick) * TICK_NS);
+            UpcomingEvent next = timed.next();
+            BenchmarkUtils::doNotOptimize(next);
+        }
+    }, 3) / TICKS;
+    double aggregateTopNs = BenchmarkUtils::bestOfNs([&]() {
+        NextEventAggregator timed(START_NS);
+        for (const auto& source : sources) {
+            timed.addSource(source);
+        }
+        for (std::size_t tick = 1; tick <= TICKS; ++tick) {
+            timed.advanceTo(START_NS + static_cast<std::int64_t>(tick) * TICK_NS);
+            timed.upcoming(TOP_K, actual);
+            BenchmarkUtils::doNotOptimize(actual);
+        }
+    }, 3) / TICKS;
+
+    BenchmarkUtils::report(prefix + ": mismatched ticks", static_cast<double>(mismatches), "");
+    BenchmarkUtils::report(prefix + ": events passed per hour", static_cast<double>(fired), "");
+    BenchmarkUtils::report(prefix + ": rescan next, per tick", rescanNextNs, "ns");
+    BenchmarkUtils::report(prefix + ": aggregator next, per tick", aggregateNextNs, "ns");
+    BenchmarkUtils::report(prefix + ": rescan top-" + std::to_string(TOP_K) + ", per tick", rescanTopNs, "ns");
+    BenchmarkUtils::report(prefix + ": aggregator top-" + std::to_string(TOP_K) + ", per tick", aggregateTopNs, "ns");
+}
+
+} // namespace
+
+int main() {
+    std::cout << "Next-event aggregation: one simulated hour of 100 ms overlay ticks, 1/4 bar closes, 3/4 event lists"
+              << std::endl;
+    for (std::size_t sources : {16, 256, 4096}) {
+        measure(sources);
+    }
+    return 0;
+}
@@ -0,0 +1,165 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "BenchmarkUtils.h"
+#include "tradingTimeCounter/FrameCache.h"
+#include "tradingTimeCounter/GlyphAtlas.h"
+#include "tradingTimeCounter/SoftwareRenderer.h"
+
+using namespace TradingTimeCounter;
+
+namespace {
+
+const int FRAMES = 600;
+
+/**
+ * @brief Countdown text for a given number of seconds remaining ("MM:SS")
+ */
+std::string formatCountdown(int seconds) {
+    char text[8];
+    std::snprintf(text, sizeof(text), "%02d:%02d", seconds / 60 % 100, seconds % 60);
+    return text;
+}
+
+/**
+ * @brief Copy of the visible framebuffer contents for comparisons
+ */
+std::vector<std::uint32_t> snapshot(const Framebuffer& framebuffer) {
+    std::vector<std::uint32_t> pixels;
+    pixels.reserve(static_cast<std::size_t>(framebuffer.getWidth()) * framebuffer.getHeight());
+    for (int y = 0; y < framebuffer.getHeight(); ++y) {
+        pixels.insert(pixels.end(), framebuffer.row(y), framebuffer.row(y) + framebuffer.getWidth());
+    }
+    return pixels;
+}
+
+} // namespace
+
+int main() {
+    DisplayConfig config;
+    config.windowWidth = 480;
+    config.windowHeight = 160;
+    config.fontSize = 64;
+    config.opacity = 200;
+
+    std::cout << "Software renderer, " << config.windowWidth << "x" << config.windowHeight
+              << " (selected kernel: " << getSimdLevelName(getSimdLevel()) << ")" << std::endl;
+
+    // Every kernel must produce byte-identical frames
+    std::size_t mismatches = 0;
+    SoftwareRenderer reference;
+    reference.setSimdLevel(SimdLevel::Scalar);
+    reference.configure(config);
+    for (SimdLevel level : {SimdLevel::SSE2, SimdLevel::AVX2}) {
+        SoftwareRenderer renderer;
+        renderer.setSimdLevel(level);
+        renderer.configure(config);
+        for (int seconds = 300; seconds >= 0; --seconds) {
+            std::string text = formatCountdown(seconds);
+            reference.render(text);
+            renderer.render(text);
+            mismatches += snapshot(reference.getFramebuffer()) != snapshot(renderer.getFramebuffer());
+        }
+    }
+    std::cout << "  Frame mismatches vs scalar: " << mismatches << std::endl;
+
+    // Glyph setup: atlas size vs a size rasterised at runtime
+    for (int fontSize : {48, 56}) {
+        DisplayConfig sized = config;
+        sized.fontSize = fontSize;
+        SoftwareRenderer renderer;
+        double ns = BenchmarkUtils::bestOfNs([&]() {
+            for (int i = 0; i < 100; ++i) {
+                renderer.configure(sized);
+            }
+        });
+        const char* source = GlyphAtlas::findFace(fontSize, sized.isBold) ? "atlas" : "runtime";
+        BenchmarkUtils::report("configure, size " + std::to_string(fontSize) + " (" + source + ")", ns / 100 / 1000.0, "us");
+    }
+
+    for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2}) {
+        SoftwareRenderer renderer;
+        renderer.setSimdLevel(level);
+        renderer.configure(config);
+
+        double fullNs = BenchmarkUtils::bestOfNs([&]() {
+            for (int i = 0; i < FRAMES; ++i) {
+                renderer.invalidate();
+                BenchmarkUtils::doNotOptimize(renderer.render(formatCountdown(FRAMES - i)));
+            }
+        });
+        BenchmarkUtils::report(std::string("full redraw, ") + getSimdLevelName(level), fullNs / FRAMES / 1000.0, "us/frame");
+
+        // One tick per frame, as the overlay sees it: usually a single cell changes
+        double incrementalNs = BenchmarkUtils::bestOfNs([&]() {
+            for (int i = 0; i < FRAMES; ++i) {
+                BenchmarkUtils::doNotOptimize(renderer.render(formatCountdown(FRAMES - i)));
+            }
+        });
+        BenchmarkUtils::report(std::string("dirty cells only, ") + getSimdLevelName(level), incrementalNs / FRAMES / 1000.0, "us/frame");
+    }
+
+    // Tick path at the application's overlay size: dirty-cell render vs frame cache
+    // pre-warmed with upcoming seconds as App does between ticks
+    DisplayConfig overlay;
+    overlay.fontSize = 28;
+    overlay.windowWidth = 150;
+    overlay.windowHeight = 60;
+
+    SoftwareRenderer uncached;
+    uncached.configure(overlay);
+    double uncachedNs = BenchmarkUtils::bestOfNs([&]() {
+        for (int seconds = 300; seconds >= 0; --seconds) {
+            BenchmarkUtils::doNotOptimize(uncached.render(formatCountdown(seconds)));
+        }
+    });
+    BenchmarkUtils::report("uncached tick (dirty cells), 150x60", uncachedNs / 301 / 1000.0, "us/tick");
+
+    SoftwareRenderer renderer;
+    renderer.configure(overlay);
+    FrameCache cache;
+    const std::uint64_t configHash = FrameCache::hashConfig(overlay);
+    const Framebuffer& rendered = renderer.getFramebuffer();
+    std::vector<std::uint32_t> surface(static_cast<std::size_t>(rendered.getStride()) * rendered.getHeight());
+    const int bars = 4;
+    const int prewarmSeconds = 5;
+
+    double tickNs = 0.0;
+    double prewarmNs = 0.0;
+    for (int bar = 0; bar < bars; ++bar) {
+        for (int seconds = 300; seconds >= 0; --seconds) {
+            auto start = std::chrono::steady_clock::now();
+            std::string text = formatCountdown(seconds);
+            std::shared_ptr<const Framebuffer> frame = cache.find(text, configHash);
+            if (!frame) {
+                renderer.render(text);
+                frame = std::make_shared<const Framebuffer>(rendered);
+                cache.insert(text, configHash, frame);
+            }
+            std::memcpy(surface.data(), frame->row(0), surface.size() * sizeof(std::uint32_t));
+            auto presented = std::chrono::steady_clock::now();
+
+            std::vector<std::string> upcoming;
+            for (int i = 1; i <= prewarmSeconds && seconds - i >= 0; ++i) {
+                upcoming.push_back(formatCountdown(seconds - i));
+            }
+            cache.prewarm(renderer, configHash, upcoming);
+
+            tickNs += std::chrono::duration<double, std::nano>(presented - start).count();
+            prewarmNs += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - presented).count();
+        }
+    }
+
+    FrameCacheStats stats = cache.getStats();
+    const int ticks = bars * 301;
+    BenchmarkUtils::report("cached tick (lookup + frame copy), 150x60", tickNs / ticks / 1000.0, "us/tick");
+    BenchmarkUtils::report("idle pre-warm", prewarmNs / ticks / 1000.0, "us/tick");
+    std::cout << "  Frame cache: hit rate " << stats.getHitRate() * 100.0 << "%, " << stats.entryCount << " frames, "
+              << stats.memoryBytes / 1024 << " KiB of " << stats.memoryBudget / 1024 << " KiB, "
+              << stats.evictions << " evictions" << std::endl;
+    return 0;
+}
@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BenchmarkUtils.h"
+#include "tradingTimeCounter/ShardedTimerScheduler.h"
+#include "tradingTimeCounter/TscClock.h"
+
+using namespace TradingTimeCounter;
+
+namespace {
+
+const std::uint64_t OPERATIONS = 400000;             // add + cancel commands per run (all producers)
+const std::uint64_t TIMERS = 100000;                 // Timers in the expiry run
+const std::int64_t SPREAD_NS = 1000000000;           // Expiry run: deadlines spread over 1 s
+const std::int64_t LEAD_NS = 200000000;              // ... starting 200 ms out
+
+std::uint64_t appliedCommands(const ShardedTimerScheduler& scheduler) {
+    std::uint64_t applied = 0;
+    for (std::size_t i = 0; i < scheduler.getShardCount(); ++i) {
+        applied += scheduler.getStats(i).commands;
+    }
+    return applied;
+}
+
+/**
+ * @brief One producer per shard adds and cancels timers; time until every command is applied
+ */
+void measureThroughput(std::size_t shards, bool pin) {
+    ShardedTimerScheduler scheduler([](std::uint64_t, std::int64_t) {}, shards, pin);
+    scheduler.start();
+    
+    std::int64_t farNs = TscClock::nowNs() + 3600LL * 1000000000;
+    std::uint64_t perProducer = OPERATIONS / shards / 2;
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> producers;
+    for (std::size_t p = 0; p < shards; ++p) {
+        producers.emplace_back([&scheduler, p, perProducer, farNs]() {
+            for (std::uint64_t i = 0; i < perProducer; ++i) {
+                std::uint64_t key = p << 32 | i;
+                scheduler.add(key, farNs + static_cast<std::int64_t>(i));
+                scheduler.cancel(key);
+            }
+        });
+    }
+    for (std::thread& producer : producers) {
+        producer.join();
+    }
+    std::uint64_t total = perProducer * 2 * shards;
+    while (appliedCommands(scheduler) < total) {
+        std::this_thread::yield();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    
+    std::uint64_t fullWaits = 0;
+    for (std::size_t i = 0; i < shards; ++i) {
+        fullWaits += scheduler.getStats(i).mailboxFull;
+    }
+    std::string prefix = std::to_string(shards) + (shards == 1 ? " shard" : " shards") + (pin ? " (pinned)" : "");
+    BenchmarkUtils::report(prefix + ": timer operations", total / seconds / 1e6, "M/s");
+    BenchmarkUtils::report(prefix + ":   full-mailbox waits", static_cast<double>(fullWaits), "");
+}
+
+/**
+ * @brief Expire TIMERS one-shot timers spread over a second; lateness per expiry
+ */
+void measureExpiry(std::size_t shards, bool pin) {
+    std::vector<std::vector<double>> lateness(shards);
+    ShardedTimerScheduler* owner = nullptr;
+    std::atomic<std::uint64_t> fired{0};
+    ShardedTimerScheduler scheduler([&](std::uint64_t key, std::int64_t deadlineNs) {
+        // Each shard appends to its own vector, so no lock is needed
+        lateness[owner->shardOf(key)].push_back(static_cast<double>(TscClock::nowNs() - deadlineNs));
+        fired.fetch_add(1, std::memory_order_relaxed);
+    }, shards, pin);
+    owner = &scheduler;
+    for (std::vector<double>& values : lateness) {
+        values.reserve(TIMERS);
+    }
+    
+    std::int64_t firstNs = TscClock::nowNs() + LEAD_NS;
+    for (std::uint64_t i = 0; i < TIMERS; ++i) {
+        scheduler.add(i, firstNs + static_cast<std::int64_t>(i * SPREAD_NS / TIMERS));
+    }
+    scheduler.start();
+    while (fired.load() < TIMERS) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    scheduler.stop();
+    
+    std::vector<double> all;
+    for (const std::vector<double>& values : lateness) {
+        all.insert(all.end(), values.begin(), values.end());
+    }
+    std::sort(all.begin(), all.end());
+    std::string prefix = std::to_string(shards) + (shards == 1 ? " shard" : " shards") + (pin ? " (pinned)" : "");
+    BenchmarkUtils::report(prefix + ": expiry lateness p50", all[all.size() / 2] / 1000.0, "us");
+    BenchmarkUtils::report(prefix + ": expiry lateness p99", all[all.size() * 99 / 100] / 1000.0, "us");
+    BenchmarkUtils::report(prefix + ": expiry lateness max", all.back() / 1000.0, "us");
+}
+
+} // namespace
+
+int main() {
+    TscClock::waitForCalibration();
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    std::cout << "Sharded timer scheduler (" << cores << " CPUs; scaling needs at least as many CPUs as shards)" << std::endl;
+    for (std::size_t shards : {1, 2, 4, 8}) {
+        bool pin = shards <= cores;
+        measureThroughput(shards, pin);
+    }
+    std::cout << "Expiry of " << TIMERS << " timers spread over " << SPREAD_NS / 1000000 << " ms" << std::endl;
+    for (std::size_t shards : {1, 2, 4, 8}) {
+        bool pin = shards <= cores;
+        measureExpiry(shards, pin);
+    }
+    return 0;
+}
@@ -0,0 +1,217 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "BenchmarkUtils.h"
+#include "tradingTimeCounter/CountdownTimer.h"
+#include "tradingTimeCounter/SoftwareRenderer.h"
+#include "tradingTimeCounter/StateFile.h"
+
+extern char** environ;
+
+using namespace TradingTimeCounter;
+
+namespace {
+
+const int LAUNCHES = 20;
+const std::int64_t RESUME_REMAINING_NS = 123456000000LL;    // Countdown left when the process "crashes"
+
+std::int64_t wallNowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief State of a free-running 5-minute countdown that is running, plus dashboard rows
+ */
+PersistedState runningState(std::int64_t deadlineNs) {
+    PersistedState state{};
+    state.timer.durationSeconds = 5 * 60;
+    state.timer.state = static_cast<std::uint8_t>(CountdownState::Running);
+    state.timer.deadlineNs = deadlineNs;
+    state.dashboardCount = 8;
+    for (std::uint32_t i = 0; i < state.dashboardCount; ++i) {
+        std::snprintf(state.dashboard[i].label, sizeof(state.dashboard[i].label), "ES %um", i + 1);
+        state.dashboard[i].periodSeconds = static_cast<std::int32_t>(60 * (i + 1));
+    }
+    return state;
+}
+
+/**
+ * @brief Child process: restore from the state file (if any) and render the first frame
+ *
+ * Prints the frame text, the remaining ms it shows and the in-process time
+ * from main() to the rendered frame.
+ */
+int runChild(const char* path) {
+    auto start = std::chrono::steady_clock::now();
+
+    CountdownTimer timer(5);
+    if (path[0] != '\0') {
+        StateFile file;
+        PersistedState state;
+        if (!file.open(path) || !file.load(state)) {
+            return 1;
+        }
+        timer.restoreDeadline(state.timer.deadlineNs);
+    }
+
+    DisplayConfig config;
+    config.fontFamily = "builtin";
+    SoftwareRenderer renderer;
+    renderer.configure(config);
+    std::string text = timer.getFormattedTime();
+    BenchmarkUtils::doNotOptimize(renderer.render(text));
+
+    auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start);
+    std::printf("%s %u %.1f\n", text.c_str(), timer.getSnapshot().remainingMs, elapsed.count());
+    return 0;
+}
+
+struct LaunchResult {
+    bool ok = false;
+    double launchUs = 0.0;              ///< Spawn to first frame, measured by the parent
+    double inProcessUs = 0.0;           ///< main() to first frame, measured by the child
+    std::int64_t errorMs = 0;           ///< Shown remaining time minus the wall-clock truth
+};
+
+/**
+ * @brief Spawn a child and wait for its first frame
+ */
+LaunchResult launch(const char* self, const std::string& path, std::int64_t deadlineNs) {
+    LaunchResult result;
+    int fds[2];
+    if (pipe(fds) != 0) {
+        return result;
+    }
+
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_adddup2(&actions, fds[1], STDOUT_FILENO);
+    posix_spawn_file_actions_addclose(&actions, fds[0]);
+
+    std::string childPath = path;
+    char* argv[] = {const_cast<char*>(self), const_cast<char*>("--child"), &childPath[0], nullptr};
+    pid_t pid = 0;
+    auto start = std::chrono::steady_clock::now();
+    int spawned = posix_spawn(&pid, self, &actions, nullptr, argv, environ);
+    posix_spawn_file_actions_destroy(&actions);
+    close(fds[1]);
+    if (spawned != 0) {
+        close(fds[0]);
+        return result;
+    }
+
+    char line[128] = {};
+    ssize_t length = read(fds[0], line, sizeof(line) - 1);
+    auto end = std::chrono::steady_clock::now();
+    std::int64_t truthMs = (deadlineNs - wallNowNs()) / 1000000;
+    close(fds[0]);
+    int status = 0;
+    waitpid(pid, &status, 0);
+
+    char text[16] = {};
+    unsigned remainingMs = 0;
+    if (length > 0 && std::sscanf(line, "%15s %u %lf", text, &remainingMs, &result.inProcessUs) == 3
+        && WIFEXITED(status) && WEXITSTATUS(status) == 0) {
+        result.ok = true;
+        result.launchUs = std::chrono::duration<double, std::micro>(end - start).count();
+        result.errorMs = static_cast<std::int64_t>(remainingMs) - truthMs;
+    }
+    return result;
+}
+
+double median(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    return values.empty() ? 0.0 : values[values.size() / 2];
+}
+
+/**
+ * @brief Launch children repeatedly and report time to first frame
+ */
+void reportLaunches(const char* self, const std::string& name, const std::string& path, std::int64_t deadlineNs) {
+    std::vector<double> launchUs;
+    std::vector<double> inProcessUs;
+    std::int64_t worstErrorMs = 0;
+    int failures = 0;
+    for (int i = 0; i < LAUNCHES; ++i) {
+        LaunchResult result = launch(self, path, deadlineNs);
+        if (!result.ok) {
+            ++failures;
+            continue;
+        }
+        launchUs.push_back(result.launchUs);
+        inProcessUs.push_back(result.inProcessUs);
+        worstErrorMs = std::max(worstErrorMs, std::abs(result.errorMs));
+    }
+
+    std::cout << "  " << name << std::endl;
+    BenchmarkUtils::report("    spawn to first frame, median", median(launchUs) / 1000.0, "ms");
+    BenchmarkUtils::report("    main() to first frame, median", median(inProcessUs), "us");
+    if (deadlineNs != 0) {
+        BenchmarkUtils::report("    worst shown vs wall-clock remaining", static_cast<double>(worstErrorMs), "ms");
+    }
+    BenchmarkUtils::report("    failed launches", static_cast<double>(failures), "");
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc == 3 && std::strcmp(argv[1], "--child") == 0) {
+        return runChild(argv[2]);
+    }
+
+    char pathTemplate[] = "/tmp/ttcStateXXXXXX";
+    int fd = mkstemp(pathTemplate);
+    if (fd < 0) {
+        std::cerr << "Failed to create a temporary state file" << std::endl;
+        return 1;
+    }
+    close(fd);
+    const std::string path = pathTemplate;
+
+    std::cout << "State file persistence and restart" << std::endl;
+
+    // Cost of persisting a state change and of reading it back
+    StateFile file;
+    if (!file.open(path)) {
+        return 1;
+    }
+    PersistedState state = runningState(wallNowNs() + RESUME_REMAINING_NS);
+    const int saves = 200000;
+    double saveNs = BenchmarkUtils::bestOfNs([&]() {
+        for (int i = 0; i < saves; ++i) {
+            state.timer.remainingMs = static_cast<std::uint32_t>(i);
+            file.save(state);
+        }
+    });
+    PersistedState loaded{};
+    double loadNs = BenchmarkUtils::bestOfNs([&]() {
+        for (int i = 0; i < saves; ++i) {
+            file.load(loaded);
+            BenchmarkUtils::doNotOptimize(loaded.timer.deadlineNs);
+        }
+    });
+    BenchmarkUtils::report("save() per state change (no flush)", saveNs / saves, "ns");
+    BenchmarkUtils::report("load() with checksum", loadNs / saves, "ns");
+
+    // "Crash" with a running countdown: the state is in the mapping, never flushed or closed cleanly
+    std::int64_t deadlineNs = wallNowNs() + RESUME_REMAINING_NS;
+    file.save(runningState(deadlineNs));
+
+    std::cout << "Restart to first correct frame, " << LAUNCHES << " launches each" << std::endl;
+    reportLaunches(argv[0], "fresh start (no state file)", "", 0);
+    reportLaunches(argv[0], "resume from state file", path, deadlineNs);
+
+    file.close();
+    std::remove(path.c_str());
+    return 0;
+}
@@ -0,0 +1,142 @@
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include "BenchmarkUtils.h"
+#include "tradingTimeCounter/BasicCountdownTimer.h"
+
+using namespace TradingTimeCounter;
+
+namespace {
+
+const std::uint32_t BAR_MS = 5 * 60 * 1000;          // One 5-minute bar
+const int BARS = 10;
+
+// Formatting is evaluated at compile time
+static_assert(SecondsResolution::format(61001).equals("01:02"), "MM:SS rounds up");
+static_assert(TenthsResolution::format(9950).equals("10.0"), "SS.t rounds up");
+static_assert(MinutesResolution::format(3600001).equals("01:01"), "HH:MM rounds up");
+
+/**
+ * @brief Statically dispatched sink that counts events
+ */
+struct CountingSink {
+    std::uint64_t updates = 0;
+    std::uint64_t completions = 0;
+    std::uint64_t checksum = 0;
+
+    void onUpdate(const CountdownText& text, std::uint32_t) {
+        ++updates;
+        checksum += static_cast<unsigned char>(text.data[text.length - 1]);
+    }
+    void onCompleted() { ++completions; }
+};
+
+/**
+ * @brief ITimerCallback counterpart of CountingSink
+ */
+class CountingCallback : public ITimerCallback {
+public:
+    void onTimerUpdate(int remainingSeconds) override {
+        ++updates;
+        checksum += static_cast<std::uint64_t>(remainingSeconds);
+    }
+    void onTimerCompleted() override { ++completions; }
+    void onTimerStarted() override {}
+    void onTimerStopped() override {}
+
+    std::uint64_t updates = 0;
+    std::uint64_t completions = 0;
+    std::uint64_t checksum = 0;
+};
+
+using SpecialisedTimer = BasicCountdownTimer<ManualTimeSource, SecondsResolution, Repeating, CountingSink>;
+using ErasedTimer = BasicCountdownTimer<ManualTimeSource, PolicyResolution, RuntimeRepeat, CallbackSink>;
+
+/**
+ * @brief Drive a timer through BARS bars in steps of stepMs; report ns per tick
+ */
+template <typename Timer>
+double nsPerTick(Timer& timer, std::uint32_t stepMs) {
+    std::uint64_t ticks = static_cast<std::uint64_t>(BARS) * BAR_MS / stepMs;
+    double ns = BenchmarkUtils::bestOfNs([&]() {
+        for (std::uint64_t i = 0; i < ticks; ++i) {
+            timer.getClock().currentNs += static_cast<std::int64_t>(stepMs) * 1000000;
+            BenchmarkUtils::doNotOptimize(timer.tick());
+        }
+    });
+    return ns / static_cast<double>(ticks);
+}
+
+/**
+ * @brief Compare the constexpr formatters with DisplayPrecisionPolicy over every millisecond
+ */
+std::uint64_t countFormatMismatches() {
+    DisplayPrecisionPolicy seconds = DisplayPrecisionPolicy::fixedSeconds();
+    DisplayPrecisionPolicy tenths;
+    tenths.tenthsAtOrBelowMs = 0xFFFFFFFF;
+    DisplayPrecisionPolicy minutes;
+    minutes.minutesAboveMs = 0;
+
+    std::uint64_t mismatches = 0;
+    for (std::uint32_t ms = 0; ms <= 2 * 3600000; ++ms) {
+        mismatches += SecondsResolution::format(ms).toString() != seconds.format(ms);
+        mismatches += SecondsResolution::nextChangeMs(ms) != seconds.nextChangeMs(ms);
+        if (ms <= 600000) {
+            mismatches += TenthsResolution::format(ms).toString() != tenths.format(ms);
+            mismatches += TenthsResolution::nextChangeMs(ms) != tenths.nextChangeMs(ms);
+        }
+        if (ms > 0) {
+            mismatches += MinutesResolution::format(ms).toString() != minutes.format(ms);
+            mismatches += MinutesResolution::nextChangeMs(ms) != minutes.nextChangeMs(ms);
+        }
+    }
+    return mismatches;
+}
+
+} // namespace
+
+int main() {
+    std::cout << "Countdown tick cost, " << BARS << " repeating 5-minute bars in MM:SS" << std::endl;
+    std::cout << "  Format mismatches vs DisplayPrecisionPolicy: " << countFormatMismatches() << std::endl;
+
+    auto callback = std::make_shared<CountingCallback>();
+    SpecialisedTimer specialised(BAR_MS);
+    ErasedTimer erased(BAR_MS, CallbackSink{callback}, ManualTimeSource(),
+                       PolicyResolution{DisplayPrecisionPolicy::fixedSeconds()}, RuntimeRepeat{true});
+    specialised.start();
+    erased.start();
+
+    // 1 ms steps: mostly ticks without a text change; 1 s steps: every tick formats and dispatches
+    for (std::uint32_t stepMs : {1u, 1000u}) {
+        std::string step = std::to_string(stepMs) + " ms steps";
+        BenchmarkUtils::report("specialised, " + step, nsPerTick(specialised, stepMs), "ns/tick");
+        BenchmarkUtils::report("type-erased, " + step, nsPerTick(erased, stepMs), "ns/tick");
+    }
+
+    // Both must have seen the same events
+    const CountingSink& sink = specialised.getSink();
+    bool same = sink.updates == callback->updates && sink.completions == callback->completions;
+    std::cout << "  Updates " << sink.updates << " / " << callback->updates << ", completions "
+              << sink.completions << " / " << callback->completions << (same ? " (match)" : " (MISMATCH)") << std::endl;
+
+    // Real clocks: tick cost when nothing changes
+    RepeatingCountdownTimer<CountingSink> tscTimer(BAR_MS);
+    DynamicCountdownTimer steadyTimer(BAR_MS, CallbackSink{callback});
+    tscTimer.start();
+    steadyTimer.start();
+    const int realTicks = 1000000;
+    double tscNs = BenchmarkUtils::bestOfNs([&]() {
+        for (int i = 0; i < realTicks; ++i) {
+            BenchmarkUtils::doNotOptimize(tscTimer.tick());
+        }
+    });
+    double steadyNs = BenchmarkUtils::bestOfNs([&]() {
+        for (int i = 0; i < realTicks; ++i) {
+            BenchmarkUtils::doNotOptimize(steadyTimer.tick());
+        }
+    });
+    BenchmarkUtils::report("RepeatingCountdownTimer (TSC), live tick", tscNs / realTicks, "ns/tick");
+    BenchmarkUtils::report("DynamicCountdownTimer (steady), live tick", steadyNs / realTicks, "ns/tick");
+    return 0;
+}
@@ -0,0 +1,184 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BenchmarkUtils.h"
+#include "tradingTimeCounter/CountdownTimer.h"
+
+using namespace TradingTimeCounter;
+
+namespace {
+
+const int READERS = 2;
+const std::chrono::milliseconds RUN_TIME(500);
+
+/**
+ * @brief Remaining time and state the writer publishes with a generation
+ */
+std::uint32_t expectedRemaining(std::uint32_t generation) { return (generation % 300000) * 1000; }
+bool expectedRunning(std::uint32_t generation) { return generation % 3 != 0; }
+
+/**
+ * @brief Timer state as separate atomics, the previous CountdownTimer layout
+ */
+struct SeparateState {
+    std::atomic<std::uint32_t> generation{0};
+    std::atomic<std::uint32_t> remainingMs{0};
+    std::atomic<bool> isRunning{false};
+
+    void write(std::uint32_t g) {
+        generation.store(g);
+        remainingMs.store(expectedRemaining(g));
+        isRunning.store(expectedRunning(g));
+    }
+
+    bool readConsistent() const {
+        std::uint32_t g = generation.load();
+        std::uint32_t remaining = remainingMs.load();
+        bool running = isRunning.load();
+        return remaining == expectedRemaining(g) && running == expectedRunning(g);
+    }
+};
+
+/**
+ * @brief Timer state packed into one word, as CountdownTimer now stores it
+ */
+struct PackedState {
+    std::atomic<std::uint64_t> word{0};
+
+    void write(std::uint32_t g) {
+        word.store(static_cast<std::uint64_t>(expectedRemaining(g))
+                   | static_cast<std::uint64_t>(expectedRunning(g)) << 32
+                   | static_cast<std::uint64_t>(g) << 40, std::memory_order_release);
+    }
+
+    bool readConsistent() const {
+        std::uint64_t value = word.load(std::memory_order_acquire);
+        std::uint32_t g = static_cast<std::uint32_t>(value >> 40);
+        return static_cast<std::uint32_t>(value) == expectedRemaining(g)
+            && ((value >> 32 & 0xFF) != 0) == expectedRunning(g);
+    }
+};
+
+/**
+ * @brief Race one writer against readers and count inconsistent reads
+ * @return Torn reads seen
+ */
+template <typename State>
+std::uint64_t raceLayout(const std::string& name) {
+    State state;
+    state.write(1);
+    const int uncontendedReads = 10000000;
+    double readNs = BenchmarkUtils::bestOfNs([&]() {
+        std::uint64_t consistent = 0;
+        for (int i = 0; i < uncontendedReads; ++i) {
+            consistent += state.readConsistent() ? 1 : 0;
+        }
+        BenchmarkUtils::doNotOptimize(consistent);
+    });
+
+    std::atomic<bool> stop(false);
+    std::atomic<std::uint64_t> reads(0);
+    std::atomic<std::uint64_t> torn(0);
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < READERS; ++r) {
+        readers.emplace_back([&]() {
+            std::uint64_t localReads = 0;
+            std::uint64_t localTorn = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                localTorn += state.readConsistent() ? 0 : 1;
+                ++localReads;
+            }
+            reads += localReads;
+            torn += localTorn;
+        });
+    }
+
+    std::uint64_t writes = 0;
+    auto end = std::chrono::steady_clock::now() + RUN_TIME;
+    for (std::uint32_t g = 1; std::chrono::steady_clock::now() < end; ++g) {
+        for (std::uint32_t i = 0; i < 64; ++i) {
+            state.write((g * 64 + i) & 0xFFFFFF); // Generations are 24-bit
+        }
+        writes += 64;
+    }
+    stop = true;
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+
+    double seconds = std::chrono::duration<double>(RUN_TIME).count();
+    std::cout << "  " << name << std::endl;
+    BenchmarkUtils::report("    consistent read, uncontended", readNs / uncontendedReads, "ns");
+    BenchmarkUtils::report("    reads", reads / seconds / 1e6, "M/s");
+    BenchmarkUtils::report("    writes", writes / seconds / 1e6, "M/s");
+    BenchmarkUtils::report("    torn reads", static_cast<double>(torn.load()), "");
+    return torn.load();
+}
+
+} // namespace
+
+int main() {
+    std::cout << "Timer state word, 1 writer and " << READERS << " readers ("
+              << std::thread::hardware_concurrency() << " hardware threads)" << std::endl;
+    raceLayout<SeparateState>("separate atomics (seq_cst), previous layout"); // Torn reads expected
+    std::uint64_t packedTorn = raceLayout<PackedState>("packed 64-bit word (release/acquire)");
+
+    // A live timer under start/stop/reset churn: every snapshot must be valid
+    // and generations must never go backwards for a reader
+    CountdownTimer timer(5);
+    const std::uint32_t totalMs = 5 * 60 * 1000;
+    std::atomic<bool> stop(false);
+    std::atomic<std::uint64_t> reads(0);
+    std::atomic<std::uint64_t> violations(0);
+    std::vector<std::thread> readers;
+    for (int r = 0; r < READERS; ++r) {
+        readers.emplace_back([&]() {
+            std::uint64_t localReads = 0;
+            std::uint64_t localViolations = 0;
+            std::uint32_t lastGeneration = timer.getSnapshot().generation;
+            while (!stop.load(std::memory_order_relaxed)) {
+                CountdownSnapshot snapshot = timer.getSnapshot();
+                bool validState = snapshot.state == CountdownState::Stopped || snapshot.state == CountdownState::Running
+                    || snapshot.state == CountdownState::Completed;
+                bool forward = ((snapshot.generation - lastGeneration) & 0xFFFFFF) < 0x800000;
+                localViolations += (validState && forward && snapshot.remainingMs <= totalMs) ? 0 : 1;
+                lastGeneration = snapshot.generation;
+                ++localReads;
+            }
+            reads += localReads;
+            violations += localViolations;
+        });
+    }
+
+    std::uint64_t transitions = 0;
+    auto end = std::chrono::steady_clock::now() + RUN_TIME;
+    while (std::chrono::steady_clock::now() < end) {
+        timer.start();
+        timer.stop();
+        timer.reset();
+        transitions += 3;
+    }
+    stop = true;
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+
+    double seconds = std::chrono::duration<double>(RUN_TIME).count();
+    std::cout << "  CountdownTimer under start/stop/reset churn" << std::endl;
+    BenchmarkUtils::report("    getSnapshot() reads", reads / seconds / 1e6, "M/s");
+    BenchmarkUtils::report("    transitions", transitions / seconds / 1e3, "k/s");
+    BenchmarkUtils::report("    invalid or backward snapshots", static_cast<double>(violations.load()), "");
+
+    // Run by ctest: the packed layout and the live timer must never tear
+    if (packedTorn > 0 || violations.load() > 0) {
+        std::cerr << "timerStateBenchmark: " << packedTorn << " torn packed reads, " << violations.load()
+                  << " invalid or backward snapshots" << std::endl;
+        return 1;
+    }
+    return 0;
+}
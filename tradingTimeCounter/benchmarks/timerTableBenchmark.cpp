@@ -0,0 +1,140 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+#include "BenchmarkUtils.h"
+#include "tradingTimeCounter/ITimerCallback.h"
+#include "tradingTimeCounter/TimerTable.h"
+
+using namespace TradingTimeCounter;
+
+namespace {
+
+const std::size_t TIMER_COUNT = 100000;
+const int TICK_PASSES = 100;
+const std::int64_t NS_PER_SECOND = 1000000000LL;
+
+/**
+ * @brief Object-per-timer record with CountdownTimer's member footprint
+ */
+struct ObjectTimer {
+    int totalDuration = 300;
+    std::atomic<int> remainingSeconds{300};
+    std::atomic<bool> isRunning{true};
+    std::atomic<bool> shouldStop{false};
+    std::atomic<std::int64_t> deadline{0};
+    std::shared_ptr<ITimerCallback> callback;
+    std::unique_ptr<std::thread> timerThread;
+    std::int64_t periodNs = 0;
+    std::uint32_t subscriberId = 0;
+};
+
+struct Population {
+    std::vector<std::int64_t> deadlines;
+    std::vector<std::int64_t> periods;
+};
+
+Population makePopulation() {
+    std::mt19937_64 rng(1);
+    std::uniform_int_distribution<int> periodMinutes(1, 60);
+    Population population;
+    for (std::size_t i = 0; i < TIMER_COUNT; ++i) {
+        std::int64_t period = periodMinutes(rng) * 60 * NS_PER_SECOND;
+        population.periods.push_back(period);
+        population.deadlines.push_back(static_cast<std::int64_t>(rng() % static_cast<std::uint64_t>(period)));
+    }
+    return population;
+}
+
+std::vector<std::unique_ptr<ObjectTimer>> makeObjectTimers(const Population& population) {
+    // Interleave unrelated allocations and shuffle, as a long-running process would
+    std::mt19937_64 rng(2);
+    std::vector<std::unique_ptr<ObjectTimer>> timers;
+    std::vector<std::unique_ptr<char[]>> noise;
+    for (std::size_t i = 0; i < TIMER_COUNT; ++i) {
+        auto timer = std::make_unique<ObjectTimer>();
+        timer->deadline.store(population.deadlines[i]);
+        timer->periodNs = population.periods[i];
+        timer->subscriberId = static_cast<std::uint32_t>(i);
+        timers.push_back(std::move(timer));
+        noise.push_back(std::make_unique<char[]>(64 + rng() % 512));
+    }
+    std::shuffle(timers.begin(), timers.end(), rng);
+    return timers;
+}
+
+} // namespace
+
+int main() {
+    Population population = makePopulation();
+
+    TimerTable table(TIMER_COUNT);
+    for (std::size_t i = 0; i < TIMER_COUNT; ++i) {
+        table.add(population.deadlines[i], population.periods[i], static_cast<std::uint32_t>(i));
+    }
+    auto objects = makeObjectTimers(population);
+
+    std::cout << "TimerTable vs object-per-timer, " << TIMER_COUNT << " timers" << std::endl;
+
+    // Bulk advance: shift every deadline (clock correction)
+    double tableShift = BenchmarkUtils::bestOfNs([&]() {
+        for (int pass = 0; pass < TICK_PASSES; ++pass) {
+            table.shiftDeadlines(pass % 2 == 0 ? 1000 : -1000);
+        }
+    });
+    double objectShift = BenchmarkUtils::bestOfNs([&]() {
+        for (int pass = 0; pass < TICK_PASSES; ++pass) {
+            std::int64_t delta = pass % 2 == 0 ? 1000 : -1000;
+            for (auto& timer : objects) {
+                if (timer->isRunning.load()) {
+                    timer->deadline.store(timer->deadline.load() + delta);
+                }
+            }
+        }
+    });
+
+    // Expiry: one pass per simulated second
+    std::vector<ExpiredTimer> expired;
+    expired.reserve(TIMER_COUNT);
+    std::vector<std::uint32_t> objectExpired;
+    objectExpired.reserve(TIMER_COUNT);
+    std::size_t tableFired = 0;
+    std::size_t objectFired = 0;
+    std::int64_t tableNow = 0;
+    std::int64_t objectNow = 0;
+
+    double tableExpire = BenchmarkUtils::bestOfNs([&]() {
+        for (int pass = 0; pass < TICK_PASSES; ++pass) {
+            tableNow += NS_PER_SECOND;
+            tableFired += table.expire(tableNow, expired);
+        }
+    });
+    double objectExpire = BenchmarkUtils::bestOfNs([&]() {
+        for (int pass = 0; pass < TICK_PASSES; ++pass) {
+            objectNow += NS_PER_SECOND;
+            objectExpired.clear();
+            for (auto& timer : objects) {
+                std::int64_t deadline = timer->deadline.load();
+                if (timer->isRunning.load() && deadline <= objectNow) {
+                    objectExpired.push_back(timer->subscriberId);
+                    std::int64_t missed = (objectNow - deadline) / timer->periodNs;
+                    timer->deadline.store(deadline + (missed + 1) * timer->periodNs);
+                }
+            }
+            objectFired += objectExpired.size();
+        }
+    });
+
+    const double perTimerPass = static_cast<double>(TIMER_COUNT) * TICK_PASSES;
+    BenchmarkUtils::report("bulk advance, TimerTable", tableShift / perTimerPass, "ns/timer");
+    BenchmarkUtils::report("bulk advance, object-per-timer", objectShift / perTimerPass, "ns/timer");
+    BenchmarkUtils::report("expiry scan, TimerTable", tableExpire / perTimerPass, "ns/timer");
+    BenchmarkUtils::report("expiry scan, object-per-timer", objectExpire / perTimerPass, "ns/timer");
+    BenchmarkUtils::report("expiry speedup", objectExpire / tableExpire, "x");
+    BenchmarkUtils::doNotOptimize(tableFired + objectFired);
+    return 0;
+}
@@ -0,0 +1,184 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BenchmarkUtils.h"
+#include "tradingTimeCounter/CountdownTimer.h"
+#include "tradingTimeCounter/SoftwareRenderer.h"
+#include "tradingTimeCounter/Trace.h"
+
+using namespace TradingTimeCounter;
+
+namespace {
+
+const int SPANS = 1000000;
+const int THREADS = 4;
+const char* const TRACE_PATH = "traceBenchmark.trace.json";
+
+std::size_t countOccurrences(const std::string& text, const std::string& pattern) {
+    std::size_t count = 0;
+    for (std::size_t at = text.find(pattern); at != std::string::npos; at = text.find(pattern, at + 1)) {
+        ++count;
+    }
+    return count;
+}
+
+std::string readFile(const std::string& path) {
+    std::ifstream file(path);
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+/**
+ * @brief Per-span cost on one thread: empty scope vs clock reads vs a recorded span
+ */
+void measureSpanCost() {
+    std::uint64_t sink = 0;
+    double emptyNs = BenchmarkUtils::bestOfNs([&]() {
+        for (int i = 0; i < SPANS; ++i) {
+            sink += static_cast<std::uint64_t>(i);
+            BenchmarkUtils::doNotOptimize(sink);
+        }
+    });
+    double clockNs = BenchmarkUtils::bestOfNs([&]() {
+        for (int i = 0; i < SPANS; ++i) {
+            BenchmarkUtils::doNotOptimize(Trace::nowNs());
+        }
+    });
+    double spanNs = BenchmarkUtils::bestOfNs([&]() {
+        for (int i = 0; i < SPANS; ++i) {
+            TraceScope scope("benchmark::span");
+            sink += static_cast<std::uint64_t>(i);
+            BenchmarkUtils::doNotOptimize(sink);
+        }
+    });
+
+    BenchmarkUtils::report("empty loop body", emptyNs / SPANS, "ns");
+    BenchmarkUtils::report("one timestamp (TscClock)", clockNs / SPANS, "ns");
+    BenchmarkUtils::report("scoped span (two reads + record)", spanNs / SPANS, "ns");
+    BenchmarkUtils::report("span overhead over empty body", (spanNs - emptyNs) / SPANS, "ns");
+}
+
+/**
+ * @brief Per-span cost with several threads recording at once
+ */
+void measureConcurrentSpans() {
+    std::vector<double> perThreadNs(THREADS);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&perThreadNs, t]() {
+            perThreadNs[t] = BenchmarkUtils::bestOfNs([]() {
+                for (int i = 0; i < SPANS; ++i) {
+                    TraceScope scope("benchmark::concurrent");
+                }
+            }, 3);
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    double worst = 0.0;
+    for (double ns : perThreadNs) {
+        worst = ns > worst ? ns : worst;
+    }
+    BenchmarkUtils::report("span, " + std::to_string(THREADS) + " threads recording (worst thread)", worst / SPANS, "ns");
+}
+
+/**
+ * @brief A tick's formatting and rendering, as instrumented in the library
+ */
+void measureTickPath() {
+    DisplayPrecisionPolicy policy = DisplayPrecisionPolicy::fixedSeconds();
+    DisplayConfig config;
+    config.fontFamily = "builtin";
+    SoftwareRenderer renderer;
+    renderer.configure(config);
+
+    const int ticks = 20000;
+    double tickNs = BenchmarkUtils::bestOfNs([&]() {
+        for (int i = 0; i < ticks; ++i) {
+            BenchmarkUtils::doNotOptimize(renderer.render(policy.format(static_cast<std::uint32_t>(300 - i % 300) * 1000)));
+        }
+    });
+    BenchmarkUtils::report(std::string("format + render tick, trace points ") + (Trace::isCompiledIn() ? "on" : "off"),
+                           tickNs / ticks / 1000.0, "us");
+}
+
+/**
+ * @brief Export while a thread keeps recording; every exported span must be intact
+ */
+void measureExport() {
+    Trace::clear();
+    std::atomic<bool> stop(false);
+    std::thread writer([&stop]() {
+        Trace::setThreadName("benchmark writer");
+        while (!stop.load(std::memory_order_relaxed)) {
+            std::int64_t start = Trace::nowNs();
+            Trace::record("benchmark::fixed", start, start + 1000); // Every span lasts exactly 1 us
+        }
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    std::size_t buffered = Trace::getBufferedCount();
+    double exportNs = BenchmarkUtils::bestOfNs([]() { Trace::writeChromeJson(TRACE_PATH); }, 3);
+    stop = true;
+    writer.join();
+
+    std::string json = readFile(TRACE_PATH);
+    std::size_t spans = countOccurrences(json, "\"ph\":\"X\"");
+    std::size_t intact = countOccurrences(json, "\"name\":\"benchmark::fixed\",\"ph\":\"X\"");
+    std::size_t exactDuration = countOccurrences(json, "\"dur\":1.000}");
+    BenchmarkUtils::report("export " + std::to_string(buffered) + " buffered spans", exportNs / 1e6, "ms");
+    BenchmarkUtils::report("exported JSON size", json.size() / 1024.0, "KB");
+    BenchmarkUtils::report("exported spans", static_cast<double>(spans), "");
+    BenchmarkUtils::report("torn spans (exported while being overwritten)",
+                           static_cast<double>(spans - (intact < exactDuration ? intact : exactDuration)), "");
+    std::remove(TRACE_PATH);
+}
+
+/**
+ * @brief Short-lived threads (one per timer start) must not grow the ring registry
+ */
+void measureThreadChurn() {
+    const int churnThreads = 1000;
+    Trace::clear();
+    std::size_t before = Trace::getBufferCount();
+    for (int i = 0; i < churnThreads; ++i) {
+        std::thread([]() { TraceScope scope("benchmark::churn"); }).join();
+        if (i == churnThreads / 2) {
+            Trace::writeChromeJson(TRACE_PATH); // An export frees the exited threads' rings at once
+        }
+    }
+    std::size_t after = Trace::getBufferCount();
+
+    // Rings released by an export must not hand the same spans to the next one
+    Trace::writeChromeJson(TRACE_PATH);
+    Trace::writeChromeJson(TRACE_PATH);
+    BenchmarkUtils::report("exited-thread spans left after two exports", static_cast<double>(Trace::getBufferedCount()), "");
+    BenchmarkUtils::report("rings allocated for " + std::to_string(churnThreads) + " short-lived threads",
+                           static_cast<double>(after - before), "");
+    BenchmarkUtils::report("ring memory held by them",
+                           static_cast<double>((after - before) * Trace::BUFFER_EVENTS * sizeof(TraceEvent)) / 1024.0, "KB");
+    std::remove(TRACE_PATH);
+}
+
+} // namespace
+
+int main() {
+    std::cout << "Trace spans, " << Trace::BUFFER_EVENTS << " events per thread ring (trace points "
+              << (Trace::isCompiledIn() ? "compiled in" : "compiled out") << ")" << std::endl;
+    measureSpanCost();
+    measureConcurrentSpans();
+    measureTickPath();
+    measureExport();
+    measureThreadChurn();
+    return 0;
+}
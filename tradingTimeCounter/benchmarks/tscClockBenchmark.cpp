@@ -0,0 +1,108 @@
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "BenchmarkUtils.h"
+#include "tradingTimeCounter/TscClock.h"
+
+using namespace TradingTimeCounter;
+
+namespace {
+
+const int READS = 10000000;
+const std::chrono::seconds ERROR_RUN(3);       // Spans a few recalibrations
+const std::int64_t TIGHT_BRACKET_NS = 1000;    // Wider brackets were preempted; their midpoint is meaningless
+
+std::int64_t steadyNowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Cost of one timestamp from each source
+ */
+void measureCost() {
+    double steadyNs = BenchmarkUtils::bestOfNs([]() {
+        for (int i = 0; i < READS; ++i) {
+            BenchmarkUtils::doNotOptimize(std::chrono::steady_clock::now());
+        }
+    });
+    double tscNs = BenchmarkUtils::bestOfNs([]() {
+        for (int i = 0; i < READS; ++i) {
+            BenchmarkUtils::doNotOptimize(TscClock::nowNs());
+        }
+    });
+    BenchmarkUtils::report("steady_clock::now() (vDSO clock_gettime)", steadyNs / READS, "ns");
+    BenchmarkUtils::report("TscClock::nowNs()", tscNs / READS, "ns");
+#ifdef TTC_SIMD_X86
+    double rdtscNs = BenchmarkUtils::bestOfNs([]() {
+        for (int i = 0; i < READS; ++i) {
+            BenchmarkUtils::doNotOptimize(__rdtsc());
+        }
+    });
+    BenchmarkUtils::report("raw RDTSC", rdtscNs / READS, "ns");
+#endif
+}
+
+/**
+ * @brief Converted time vs the kernel clock, across recalibrations
+ */
+void measureError() {
+    std::int64_t maxError = 0;
+    double sumError = 0.0;
+    std::uint64_t samples = 0;
+    std::uint64_t preempted = 0;
+    std::uint64_t backwards = 0;
+    std::int64_t previous = TscClock::nowNs();
+
+    auto end = std::chrono::steady_clock::now() + ERROR_RUN;
+    while (std::chrono::steady_clock::now() < end) {
+        // Busy reads in between, as a timer loop or tracer would do
+        for (int i = 0; i < 1000; ++i) {
+            std::int64_t now = TscClock::nowNs();
+            backwards += now < previous ? 1 : 0;
+            previous = now;
+        }
+
+        std::int64_t before = steadyNowNs();
+        std::int64_t converted = TscClock::nowNs();
+        std::int64_t after = steadyNowNs();
+        backwards += converted < previous ? 1 : 0;
+        previous = converted;
+
+        if (after - before > TIGHT_BRACKET_NS) {
+            ++preempted;
+            continue;
+        }
+        std::int64_t error = converted - (before + (after - before) / 2);
+        error = error < 0 ? -error : error;
+        maxError = error > maxError ? error : maxError;
+        sumError += static_cast<double>(error);
+        ++samples;
+    }
+
+    BenchmarkUtils::report("samples against the kernel clock", static_cast<double>(samples), "");
+    BenchmarkUtils::report("discarded samples (bracket over 1 us)", static_cast<double>(preempted), "");
+    BenchmarkUtils::report("mean |error|", sumError / static_cast<double>(samples), "ns");
+    BenchmarkUtils::report("max |error|", static_cast<double>(maxError), "ns");
+    BenchmarkUtils::report("timestamps that went backwards", static_cast<double>(backwards), "");
+}
+
+} // namespace
+
+int main() {
+    auto calibrationStart = std::chrono::steady_clock::now();
+    TscClockSource source = TscClock::waitForCalibration();
+    double calibrationMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - calibrationStart).count();
+
+    std::cout << "Timestamp source: " << TscClock::getSourceName(source);
+    if (source == TscClockSource::Tsc) {
+        std::cout << " at " << TscClock::getFrequencyHz() / 1e9 << " GHz";
+    }
+    std::cout << " (calibrated in " << calibrationMs << " ms)" << std::endl;
+
+    measureCost();
+    measureError();
+    return 0;
+}
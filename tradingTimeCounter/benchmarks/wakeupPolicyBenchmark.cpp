@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BenchmarkUtils.h"
+#include "tradingTimeCounter/CountdownTimer.h"
+#include "tradingTimeCounter/TscClock.h"
+
+using namespace TradingTimeCounter;
+
+namespace {
+
+const std::uint32_t COUNTDOWN_MS = 3 * 3600 * 1000;  // Simulated countdown: three hours
+const std::uint32_t POLL_MS = 10;                    // Previous fixed polling interval
+const std::uint32_t LIVE_MS = 12000;                 // Real run: the last 12 seconds
+
+/**
+ * @brief Count the wakeups a policy needs for a countdown and its text changes
+ */
+void simulatePolicy(const std::string& name, const DisplayPrecisionPolicy& policy) {
+    std::uint64_t wakeups[3] = {0, 0, 0};
+    std::uint64_t lossy = 0;
+    for (std::uint32_t remainingMs = COUNTDOWN_MS; remainingMs > 0;) {
+        std::uint32_t nextMs = policy.nextChangeMs(remainingMs);
+        ++wakeups[static_cast<int>(policy.precisionAt(nextMs))];
+        if (policy.format(nextMs) == policy.format(remainingMs)) {
+            ++lossy; // Woke without a visible change
+        }
+        remainingMs = nextMs;
+    }
+
+    std::uint64_t total = wakeups[0] + wakeups[1] + wakeups[2];
+    BenchmarkUtils::report(name + ": wakeups", static_cast<double>(total), "");
+    BenchmarkUtils::report(name + ":   in HH:MM", static_cast<double>(wakeups[0]), "");
+    BenchmarkUtils::report(name + ":   in MM:SS", static_cast<double>(wakeups[1]), "");
+    BenchmarkUtils::report(name + ":   in SS.t", static_cast<double>(wakeups[2]), "");
+    BenchmarkUtils::report(name + ":   wakeups without a text change", static_cast<double>(lossy), "");
+}
+
+/**
+ * @brief Records how late each update lands after its text-change instant
+ */
+class LatenessRecorder : public ITimerCallback {
+public:
+    explicit LatenessRecorder(const DisplayPrecisionPolicy& policy)
+        : m_policy(policy)
+        , m_deadlineNs(0) {
+    }
+
+    void setDeadlineNs(std::int64_t deadlineNs) { m_deadlineNs.store(deadlineNs); }
+
+    void onTimerUpdate(int) override {
+        std::int64_t remainingNs = m_deadlineNs.load() - TscClock::nowNs();
+        std::uint32_t remainingMs = static_cast<std::uint32_t>(std::max<std::int64_t>(0, (remainingNs + 999999) / 1000000));
+        std::int64_t unitNs = m_policy.precisionAt(remainingMs) == DisplayPrecision::Tenths ? 100000000 : 1000000000;
+        std::int64_t changeNs = (std::max<std::int64_t>(0, remainingNs) + unitNs - 1) / unitNs * unitNs;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_latenessNs.push_back(static_cast<double>(changeNs - remainingNs));
+    }
+    void onTimerCompleted() override { m_completed = true; }
+    void onTimerStarted() override {}
+    void onTimerStopped() override {}
+    void onTimerResync(int) override {}
+
+    bool isCompleted() const { return m_completed.load(); }
+
+    std::vector<double> takeLateness() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_latenessNs;
+    }
+
+private:
+    DisplayPrecisionPolicy m_policy;
+    std::atomic<std::int64_t> m_deadlineNs;
+    std::atomic<bool> m_completed{false};
+    std::mutex m_mutex;
+    std::vector<double> m_latenessNs;
+};
+
+/**
+ * @brief Run a real countdown through its final seconds under the adaptive policy
+ */
+void measureLiveRun() {
+    DisplayPrecisionPolicy policy = DisplayPrecisionPolicy::adaptive();
+    auto recorder = std::make_shared<LatenessRecorder>(policy);
+    CountdownTimer timer(1);
+    timer.setPrecisionPolicy(policy);
+    timer.setCallback(recorder);
+    timer.restoreRemaining(LIVE_MS);
+
+    // Taken before start(), so the true deadline is no earlier and lateness is an upper bound
+    TscClock::waitForCalibration();
+    recorder->setDeadlineNs(TscClock::nowNs() + static_cast<std::int64_t>(LIVE_MS) * 1000000);
+    timer.start();
+    while (!recorder->isCompleted()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+
+    std::vector<double> lateness = recorder->takeLateness();
+    std::sort(lateness.begin(), lateness.end());
+    BenchmarkUtils::report("live " + std::to_string(LIVE_MS / 1000) + " s (adaptive): wakeups",
+                           static_cast<double>(timer.getWakeupCount()), "");
+    BenchmarkUtils::report("live: 10 ms polling would have woken", static_cast<double>(LIVE_MS / POLL_MS), "");
+    BenchmarkUtils::report("live: text-change updates", static_cast<double>(lateness.size()), "");
+    if (!lateness.empty()) {
+        BenchmarkUtils::report("live: update lateness p50", lateness[lateness.size() / 2] / 1000.0, "us");
+        BenchmarkUtils::report("live: update lateness p99", lateness[lateness.size() * 99 / 100] / 1000.0, "us");
+        BenchmarkUtils::report("live: update lateness max", lateness.back() / 1000.0, "us");
+    }
+}
+
+} // namespace
+
+int main() {
+    std::cout << "Timer wakeups over a " << COUNTDOWN_MS / 3600000 << "-hour countdown" << std::endl;
+    BenchmarkUtils::report("10 ms polling (previous): wakeups", static_cast<double>(COUNTDOWN_MS / POLL_MS), "");
+    simulatePolicy("fixed MM:SS", DisplayPrecisionPolicy::fixedSeconds());
+    simulatePolicy("adaptive", DisplayPrecisionPolicy::adaptive());
+    measureLiveRun();
+    return 0;
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief What a display does while an alert stage is active
+ */
+enum class AlertAction : std::uint8_t {
+    None,               ///< Show the stage's style
+    Flash               ///< Alternate the stage's style with the base style every FLASH_PHASE_MS
+};
+
+/**
+ * @brief One pre-warning stage of a countdown
+ */
+struct AlertStage {
+    std::uint32_t thresholdMs = 0;      ///< Active once at most this much time remains
+    std::size_t styleIndex = 0;         ///< Entry of the display's style table to show
+    AlertAction action = AlertAction::None; ///< Extra behaviour while active
+};
+
+/**
+ * @brief Staged pre-warnings of a countdown (e.g. amber at T-60s, red at T-10s)
+ *
+ * Stages are kept sorted from the earliest (largest threshold) to the
+ * last; the active stage is the last one whose threshold the remaining
+ * time has reached. CountdownTimer wakes exactly at each threshold, and
+ * at each flash toggle of a flashing stage, instead of checking the plan
+ * on every tick.
+ */
+class AlertPlan {
+public:
+    static const std::uint32_t FLASH_PHASE_MS = 500;     ///< Length of each half of a flash cycle
+
+    /**
+     * @brief Add a stage (replaces a stage with the same threshold)
+     * @param stage Stage to add
+     */
+    void addStage(const AlertStage& stage);
+
+    /**
+     * @brief Remove every stage
+     */
+    void clear();
+
+    /**
+     * @brief Check if the plan has no stages
+     * @return true if empty, false otherwise
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Get the stages, earliest first
+     * @return Stages sorted by descending threshold
+     */
+    const std::vector<AlertStage>& getStages() const;
+
+    /**
+     * @brief Get the stage active at a remaining time
+     * @param remainingMs Milliseconds remaining
+     * @return Stage index, -1 before the first threshold
+     */
+    int stageAt(std::uint32_t remainingMs) const;
+
+    /**
+     * @brief Get the next threshold the remaining time will reach
+     * @param remainingMs Milliseconds remaining
+     * @return Largest threshold below remainingMs, 0 if none is left
+     */
+    std::uint32_t nextThresholdMs(std::uint32_t remainingMs) const;
+
+    /**
+     * @brief Check if a stage flashes
+     * @param stage Stage index, -1 for none
+     * @return true if the stage's action is AlertAction::Flash
+     */
+    bool flashesAt(int stage) const;
+
+    /**
+     * @brief Get the half of the flash cycle at a remaining time
+     *
+     * The phase is tied to the remaining time, so every display and a
+     * replay of the same countdown flash in step.
+     * @param remainingMs Milliseconds remaining
+     * @return true while the stage's style shows, false while the base style shows
+     */
+    static bool isFlashHighlighted(std::uint32_t remainingMs);
+
+    /**
+     * @brief Get the remaining time at which a flash next toggles
+     * @param remainingMs Milliseconds remaining
+     * @return Largest multiple of FLASH_PHASE_MS below remainingMs, 0 if none is left
+     */
+    static std::uint32_t nextFlashToggleMs(std::uint32_t remainingMs);
+
+private:
+    std::vector<AlertStage> m_stages;                    ///< Sorted by descending threshold
+};
+
+} // namespace TradingTimeCounter
@@ -2,9 +2,17 @@
 
 #include "ITimerCallback.h"
 #include "IDisplayManager.h"
+#include "CoalescingDisplayManager.h"
 #include "CountdownTimer.h"
+#include "ClockWatcher.h"
+#include "StateFile.h"
+#include "BoundarySignal.h"
+#include <chrono>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 namespace TradingTimeCounter {
 
@@ -31,6 +39,25 @@ public:
     App(const App&) = delete;
     App& operator=(const App&) = delete;
     
+    /**
+     * @brief Persist timer state to a memory-mapped file (call before initialize())
+     * 
+     * initialize() restores the state saved there by a previous run, so a
+     * running countdown continues where the wall clock says it should and
+     * dashboard timers come back; every later state change is saved.
+     * @param path Path of the state file, empty to disable persistence
+     */
+    void setStatePath(const std::string& path);
+    
+    /**
+     * @brief Publish bar closes to other processes (call before initialize())
+     * 
+     * The main countdown is published as BOUNDARY_SIGNAL_LABEL; local
+     * processes block on it with BoundarySubscriber instead of polling.
+     * @param path Path of the signal file (e.g. on /dev/shm), empty to disable
+     */
+    void setBoundarySignalPath(const std::string& path);
+    
     /**
      * @brief Initialize the application
      * @param displayConfig Initial display configuration
@@ -86,12 +113,27 @@ public:
      * @return Current display configuration
      */
     const DisplayConfig& getDisplayConfig() const;
+    
+    /**
+     * @brief Add a labelled bar countdown to the dashboard (call before start())
+     * 
+     * With at least one dashboard timer the display shows all of them as a
+     * list instead of the single timer text, refreshed on every tick.
+     * @param label Row label, e.g. "ES 5m"
+     * @param periodSeconds Bar length in seconds
+     * @param offsetSeconds Boundary offset in seconds (e.g. session open within the period)
+     */
+    void addDashboardTimer(const std::string& label, int periodSeconds, int offsetSeconds = 0);
 
     // ITimerCallback interface implementation
     void onTimerUpdate(int remainingSeconds) override;
     void onTimerCompleted() override;
+    void onTimerBoundary(std::int64_t boundaryNs) override;
     void onTimerStarted() override;
     void onTimerStopped() override;
+    void onTimerResync(int remainingSeconds) override;
+    void onTimerAlert(int stage) override;
+    void onTimerFlash(bool highlighted) override;
 
 private:
     /**
@@ -111,19 +153,71 @@ private:
      * @return Pointer to display manager instance
      */
     std::unique_ptr<IDisplayManager> createDisplayManager();
+    
+    /**
+     * @brief Show the current countdown text, or the dashboard if it has timers
+     */
+    void refreshDisplay();
+    
+    /**
+     * @brief Build the display styles of the alert stages for a configuration
+     * @param config Display configuration (style 0)
+     * @return Style table: configured, amber, red bold
+     */
+    static std::vector<DisplayStyle> buildAlertStyles(const DisplayConfig& config);
+    
+    /**
+     * @brief Select the display style of the current alert stage (and flash phase)
+     */
+    void applyAlertStyle();
+    
+    /**
+     * @brief Open the state file and apply the state it holds
+     */
+    void restoreState();
+    
+    /**
+     * @brief Save the timer and dashboard definitions to the state file
+     */
+    void persistState();
 
 private:
     // Core components
     std::unique_ptr<CountdownTimer> m_timer;           ///< Timer component
-    std::unique_ptr<IDisplayManager> m_display;        ///< Display component
+    std::unique_ptr<CoalescingDisplayManager> m_display; ///< Display component (coalescing wrapper around the backend)
+    std::unique_ptr<ClockWatcher> m_clockWatcher;      ///< Wall-clock jump detector
     
     // Application state
     bool m_isRunning;                                  ///< Application running state
     bool m_shouldExit;                                 ///< Exit request flag
+    int m_lastLoggedSeconds;                           ///< Last remaining second logged
+    std::mutex m_alertMutex;                           ///< Guards the alert state and orders style selection
+    int m_alertStage;                                  ///< Active alert stage, -1 for none (guarded by m_alertMutex)
+    bool m_flashHighlighted;                           ///< A flashing stage shows its own style, not the base (guarded by m_alertMutex)
     DisplayConfig m_displayConfig;                     ///< Current display configuration
+    std::chrono::steady_clock::time_point m_launchTime; ///< Construction time, for time to first frame
+    
+    // Persistence
+    std::string m_statePath;                           ///< State file path (empty = no persistence)
+    StateFile m_stateFile;                             ///< Mapped state file
+    
+    // Cross-process boundary notification
+    std::string m_boundarySignalPath;                  ///< Signal file path (empty = not published)
+    BoundaryPublisher m_boundaryPublisher;             ///< Futex-signalled sequence words
+    int m_boundarySlot;                                ///< Main countdown's slot, -1 if unpublished
+    
+    // Dashboard timers (struct-of-arrays for BoundaryBatch)
+    std::vector<std::int32_t> m_dashboardPeriods;      ///< Bar lengths in seconds
+    std::vector<std::int32_t> m_dashboardOffsets;      ///< Boundary offsets in seconds
+    std::vector<std::int32_t> m_dashboardRemaining;    ///< Seconds to each next boundary
+    std::vector<DashboardRow> m_dashboardRows;         ///< Labels and formatted values
     
     // Constants
     static const int TIMER_DURATION_MINUTES = 5;       ///< Fixed timer duration
+    static const bool ALIGN_TO_BARS = true;            ///< Count down to wall-clock bar closes
+    static const int PREWARM_SECONDS = 5;              ///< Upcoming text changes rendered after each update
+    static const char* const TRACE_FILE;               ///< Chrome trace written on exit (TTC_ENABLE_TRACING)
+    static const char* const BOUNDARY_SIGNAL_LABEL;    ///< Label the main countdown is published under
 };
 
 } // namespace TradingTimeCounter
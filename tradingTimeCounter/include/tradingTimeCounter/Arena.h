@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief Counters reported by Arena
+ */
+struct ArenaStats {
+    std::size_t used = 0;                ///< Bytes handed out
+    std::size_t reserved = 0;            ///< Bytes held in chunks
+    std::size_t chunks = 0;              ///< Chunks allocated from the heap
+};
+
+/**
+ * @brief Bump allocator over heap chunks
+ *
+ * Allocation moves a pointer within the current chunk and takes a new
+ * chunk when it is full; all memory is given back when the arena is
+ * destroyed. Destructors are not run. Used as the chunk source of the
+ * pools that recycle individual blocks. Not thread-safe.
+ */
+class Arena {
+public:
+    static const std::size_t DEFAULT_CHUNK_SIZE = 64 * 1024;   ///< Bytes per chunk
+
+    /**
+     * @brief Constructor
+     * @param chunkSize Bytes per chunk (larger requests get a chunk of their own size)
+     */
+    explicit Arena(std::size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+    // Disable copy constructor and assignment operator
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    /**
+     * @brief Allocate memory
+     * @param bytes Size in bytes
+     * @param alignment Alignment (power of two)
+     * @return Memory valid until the arena is destroyed
+     */
+    void* allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t));
+
+    /**
+     * @brief Get usage counters
+     * @return Counters
+     */
+    ArenaStats getStats() const;
+
+private:
+    /**
+     * @brief Heap block the arena bumps through
+     */
+    struct Chunk {
+        std::unique_ptr<unsigned char[]> memory;         ///< Storage
+        std::size_t size = 0;                            ///< Bytes of storage
+        std::size_t top = 0;                             ///< Bytes in use
+    };
+
+    std::size_t m_chunkSize;                             ///< Default chunk size
+    std::vector<Chunk> m_chunks;                         ///< Chunks, the last one being bumped through
+    std::size_t m_used;                                  ///< Bytes handed out across chunks
+    std::size_t m_reserved;                              ///< Bytes held in chunks
+};
+
+} // namespace TradingTimeCounter
@@ -0,0 +1,402 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include "CountdownTimer.h"
+#include "ITimerCallback.h"
+#include "TscClock.h"
+#include "VirtualClock.h"
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief Countdown text in a fixed buffer (no allocation)
+ */
+struct CountdownText {
+    static constexpr std::size_t CAPACITY = 16;          ///< Buffer size including the terminator
+
+    char data[CAPACITY] = {};                            ///< Null-terminated text
+    std::size_t length = 0;                              ///< Characters before the terminator
+
+    /**
+     * @brief Compare with a null-terminated string
+     * @param text String to compare with
+     * @return true if equal, false otherwise
+     */
+    constexpr bool equals(const char* text) const {
+        std::size_t i = 0;
+        for (; i < length; ++i) {
+            if (text[i] != data[i]) {
+                return false;
+            }
+        }
+        return text[i] == '\0';
+    }
+
+    /**
+     * @brief Copy into a std::string
+     * @return Text
+     */
+    std::string toString() const { return std::string(data, length); }
+};
+
+/**
+ * @brief Format a unit count as "HEAD<separator>TAIL" (DisplayPrecisionPolicy's text)
+ * @param units Remaining time in display units, rounded up
+ * @param separator ':' or '.'
+ * @param divisor Units per head unit (60, or 10 for tenths)
+ * @return Text with at least two head digits
+ */
+constexpr CountdownText formatCountdownUnits(std::uint64_t units, char separator, std::uint64_t divisor) {
+    CountdownText text;
+    std::uint64_t head = units / divisor;
+    std::uint64_t tail = units % divisor;
+
+    std::size_t digits = 2;
+    for (std::uint64_t rest = head / 100; rest > 0; rest /= 10) {
+        ++digits;
+    }
+    for (std::size_t i = digits; i > 0; --i, head /= 10) {
+        text.data[i - 1] = static_cast<char>('0' + head % 10);
+    }
+    text.data[digits] = separator;
+    if (divisor > 10) {
+        text.data[digits + 1] = static_cast<char>('0' + tail / 10);
+        text.data[digits + 2] = static_cast<char>('0' + tail % 10);
+        text.length = digits + 3;
+    } else {
+        text.data[digits + 1] = static_cast<char>('0' + tail);
+        text.length = digits + 2;
+    }
+    return text;
+}
+
+// ---------------------------------------------------------------------------
+// Clock policies: std::int64_t nowNs() in the steady_clock epoch
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Calibrated TSC timestamps (TscClock)
+ */
+struct TscTimeSource {
+    std::int64_t nowNs() const { return TscClock::nowNs(); }
+};
+
+/**
+ * @brief std::chrono::steady_clock timestamps
+ */
+struct SteadyTimeSource {
+    std::int64_t nowNs() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+};
+
+/**
+ * @brief Time set by the owner, for simulations and replays
+ */
+struct ManualTimeSource {
+    std::int64_t currentNs = 0;                          ///< Time returned by nowNs()
+
+    std::int64_t nowNs() const { return currentNs; }
+};
+
+/**
+ * @brief Time of a shared VirtualClock, so many timers follow one simulated clock
+ */
+struct VirtualTimeSource {
+    const VirtualClock* clock = nullptr;                 ///< Clock to read (must outlive the timer)
+
+    std::int64_t nowNs() const { return clock->nowNs(); }
+};
+
+// ---------------------------------------------------------------------------
+// Resolution policies: nextChangeMs() and format() as in DisplayPrecisionPolicy
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Fixed display unit known at compile time
+ * @tparam UnitMs Display unit in milliseconds
+ * @tparam Separator Separator between head and tail
+ * @tparam Divisor Units per head unit
+ */
+template <std::uint32_t UnitMs, char Separator, std::uint32_t Divisor>
+struct FixedResolution {
+    static constexpr std::uint32_t UNIT_MS = UnitMs;     ///< Display unit
+
+    /**
+     * @brief Get the remaining time at which the displayed text next changes
+     * @param remainingMs Milliseconds remaining
+     * @return Remaining milliseconds at the next change (0 once at zero)
+     */
+    static constexpr std::uint32_t nextChangeMs(std::uint32_t remainingMs) {
+        return remainingMs == 0 ? 0 : ((remainingMs + UnitMs - 1) / UnitMs - 1) * UnitMs;
+    }
+
+    /**
+     * @brief Format a remaining time, rounded up to the unit
+     * @param remainingMs Milliseconds remaining
+     * @return Text
+     */
+    static constexpr CountdownText format(std::uint32_t remainingMs) {
+        return formatCountdownUnits((static_cast<std::uint64_t>(remainingMs) + UnitMs - 1) / UnitMs, Separator, Divisor);
+    }
+};
+
+using MinutesResolution = FixedResolution<60000, ':', 60>;   ///< HH:MM
+using SecondsResolution = FixedResolution<1000, ':', 60>;    ///< MM:SS
+using TenthsResolution = FixedResolution<100, '.', 10>;      ///< SS.t
+
+/**
+ * @brief Resolution chosen at runtime by a DisplayPrecisionPolicy
+ */
+struct PolicyResolution {
+    DisplayPrecisionPolicy policy;                       ///< Policy applied to every tick
+
+    std::uint32_t nextChangeMs(std::uint32_t remainingMs) const { return policy.nextChangeMs(remainingMs); }
+
+    CountdownText format(std::uint32_t remainingMs) const {
+        std::string formatted = policy.format(remainingMs);
+        CountdownText text;
+        text.length = formatted.copy(text.data, CountdownText::CAPACITY - 1);
+        return text;
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Repeat policies: bool repeats()
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Stop at zero
+ */
+struct OneShot {
+    static constexpr bool repeats() { return false; }
+};
+
+/**
+ * @brief Re-arm for another period at zero
+ */
+struct Repeating {
+    static constexpr bool repeats() { return true; }
+};
+
+/**
+ * @brief Repeat behaviour chosen at runtime
+ */
+struct RuntimeRepeat {
+    bool repeating = false;                              ///< Re-arm at zero
+
+    bool repeats() const { return repeating; }
+};
+
+// ---------------------------------------------------------------------------
+// Sinks: onUpdate(text, remainingMs) and onCompleted()
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Forwards ticks to an ITimerCallback (virtual dispatch)
+ */
+struct CallbackSink {
+    std::shared_ptr<ITimerCallback> callback;            ///< Receiver (nullptr = none)
+
+    void onUpdate(const CountdownText& text, std::uint32_t remainingMs) {
+        (void)text;
+        if (callback) {
+            callback->onTimerUpdate(static_cast<int>((remainingMs + 999) / 1000));
+        }
+    }
+
+    void onCompleted() {
+        if (callback) {
+            callback->onTimerCompleted();
+        }
+    }
+};
+
+/**
+ * @brief Countdown with its clock, resolution, repeat behaviour and event sink fixed at compile time
+ *
+ * The owner drives it: tick() reads the clock, and when the displayed text
+ * changes formats it into a fixed buffer and hands it to the sink;
+ * nextWakeNs() says when that next happens. With the fixed policies
+ * formatting is constexpr arithmetic, the repeat check is a constant and
+ * sink calls are direct, so the tick path has no virtual calls and no
+ * allocation. Each policy is stored by value; empty policies cost nothing
+ * beyond padding.
+ *
+ * DynamicCountdownTimer is the type-erased configuration (runtime policy,
+ * runtime repeat, ITimerCallback), i.e. the per-tick work of
+ * CountdownTimer's thread. Not thread-safe; owned by one thread.
+ *
+ * @tparam Clock Clock policy (TscTimeSource, SteadyTimeSource, ManualTimeSource, VirtualTimeSource)
+ * @tparam Resolution Resolution policy (SecondsResolution, TenthsResolution, MinutesResolution, PolicyResolution)
+ * @tparam RepeatPolicy Repeat policy (OneShot, Repeating, RuntimeRepeat)
+ * @tparam Sink Event sink with onUpdate(const CountdownText&, std::uint32_t) and onCompleted()
+ */
+template <typename Clock, typename Resolution, typename RepeatPolicy, typename Sink>
+class BasicCountdownTimer {
+public:
+    /**
+     * @brief Construct a stopped countdown
+     * @param durationMs Countdown length in milliseconds
+     * @param sink Event sink
+     * @param clock Clock policy
+     * @param resolution Resolution policy
+     * @param repeat Repeat policy
+     */
+    explicit BasicCountdownTimer(std::uint32_t durationMs, Sink sink = Sink(), Clock clock = Clock(),
+                                 Resolution resolution = Resolution(), RepeatPolicy repeat = RepeatPolicy())
+        : m_clock(std::move(clock))
+        , m_resolution(std::move(resolution))
+        , m_repeat(std::move(repeat))
+        , m_sink(std::move(sink))
+        , m_durationMs(durationMs)
+        , m_remainingMs(durationMs)
+        , m_changeAtMs(durationMs)
+        , m_deadlineNs(0)
+        , m_running(false) {
+    }
+
+    /**
+     * @brief Start counting down from the remaining time; the next tick() sends an update
+     */
+    void start() {
+        if (m_running) {
+            return;
+        }
+        m_deadlineNs = m_clock.nowNs() + static_cast<std::int64_t>(m_remainingMs) * 1000000;
+        m_changeAtMs = m_remainingMs;
+        m_running = true;
+    }
+
+    /**
+     * @brief Stop counting down, keeping the remaining time
+     */
+    void stop() {
+        if (m_running) {
+            m_remainingMs = millisecondsUntil(m_deadlineNs);
+            m_running = false;
+        }
+    }
+
+    /**
+     * @brief Stop and restore the full duration
+     */
+    void reset() {
+        m_running = false;
+        m_remainingMs = m_durationMs;
+    }
+
+    /**
+     * @brief Advance to the clock's current time and deliver due events
+     * @return Milliseconds remaining after the tick
+     */
+    std::uint32_t tick() {
+        if (!m_running) {
+            return m_remainingMs;
+        }
+
+        m_remainingMs = millisecondsUntil(m_deadlineNs);
+        if (m_remainingMs <= m_changeAtMs) {
+            m_changeAtMs = m_resolution.nextChangeMs(m_remainingMs);
+            m_sink.onUpdate(m_resolution.format(m_remainingMs), m_remainingMs);
+        }
+
+        if (m_remainingMs == 0) {
+            m_sink.onCompleted();
+            if (m_repeat.repeats()) {
+                // Next period from the deadline, not from now, so late ticks do not drift
+                m_deadlineNs += static_cast<std::int64_t>(m_durationMs) * 1000000;
+                m_remainingMs = m_durationMs;
+                m_changeAtMs = m_durationMs;
+            } else {
+                m_running = false;
+            }
+        }
+        return m_remainingMs;
+    }
+
+    /**
+     * @brief Get the clock time of the next text change
+     * @return Nanoseconds in the clock's epoch, 0 if not running
+     */
+    std::int64_t nextWakeNs() const {
+        return m_running ? m_deadlineNs - static_cast<std::int64_t>(m_changeAtMs) * 1000000 : 0;
+    }
+
+    /**
+     * @brief Get the remaining time as of the last tick
+     * @return Milliseconds remaining
+     */
+    std::uint32_t getRemainingMs() const { return m_remainingMs; }
+
+    /**
+     * @brief Check if the countdown is running
+     * @return true if running, false otherwise
+     */
+    bool isRunning() const { return m_running; }
+
+    /**
+     * @brief Format the remaining time as of the last tick
+     * @return Text
+     */
+    CountdownText getText() const { return m_resolution.format(m_remainingMs); }
+
+    /**
+     * @brief Get the clock policy (e.g. to move a ManualTimeSource)
+     * @return Clock
+     */
+    Clock& getClock() { return m_clock; }
+
+    /**
+     * @brief Get the event sink
+     * @return Sink
+     */
+    Sink& getSink() { return m_sink; }
+
+private:
+    /**
+     * @brief Milliseconds from now until a deadline, rounded up and clamped at zero
+     * @param deadlineNs Deadline in the clock's epoch
+     * @return Remaining milliseconds
+     */
+    std::uint32_t millisecondsUntil(std::int64_t deadlineNs) const {
+        std::int64_t remainingNs = deadlineNs - m_clock.nowNs();
+        std::int64_t remainingMs = (remainingNs + 999999) / 1000000;
+        remainingMs = remainingNs > 0 ? remainingMs : 0;
+        return static_cast<std::uint32_t>(remainingMs < 0xFFFFFFFF ? remainingMs : 0xFFFFFFFF);
+    }
+
+private:
+    Clock m_clock;                                       ///< Clock policy
+    Resolution m_resolution;                             ///< Resolution policy
+    RepeatPolicy m_repeat;                               ///< Repeat policy
+    Sink m_sink;                                         ///< Event sink
+    std::uint32_t m_durationMs;                          ///< Countdown length
+    std::uint32_t m_remainingMs;                         ///< Remaining as of the last tick or stop
+    std::uint32_t m_changeAtMs;                          ///< Remaining time of the next text change
+    std::int64_t m_deadlineNs;                           ///< Zero instant in the clock's epoch
+    bool m_running;                                      ///< Counting down
+};
+
+/**
+ * @brief Type-erased countdown: runtime precision policy and repeat, ITimerCallback events
+ */
+using DynamicCountdownTimer = BasicCountdownTimer<SteadyTimeSource, PolicyResolution, RuntimeRepeat, CallbackSink>;
+
+/**
+ * @brief Repeating countdown specialised at compile time: TSC clock, MM:SS
+ *
+ * Periods run back to back from start(), not on the wall-clock bar grid;
+ * use CountdownTimer::setWallClockAligned() for bar closes.
+ * @tparam Sink Event sink
+ */
+template <typename Sink>
+using RepeatingCountdownTimer = BasicCountdownTimer<TscTimeSource, SecondsResolution, Repeating, Sink>;
+
+} // namespace TradingTimeCounter
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "CpuFeatures.h"
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief Batch "seconds to next boundary" computation for many timeframes
+ *
+ * For each tuple i, the boundaries are the instants t where
+ * (t - offsets[i]) is a multiple of periods[i]; remaining[i] receives the
+ * seconds from nowSeconds to the first boundary strictly after it, in
+ * (0, periods[i]]. This matches the arming rule of a wall-clock-aligned
+ * CountdownTimer. Periods must be positive and nowSeconds - offsets[i]
+ * must be non-negative.
+ *
+ * The best kernel supported by the CPU (see getSimdLevel) is used.
+ */
+namespace BoundaryBatch {
+
+/**
+ * @brief Compute remaining seconds for a batch of (period, offset) tuples
+ * @param periods Bar lengths in seconds
+ * @param offsets Boundary offsets in seconds (e.g. session open within the period)
+ * @param count Number of tuples
+ * @param nowSeconds Current time in seconds since Unix epoch
+ * @param remaining Receives the remaining seconds for each tuple
+ */
+void computeRemaining(const std::int32_t* periods, const std::int32_t* offsets, std::size_t count,
+                      std::int64_t nowSeconds, std::int32_t* remaining);
+
+/**
+ * @brief Compute remaining seconds with a specific kernel
+ *
+ * Falls back to the scalar kernel if the CPU lacks the requested level.
+ * Intended for benchmarks and cross-checking kernels.
+ * @param level Kernel to use
+ * @param periods Bar lengths in seconds
+ * @param offsets Boundary offsets in seconds
+ * @param count Number of tuples
+ * @param nowSeconds Current time in seconds since Unix epoch
+ * @param remaining Receives the remaining seconds for each tuple
+ */
+void computeRemainingWith(SimdLevel level, const std::int32_t* periods, const std::int32_t* offsets,
+                          std::size_t count, std::int64_t nowSeconds, std::int32_t* remaining);
+
+} // namespace BoundaryBatch
+
+} // namespace TradingTimeCounter
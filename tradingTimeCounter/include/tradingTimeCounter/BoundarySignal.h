@@ -0,0 +1,162 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief Publishes countdown boundaries to other processes through shared memory
+ *
+ * The signal file (put it on a tmpfs such as /dev/shm) holds one slot per
+ * published countdown with a 32-bit sequence word that is incremented at
+ * every boundary. signal() bumps the word and, only if a subscriber is
+ * blocked on it, wakes all of them with one FUTEX_WAKE; the cost does not
+ * grow with the number of subscribers. Slots survive a publisher restart,
+ * so subscribers stay attached.
+ *
+ * Linux only: open() fails on other platforms.
+ */
+class BoundaryPublisher {
+public:
+    static const std::size_t MAX_COUNTDOWNS = 64;        ///< Slots in a signal file
+
+    /**
+     * @brief Constructor
+     */
+    BoundaryPublisher();
+
+    /**
+     * @brief Destructor - unmaps the file
+     */
+    ~BoundaryPublisher();
+
+    // Disable copy constructor and assignment operator
+    BoundaryPublisher(const BoundaryPublisher&) = delete;
+    BoundaryPublisher& operator=(const BoundaryPublisher&) = delete;
+
+    /**
+     * @brief Map a signal file, creating or reinitialising it if needed
+     * @param path Path of the signal file
+     * @return true if successful, false otherwise
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Unmap the file (subscribers keep their mappings)
+     */
+    void close();
+
+    /**
+     * @brief Check if a file is mapped
+     * @return true if open, false otherwise
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Publish a countdown, or find it if already published
+     * @param label Countdown label subscribers look it up by (at most 31 bytes)
+     * @param periodSeconds Bar length in seconds
+     * @return Slot index, -1 if not open or the file is full
+     */
+    int publish(const std::string& label, int periodSeconds);
+
+    /**
+     * @brief Announce a boundary: bump the sequence word and wake blocked subscribers
+     * @param slot Slot index from publish()
+     * @param boundaryNs Boundary that was reached (ns since epoch)
+     */
+    void signal(int slot, std::int64_t boundaryNs);
+
+private:
+    mutable std::mutex m_mutex;                          ///< Guards the mapping against close()
+    void* m_mapping;                                     ///< Start of the mapping
+};
+
+/**
+ * @brief Reader side of a boundary signal file
+ *
+ * Subscribers remember the last sequence they handled and block in
+ * wait() until it moves. A boundary signalled before wait() is entered is
+ * seen immediately, so none is missed; several boundaries during one
+ * wait are coalesced into one wakeup (compare sequences to count them).
+ */
+class BoundarySubscriber {
+public:
+    /**
+     * @brief Constructor
+     */
+    BoundarySubscriber();
+
+    /**
+     * @brief Destructor - unmaps the file
+     */
+    ~BoundarySubscriber();
+
+    // Disable copy constructor and assignment operator
+    BoundarySubscriber(const BoundarySubscriber&) = delete;
+    BoundarySubscriber& operator=(const BoundarySubscriber&) = delete;
+
+    /**
+     * @brief Map an existing signal file
+     * @param path Path of the signal file
+     * @return true if successful, false otherwise
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Unmap the file
+     */
+    void close();
+
+    /**
+     * @brief Check if a file is mapped
+     * @return true if open, false otherwise
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Look up a published countdown
+     * @param label Countdown label
+     * @return Slot index, -1 if not published
+     */
+    int find(const std::string& label) const;
+
+    /**
+     * @brief Get a slot's sequence word
+     * @param slot Slot index from find()
+     * @return Boundaries signalled so far (wraps)
+     */
+    std::uint32_t getSequence(int slot) const;
+
+    /**
+     * @brief Get the boundary most recently signalled on a slot
+     * @param slot Slot index from find()
+     * @return Boundary in ns since epoch, 0 if none yet
+     */
+    std::int64_t getBoundaryNs(int slot) const;
+
+    /**
+     * @brief Get a slot's bar length
+     * @param slot Slot index from find()
+     * @return Period in seconds
+     */
+    int getPeriodSeconds(int slot) const;
+
+    /**
+     * @brief Block until the sequence word differs from the last one seen
+     * @param slot Slot index from find()
+     * @param seen Sequence the caller has already handled
+     * @param timeout Longest time to block
+     * @return true if the sequence moved, false on timeout
+     */
+    bool wait(int slot, std::uint32_t seen, std::chrono::milliseconds timeout) const;
+
+private:
+    void* m_mapping;                                     ///< Start of the mapping
+};
+
+} // namespace TradingTimeCounter
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief Lock-free bounded queue for many producers and one consumer
+ *
+ * A power-of-two ring of cells, each with a sequence number that says
+ * whether it is free for the producer at a position or holds the value
+ * for the consumer at it. Producers claim a position with one CAS on the
+ * tail; the consumer owns the head outright. Nothing allocates after
+ * construction, and a full mailbox is reported instead of blocking.
+ *
+ * @tparam T Value type (copy- or move-assignable, default-constructible)
+ */
+template <typename T>
+class BoundedMailbox {
+public:
+    /**
+     * @brief Constructor
+     * @param capacity Number of cells (rounded up to a power of two)
+     */
+    explicit BoundedMailbox(std::size_t capacity)
+        : m_mask(roundUpToPowerOfTwo(capacity) - 1)
+        , m_cells(std::make_unique<Cell[]>(m_mask + 1))
+        , m_tail(0)
+        , m_head(0) {
+        for (std::size_t i = 0; i <= m_mask; ++i) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // Disable copy constructor and assignment operator
+    BoundedMailbox(const BoundedMailbox&) = delete;
+    BoundedMailbox& operator=(const BoundedMailbox&) = delete;
+
+    /**
+     * @brief Enqueue a value (any thread)
+     * @param value Value to enqueue
+     * @return true if enqueued, false if the mailbox is full
+     */
+    bool push(T value) {
+        std::size_t position = m_tail.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &m_cells[position & m_mask];
+            std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+            if (difference == 0) {
+                if (m_tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (difference < 0) {
+                return false; // The consumer has not freed this cell yet
+            } else {
+                position = m_tail.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = std::move(value);
+        cell->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Dequeue the oldest value (consumer thread only)
+     * @param value Receives the value
+     * @return true if a value was dequeued, false if empty
+     */
+    bool pop(T& value) {
+        Cell& cell = m_cells[m_head & m_mask];
+        if (cell.sequence.load(std::memory_order_acquire) != m_head + 1) {
+            return false;
+        }
+        value = std::move(cell.value);
+        cell.sequence.store(m_head + m_mask + 1, std::memory_order_release);
+        ++m_head;
+        return true;
+    }
+
+    /**
+     * @brief Check if a value is ready for the consumer (consumer thread only)
+     * @return true if empty, false otherwise
+     */
+    bool isEmpty() const {
+        return m_cells[m_head & m_mask].sequence.load(std::memory_order_acquire) != m_head + 1;
+    }
+
+    /**
+     * @brief Get the number of cells
+     * @return Capacity
+     */
+    std::size_t getCapacity() const { return m_mask + 1; }
+
+private:
+    /**
+     * @brief One ring entry
+     */
+    struct Cell {
+        std::atomic<std::size_t> sequence;               ///< Position this cell is free (== pos) or full (== pos + 1) for
+        T value;                                         ///< Stored value
+    };
+
+    static std::size_t roundUpToPowerOfTwo(std::size_t value) {
+        std::size_t power = 2;
+        while (power < value) {
+            power <<= 1;
+        }
+        return power;
+    }
+
+    const std::size_t m_mask;                            ///< Capacity - 1
+    std::unique_ptr<Cell[]> m_cells;                     ///< Ring storage
+    alignas(64) std::atomic<std::size_t> m_tail;         ///< Next position to claim (producers)
+    alignas(64) std::size_t m_head;                      ///< Next position to consume (consumer)
+};
+
+} // namespace TradingTimeCounter
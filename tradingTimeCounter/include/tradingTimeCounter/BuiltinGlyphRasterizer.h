@@ -0,0 +1,23 @@
+#pragma once
+
+#include "IGlyphRasterizer.h"
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief Portable rasteriser for the countdown's character set
+ *
+ * Serves '0'-'9', ':', '-', '.', space, letters and '/' from the built-in
+ * GlyphAtlas font, scaled to the configured font size. Needs no platform
+ * font engine, so rendering can run and be verified on any platform.
+ */
+class BuiltinGlyphRasterizer : public IGlyphRasterizer {
+public:
+    /// DisplayConfig::fontFamily value that selects this rasteriser
+    static constexpr const char* FONT_FAMILY = "builtin";
+
+    // IGlyphRasterizer interface implementation
+    bool rasterize(const DisplayConfig& config, char ch, GlyphBitmap& glyph) override;
+};
+
+} // namespace TradingTimeCounter
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "CountdownTimer.h"
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief Kind of wall-clock discontinuity detected by ClockWatcher
+ */
+enum class ClockDiscontinuity {
+    WallClockSet,       ///< Wall clock was stepped (NTP step, manual change)
+    SystemResume        ///< System resumed from suspend
+};
+
+/**
+ * @brief Detects wall-clock jumps and suspend/resume and resyncs timers
+ *
+ * On Linux a CLOCK_REALTIME timerfd armed with TFD_TIMER_CANCEL_ON_SET wakes
+ * the watcher the moment the wall clock is set, and the gap between
+ * CLOCK_BOOTTIME and CLOCK_MONOTONIC reveals time spent suspended. Other
+ * platforms fall back to comparing wall-clock and steady-clock progress.
+ * Every registered timer is resynced once per detected discontinuity.
+ */
+class ClockWatcher {
+public:
+    /**
+     * @brief Constructor
+     */
+    ClockWatcher();
+
+    /**
+     * @brief Destructor - stops the watcher thread
+     */
+    ~ClockWatcher();
+
+    // Disable copy constructor and assignment operator
+    ClockWatcher(const ClockWatcher&) = delete;
+    ClockWatcher& operator=(const ClockWatcher&) = delete;
+
+    /**
+     * @brief Register a timer to be resynced on discontinuities
+     * @param timer Timer to register (must outlive its registration)
+     */
+    void addTimer(CountdownTimer* timer);
+
+    /**
+     * @brief Unregister a previously registered timer
+     * @param timer Timer to unregister
+     */
+    void removeTimer(CountdownTimer* timer);
+
+    /**
+     * @brief Start watching for discontinuities
+     * @return true if the watcher is running, false otherwise
+     */
+    bool start();
+
+    /**
+     * @brief Stop watching and join the watcher thread
+     */
+    void stop();
+
+    /**
+     * @brief Check if watcher is currently running
+     * @return true if running, false otherwise
+     */
+    bool isRunning() const;
+
+    /**
+     * @brief Set the minimum clock gap treated as a discontinuity
+     * @param threshold Gap threshold (default: 500 ms)
+     */
+    void setJumpThreshold(std::chrono::milliseconds threshold);
+
+    /**
+     * @brief Get the number of discontinuities handled so far
+     * @return Discontinuity count
+     */
+    std::uint64_t getDiscontinuityCount() const;
+
+    /**
+     * @brief Resync every registered timer
+     * @param reason Kind of discontinuity that triggered the resync
+     * @return Number of timers whose deadlines were recomputed
+     */
+    std::size_t resyncAll(ClockDiscontinuity reason);
+
+private:
+    /**
+     * @brief Watcher thread function
+     */
+    void watchThreadFunction();
+
+    /**
+     * @brief Sample the offset between the wall/boot clock and the steady clock
+     * @return Offset in nanoseconds
+     */
+    std::int64_t sampleClockOffset() const;
+
+#ifdef __linux__
+    /**
+     * @brief Arm the cancel-on-set CLOCK_REALTIME timer far in the future
+     * @return true if successful, false otherwise
+     */
+    bool armWallClockTimer();
+#endif
+
+private:
+    std::mutex m_timersMutex;                            ///< Protects m_timers
+    std::vector<CountdownTimer*> m_timers;               ///< Registered timers
+
+    std::atomic<bool> m_isRunning;                       ///< Running state flag
+    std::atomic<bool> m_shouldStop;                      ///< Stop request flag
+    std::atomic<std::uint64_t> m_discontinuityCount;     ///< Handled discontinuities
+    std::chrono::milliseconds m_jumpThreshold;           ///< Minimum gap treated as a jump
+    std::unique_ptr<std::thread> m_watchThread;          ///< Watcher execution thread
+
+#ifdef __linux__
+    int m_wallClockFd;                                   ///< CLOCK_REALTIME timerfd
+    int m_wakeFd;                                        ///< eventfd used to wake the watcher on stop
+#else
+    std::mutex m_wakeMutex;                              ///< Protects the stop wait
+    std::condition_variable m_wakeCondition;             ///< Signalled on stop
+#endif
+};
+
+} // namespace TradingTimeCounter
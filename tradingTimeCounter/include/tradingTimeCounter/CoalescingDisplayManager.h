@@ -0,0 +1,150 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "IDisplayManager.h"
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief Update counters of a CoalescingDisplayManager
+ */
+struct DisplayUpdateStats {
+    std::uint64_t textUpdates = 0;       ///< updateText() and updateDashboard() calls received
+    std::uint64_t configUpdates = 0;     ///< updateConfig() calls received
+    std::uint64_t styleUpdates = 0;      ///< selectStyle() calls received
+    std::uint64_t presents = 0;          ///< Updates forwarded to the backend
+    std::uint64_t droppedDuplicates = 0; ///< Updates identical to the latest state
+    std::uint64_t coalesced = 0;         ///< Updates superseded within one frame interval
+    std::uint64_t suppressedHidden = 0;  ///< Updates received while hidden
+    std::uint64_t flushWakeups = 0;      ///< Flush thread wakeups
+};
+
+/**
+ * @brief IDisplayManager decorator that forwards only updates that change the screen
+ *
+ * Wraps any backend and:
+ * - drops texts, configurations and style selections identical to the
+ *   latest state;
+ * - presents at most once per frame interval, keeping only the latest
+ *   update of a burst and flushing it from a helper thread at the end of
+ *   the interval;
+ * - forwards nothing while hidden and replays only the latest text (or
+ *   dashboard) and configuration on show().
+ * Timers are unaffected; only presentation is deferred. Text, config and
+ * visibility changes are serialised by an internal mutex; queries,
+ * position and callback setters are forwarded directly.
+ */
+class CoalescingDisplayManager : public IDisplayManager {
+public:
+    /**
+     * @brief Default minimum spacing between presents (60 Hz)
+     */
+    static const int DEFAULT_FRAME_INTERVAL_MS = 16;
+
+    /**
+     * @brief Constructor
+     * @param backend Display backend to wrap
+     * @param frameInterval Minimum spacing between presents
+     */
+    explicit CoalescingDisplayManager(std::unique_ptr<IDisplayManager> backend,
+                                      std::chrono::milliseconds frameInterval = std::chrono::milliseconds(DEFAULT_FRAME_INTERVAL_MS));
+
+    /**
+     * @brief Destructor
+     */
+    ~CoalescingDisplayManager() override;
+
+    // Disable copy constructor and assignment operator
+    CoalescingDisplayManager(const CoalescingDisplayManager&) = delete;
+    CoalescingDisplayManager& operator=(const CoalescingDisplayManager&) = delete;
+
+    // IDisplayManager interface implementation
+    bool initialize(const DisplayConfig& config) override;
+    void show() override;
+    void hide() override;
+    void updateText(const std::string& text) override;
+    void prewarmTexts(const std::vector<std::string>& texts) override;
+    bool updateDashboard(const std::vector<DashboardRow>& rows) override;
+    void updateConfig(const DisplayConfig& config) override;
+    bool setStyles(const std::vector<DisplayStyle>& styles) override;
+    void selectStyle(std::size_t index) override;
+    void setPositionLocked(bool locked) override;
+    void getPosition(int& x, int& y) const override;
+    void setPosition(int x, int y) override;
+    bool isVisible() const override;
+    void destroy() override;
+    void setCloseCallback(std::function<void()> callback) override;
+    void setPositionChangeCallback(std::function<void(int, int)> callback) override;
+
+    /**
+     * @brief Get update counters
+     * @return Snapshot of the statistics
+     */
+    DisplayUpdateStats getStats() const;
+
+    /**
+     * @brief Get the wrapped backend
+     * @return Backend display manager
+     */
+    IDisplayManager* getBackend() const;
+
+private:
+    /**
+     * @brief Flush thread function
+     */
+    void flushThreadFunction();
+
+    /**
+     * @brief Stop and join the flush thread
+     */
+    void stopFlushThread();
+
+    /**
+     * @brief Forward pending configuration, text and dashboard to the backend (caller holds m_mutex)
+     */
+    void flushLocked();
+
+    /**
+     * @brief Check whether the backend may be presented to now (caller holds m_mutex)
+     */
+    bool canPresentLocked(std::chrono::steady_clock::time_point now) const;
+
+    /**
+     * @brief Compare every field of two configurations
+     */
+    static bool sameConfig(const DisplayConfig& a, const DisplayConfig& b);
+
+private:
+    std::unique_ptr<IDisplayManager> m_backend;          ///< Wrapped display backend
+    std::chrono::milliseconds m_frameInterval;           ///< Minimum spacing between presents
+
+    mutable std::mutex m_mutex;                          ///< Serialises backend calls and state
+    std::condition_variable m_flushCondition;            ///< Signalled on pending updates, show and stop
+    std::string m_backendText;                           ///< Text last forwarded to the backend
+    std::string m_pendingText;                           ///< Latest text not yet forwarded
+    bool m_hasPendingText;                               ///< m_pendingText is valid
+    DisplayConfig m_backendConfig;                       ///< Configuration last forwarded to the backend
+    DisplayConfig m_pendingConfig;                       ///< Latest configuration not yet forwarded
+    bool m_hasPendingConfig;                             ///< m_pendingConfig is valid
+    
+    std::size_t m_backendStyle;                          ///< Style last selected on the backend
+    std::size_t m_pendingStyle;                          ///< Latest style selection not yet forwarded
+    bool m_hasPendingStyle;                              ///< m_pendingStyle is valid
+    std::vector<DashboardRow> m_backendRows;             ///< Dashboard last forwarded to the backend
+    std::vector<DashboardRow> m_pendingRows;             ///< Latest dashboard not yet forwarded
+    bool m_hasPendingRows;                               ///< m_pendingRows is valid
+    bool m_showingDashboard;                             ///< Backend shows the dashboard, not the text
+    std::chrono::steady_clock::time_point m_lastPresent; ///< Time of the last forwarded update
+    DisplayUpdateStats m_stats;                          ///< Update counters
+
+    bool m_shouldStop;                                   ///< Stop request flag (guarded by m_mutex)
+    std::unique_ptr<std::thread> m_flushThread;          ///< Flush execution thread
+};
+
+} // namespace TradingTimeCounter
@@ -4,15 +4,116 @@
 #include <atomic>
 #include <thread>
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include "AlertPlan.h"
 #include "ITimerCallback.h"
+#include "IReferenceClock.h"
+#include "IExecutor.h"
 
 namespace TradingTimeCounter {
 
+/**
+ * @brief Lifecycle state of a CountdownTimer
+ */
+enum class CountdownState : std::uint8_t {
+    Stopped,            ///< Not started, stopped or reset
+    Running,            ///< Counting down
+    Completed           ///< Free-running countdown reached zero
+};
+
+/**
+ * @brief Consistent view of a CountdownTimer's state
+ *
+ * All fields come from one atomic word, so they always belong together.
+ */
+struct CountdownSnapshot {
+    std::uint32_t remainingMs = 0;                       ///< Milliseconds remaining (rounded up)
+    CountdownState state = CountdownState::Stopped;      ///< Lifecycle state
+    std::uint32_t generation = 0;                        ///< Bumped on every transition (24-bit, wraps)
+    
+    /**
+     * @brief Get whole seconds remaining, rounded up as displayed
+     * @return Remaining seconds
+     */
+    int getRemainingSeconds() const { return static_cast<int>((remainingMs + 999) / 1000); }
+    
+    /**
+     * @brief Check if the timer was running
+     * @return true if running, false otherwise
+     */
+    bool isRunning() const { return state == CountdownState::Running; }
+};
+
+/**
+ * @brief Unit a countdown is displayed in
+ */
+enum class DisplayPrecision : std::uint8_t {
+    Minutes,            ///< HH:MM
+    Seconds,            ///< MM:SS
+    Tenths              ///< SS.t
+};
+
+/**
+ * @brief Which display precision applies at which remaining time
+ *
+ * Remaining time is shown rounded up to the active unit, so the text only
+ * changes when the remaining time crosses a multiple of that unit or a
+ * precision threshold. The timer sleeps until exactly that instant.
+ */
+struct DisplayPrecisionPolicy {
+    std::uint32_t minutesAboveMs = 0xFFFFFFFF;           ///< HH:MM while more than this remains (max = never)
+    std::uint32_t tenthsAtOrBelowMs = 0;                 ///< SS.t once at most this remains (0 = never)
+    
+    /**
+     * @brief Always MM:SS, one wakeup per second (default)
+     * @return Policy
+     */
+    static DisplayPrecisionPolicy fixedSeconds();
+    
+    /**
+     * @brief HH:MM above an hour, MM:SS below, SS.t in the final 10 seconds
+     * @return Policy
+     */
+    static DisplayPrecisionPolicy adaptive();
+    
+    /**
+     * @brief Get the precision shown at a remaining time
+     * @param remainingMs Milliseconds remaining
+     * @return Display precision
+     */
+    DisplayPrecision precisionAt(std::uint32_t remainingMs) const;
+    
+    /**
+     * @brief Get the remaining time at which the displayed text next changes
+     * @param remainingMs Milliseconds remaining
+     * @return Remaining milliseconds at the next change (0 once at zero)
+     */
+    std::uint32_t nextChangeMs(std::uint32_t remainingMs) const;
+    
+    /**
+     * @brief Format a remaining time in the precision that applies to it
+     * @param remainingMs Milliseconds remaining
+     * @return Formatted string
+     */
+    std::string format(std::uint32_t remainingMs) const;
+};
+
 /**
  * @brief High-precision countdown timer with callback support
  * 
  * This class provides a thread-safe countdown timer that can be started,
  * stopped, and reset. It notifies registered callbacks of state changes.
+ * Remaining time, state and generation share one 64-bit atomic word that
+ * writers replace with a single atomic operation and readers take with
+ * one acquire load, so no reader sees a mix of two states.
+ *
+ * The timer thread sleeps until the displayed text next changes under the
+ * display-precision policy, or the next alert threshold is reached, rather
+ * than polling: about once a minute in HH:MM, once a second in MM:SS and
+ * ten times a second in SS.t.
  */
 class CountdownTimer {
 public:
@@ -37,6 +138,24 @@ public:
      */
     void setCallback(std::shared_ptr<ITimerCallback> callback);
     
+    /**
+     * @brief Set the executor that callback notifications are dispatched on
+     * 
+     * Must be called before start(). Notifications of one timer are posted
+     * with postOrdered() and so arrive in order. When unset, callbacks run
+     * directly on the timer thread.
+     * @param executor Dispatch executor, or nullptr to call directly
+     */
+    void setCallbackExecutor(std::shared_ptr<IExecutor> executor);
+    
+    /**
+     * @brief Set the reference clock that wall-clock boundaries align to
+     * 
+     * Must be called before start(). When unset, the local system clock is used.
+     * @param clock Reference clock, or nullptr for the system clock
+     */
+    void setReferenceClock(std::shared_ptr<IReferenceClock> clock);
+    
     /**
      * @brief Start the countdown timer
      */
@@ -52,6 +171,15 @@ public:
      */
     void reset();
     
+    /**
+     * @brief Get remaining time, state and generation in one consistent read
+     * 
+     * While running, remaining time is measured from the deadline at the
+     * time of the call, so it stays current between the thread's wakeups.
+     * @return State snapshot
+     */
+    CountdownSnapshot getSnapshot() const;
+    
     /**
      * @brief Get remaining time in seconds
      * @return Number of seconds remaining
@@ -65,10 +193,115 @@ public:
     bool isRunning() const;
     
     /**
-     * @brief Get formatted time string (MM:SS)
-     * @return Formatted time string
+     * @brief Get formatted time string in the current display precision
+     * @return Formatted time string (HH:MM, MM:SS or SS.t)
      */
     std::string getFormattedTime() const;
+    
+    /**
+     * @brief Set which display precision applies at which remaining time
+     * 
+     * Takes effect at once; a running timer re-plans its next wakeup and
+     * sends an update.
+     * @param policy Display-precision policy
+     */
+    void setPrecisionPolicy(const DisplayPrecisionPolicy& policy);
+    
+    /**
+     * @brief Get the display-precision policy
+     * @return Display-precision policy
+     */
+    DisplayPrecisionPolicy getPrecisionPolicy() const;
+    
+    /**
+     * @brief Get the display precision at the current remaining time
+     * @return Display precision
+     */
+    DisplayPrecision getDisplayPrecision() const;
+    
+    /**
+     * @brief Set the staged pre-warnings of this countdown
+     * 
+     * Must be called before start(). The timer thread wakes exactly at
+     * each stage threshold and reports stage changes through
+     * ITimerCallback::onTimerAlert; in a flashing stage it also wakes at
+     * each toggle and reports it through ITimerCallback::onTimerFlash.
+     * @param plan Alert plan (empty for none)
+     */
+    void setAlertPlan(const AlertPlan& plan);
+    
+    /**
+     * @brief Get the staged pre-warnings of this countdown
+     * @return Alert plan
+     */
+    const AlertPlan& getAlertPlan() const;
+    
+    /**
+     * @brief Get the alert stage at the current remaining time
+     * @return Stage index into the plan, -1 if none is active
+     */
+    int getAlertStage() const;
+    
+    /**
+     * @brief Get the number of times the timer thread has woken up
+     * @return Wakeups since construction
+     */
+    std::uint64_t getWakeupCount() const;
+    
+    /**
+     * @brief Align the countdown to wall-clock boundaries
+     * 
+     * When enabled, the timer counts down to the next wall-clock multiple of
+     * its duration (e.g. the next 5-minute bar close) and re-arms for the
+     * following boundary on completion instead of stopping.
+     * @param aligned true to align to wall-clock boundaries
+     */
+    void setWallClockAligned(bool aligned);
+    
+    /**
+     * @brief Check if timer is aligned to wall-clock boundaries
+     * @return true if aligned, false for a free-running countdown
+     */
+    bool isWallClockAligned() const;
+    
+    /**
+     * @brief Recompute the deadline from the current wall clock
+     * 
+     * Called after a wall-clock discontinuity (clock step, suspend/resume).
+     * Has no effect on stopped or free-running timers, whose steady-clock
+     * deadlines are unaffected by wall-clock changes.
+     * @return true if the deadline was recomputed, false otherwise
+     */
+    bool resync();
+    
+    /**
+     * @brief Get the wall-clock instant a running countdown reaches zero
+     * 
+     * Aligned timers report the targeted boundary, free-running timers
+     * their steady-clock deadline mapped through the current reference time.
+     * @return Nanoseconds since epoch on the reference clock, 0 if not running
+     */
+    std::int64_t getDeadlineNs() const;
+    
+    /**
+     * @brief Set the remaining time of a stopped timer (e.g. from persisted state)
+     * 
+     * The next start() counts down from it.
+     * @param remainingMs Milliseconds remaining
+     * @return true if restored, false if the timer is running
+     */
+    bool restoreRemaining(std::uint32_t remainingMs);
+    
+    /**
+     * @brief Set the remaining time of a stopped timer from a wall-clock deadline
+     * 
+     * Lets a countdown persisted while running continue after a restart
+     * where the wall clock says it should be; a deadline that passed
+     * leaves zero remaining, so start() completes at once.
+     * @param deadlineNs Deadline in nanoseconds since epoch on the reference clock
+     * @return true if restored, false if the timer is running
+     */
+    bool restoreDeadline(std::int64_t deadlineNs);
 
 private:
     /**
@@ -77,19 +310,88 @@ private:
     void timerThreadFunction();
     
     /**
-     * @brief Format seconds to MM:SS string
-     * @param seconds Number of seconds
-     * @return Formatted string
+     * @brief Arm the steady-clock deadline for the first wall-clock boundary after now
+     */
+    void armAlignedDeadline();
+    
+    /**
+     * @brief Complete the current wall-clock boundary and arm the following one
+     * 
+     * Decided under the lock armAlignedDeadline() takes, so a concurrent
+     * resync() either re-arms first (and nothing is due any more) or after.
+     * @param completedBoundaryNs Receives the completed boundary
+     * @return true if the boundary was due and the next one is armed
+     */
+    bool advanceAlignedDeadline(std::int64_t& completedBoundaryNs);
+    
+    /**
+     * @brief Replace the boundary and its steady-clock deadline (caller holds m_armMutex)
+     * 
+     * The boundary is mapped to the steady clock through the current
+     * reference time, so each re-arm applies the latest clock estimate.
+     * @param boundaryNs Wall-clock boundary in ns since epoch
+     */
+    void setAlignedDeadline(std::int64_t boundaryNs);
+    
+    /**
+     * @brief Get the current reference time
+     * @return Nanoseconds since epoch on the reference clock
+     */
+    std::int64_t referenceNowNs() const;
+    
+    /**
+     * @brief Compute milliseconds remaining until the current deadline
+     * @param now Current steady-clock time
+     * @return Remaining milliseconds, rounded up and clamped at zero
+     */
+    std::uint32_t millisecondsUntilDeadline(std::chrono::steady_clock::time_point now) const;
+    
+    /**
+     * @brief Bring a running snapshot's remaining time up to the current time
+     * @param snapshot Snapshot taken from the state word
+     * @return Snapshot with live remaining time if running, unchanged otherwise
+     */
+    CountdownSnapshot refreshRemaining(CountdownSnapshot snapshot) const;
+    
+    /**
+     * @brief Wake the timer thread early to re-plan its next wakeup
      */
-    std::string formatTime(int seconds) const;
+    void requestWakeup();
+    
+    /**
+     * @brief Replace the state word unless the timer was stopped meanwhile
+     * @param remainingMs Milliseconds remaining
+     * @param state New state
+     * @param nextGeneration true to start a new generation
+     * @return true if published, false if the timer is no longer running
+     */
+    bool publishRunning(std::uint32_t remainingMs, CountdownState state, bool nextGeneration);
+    
+    /**
+     * @brief Deliver a notification to the callback, directly or via the executor
+     * @param event Callable invoked with the callback
+     */
+    template <typename Event>
+    void notify(Event event);
 
 private:
     const int m_totalDuration;                           ///< Total timer duration in seconds
-    std::atomic<int> m_remainingSeconds;                 ///< Remaining seconds (atomic for thread safety)
-    std::atomic<bool> m_isRunning;                       ///< Running state flag
-    std::atomic<bool> m_shouldStop;                      ///< Stop request flag
+    std::atomic<std::uint64_t> m_state;                  ///< Packed remaining ms, state and generation
+    std::atomic<bool> m_wallClockAligned;                ///< Align to wall-clock boundaries
+    std::atomic<std::chrono::steady_clock::rep> m_deadline; ///< Steady-clock deadline (clock ticks)
+    std::atomic<std::int64_t> m_boundary;                ///< Targeted wall-clock boundary (ns since epoch)
+    std::mutex m_armMutex;                               ///< Serialises re-arms of m_boundary and m_deadline
+    std::atomic<std::uint64_t> m_precisionPolicy;        ///< Packed minutes (high) and tenths (low) thresholds
+    std::atomic<std::uint64_t> m_wakeups;                ///< Timer thread wakeups
+    AlertPlan m_alertPlan;                               ///< Staged pre-warnings (set before start())
+    
+    std::mutex m_wakeMutex;                              ///< Guards m_wakeRequested
+    std::condition_variable m_wakeCondition;             ///< Timer thread sleeps on this until the next change
+    bool m_wakeRequested;                                ///< Re-plan requested (resync, policy change)
     
     std::shared_ptr<ITimerCallback> m_callback;          ///< Timer callback interface
+    std::shared_ptr<IReferenceClock> m_referenceClock;   ///< Reference wall clock (nullptr = system clock)
+    std::shared_ptr<IExecutor> m_callbackExecutor;       ///< Callback dispatch (nullptr = timer thread)
     std::unique_ptr<std::thread> m_timerThread;          ///< Timer execution thread
 };
 
@@ -0,0 +1,53 @@
+#pragma once
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief Instruction set used by SIMD kernels
+ */
+enum class SimdLevel {
+    Scalar,             ///< Portable fallback
+    SSE2,               ///< 128-bit vectors
+    AVX2                ///< 256-bit vectors
+};
+
+/**
+ * @brief Get the best SIMD level supported by this CPU (detected once)
+ * @return Supported SIMD level
+ */
+SimdLevel getSimdLevel();
+
+/**
+ * @brief Clamp a requested SIMD level to what this CPU supports
+ * @param requested Requested level
+ * @return requested if supported, Scalar otherwise
+ */
+SimdLevel clampSimdLevel(SimdLevel requested);
+
+/**
+ * @brief Check if the CPU has an invariant TSC (constant rate in all power states)
+ * @return true if the time-stamp counter can serve as a clock, false otherwise
+ */
+bool hasInvariantTsc();
+
+/**
+ * @brief Get a printable name for a SIMD level
+ * @param level SIMD level
+ * @return Level name
+ */
+const char* getSimdLevelName(SimdLevel level);
+
+} // namespace TradingTimeCounter
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define TTC_SIMD_X86 1
+#endif
+
+// Per-function target attributes let SIMD kernels live in portable translation units
+#if defined(__GNUC__) || defined(__clang__)
+#define TTC_TARGET_SSE2 __attribute__((target("sse2")))
+#define TTC_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define TTC_TARGET_SSE2
+#define TTC_TARGET_AVX2
+#endif
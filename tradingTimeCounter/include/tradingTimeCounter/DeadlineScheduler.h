@@ -0,0 +1,137 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "IExecutor.h"
+#include "IReferenceClock.h"
+#include "TimerTable.h"
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief One-shot wakeups at reference-clock instants for many waiters
+ *
+ * Waiters are one-shot entries in a TimerTable plus a task and the
+ * executor to post it to, so thousands of pending wakeups share a single
+ * thread, and waiters due together reach each executor as one postBatch().
+ * Deadlines are on the reference clock (ns since Unix epoch), as bar
+ * boundaries are; the thread sleeps until the earliest one, measured
+ * against the reference clock at the time of sleeping. With a manually
+ * advanced clock (VirtualClock) do not start the thread and call runDue()
+ * after each advance instead.
+ */
+class DeadlineScheduler {
+public:
+    /**
+     * @brief Constructor
+     * @param clock Reference clock, or nullptr for the system clock
+     */
+    explicit DeadlineScheduler(std::shared_ptr<IReferenceClock> clock = nullptr);
+    
+    /**
+     * @brief Destructor - stops the scheduler thread
+     */
+    ~DeadlineScheduler();
+    
+    // Disable copy constructor and assignment operator
+    DeadlineScheduler(const DeadlineScheduler&) = delete;
+    DeadlineScheduler& operator=(const DeadlineScheduler&) = delete;
+    
+    /**
+     * @brief Post a task to an executor once the reference clock reaches a deadline
+     * 
+     * Safe to call from any thread, including from scheduled tasks.
+     * @param deadlineNs Reference time in ns since Unix epoch
+     * @param executor Executor to post the task to (must outlive the wakeup)
+     * @param task Work to run
+     */
+    void schedule(std::int64_t deadlineNs, IExecutor& executor, std::function<void()> task);
+    
+    /**
+     * @brief Post every task whose deadline has been reached
+     * @param nowNs Current reference time in ns since Unix epoch
+     * @return Number of tasks posted
+     */
+    std::size_t runDue(std::int64_t nowNs);
+    
+    /**
+     * @brief Start the scheduler thread
+     */
+    void start();
+    
+    /**
+     * @brief Stop and join the scheduler thread
+     * 
+     * Pending tasks stay queued and run after a later start() or runDue().
+     */
+    void stop();
+    
+    /**
+     * @brief Check if the scheduler thread is running
+     * @return true if running, false otherwise
+     */
+    bool isRunning() const;
+    
+    /**
+     * @brief Get the current reference time
+     * @return Nanoseconds since Unix epoch on the reference clock
+     */
+    std::int64_t nowNs() const;
+    
+    /**
+     * @brief Get the number of pending wakeups
+     * @return Pending count
+     */
+    std::size_t getPendingCount() const;
+
+private:
+    /**
+     * @brief Pending task and where to run it
+     */
+    struct Waiter {
+        IExecutor* executor;                             ///< Executor to post to
+        std::function<void()> task;                      ///< Work to run
+    };
+    
+    /**
+     * @brief Scheduler thread function
+     */
+    void schedulerThreadFunction();
+    
+    /**
+     * @brief Take the due waiters out of the table (caller holds m_mutex)
+     * @param nowNs Current reference time
+     * @param due Receives the due waiters
+     */
+    void collectDueLocked(std::int64_t nowNs, std::vector<Waiter>& due);
+    
+    /**
+     * @brief Post due waiters to their executors (without m_mutex held)
+     * @param due Waiters in deadline order
+     */
+    void postDue(std::vector<Waiter>& due);
+
+private:
+    std::shared_ptr<IReferenceClock> m_clock;            ///< Reference clock (nullptr = system clock)
+    
+    mutable std::mutex m_mutex;                          ///< Protects the table and waiters
+    std::condition_variable m_wakeCondition;             ///< Signalled on earlier deadline or stop
+    TimerTable m_table;                                  ///< One-shot deadline per waiter
+    std::vector<Waiter> m_waiters;                       ///< Waiters indexed by subscriber id
+    std::vector<std::uint32_t> m_freeWaiters;            ///< Reusable waiter slots
+    std::vector<ExpiredTimer> m_expired;                 ///< Reused expiry output
+    std::int64_t m_nextDeadline;                         ///< Earliest pending deadline (NEVER if none)
+    
+    std::atomic<bool> m_isRunning;                       ///< Running state flag
+    bool m_shouldStop;                                   ///< Stop request flag (guarded by m_mutex)
+    std::unique_ptr<std::thread> m_schedulerThread;      ///< Scheduler execution thread
+};
+
+} // namespace TradingTimeCounter
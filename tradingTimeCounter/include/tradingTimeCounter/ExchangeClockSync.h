@@ -0,0 +1,158 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "IReferenceClock.h"
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief Offset/drift estimate of the exchange clock against the local clock
+ */
+struct ClockOffsetEstimate {
+    std::int64_t offsetNs = 0;          ///< Exchange minus local time at lastLocalNs
+    double drift = 0.0;                 ///< Offset change per local nanosecond
+    std::int64_t lastLocalNs = 0;       ///< Local time of the last accepted sample
+    bool isSynchronised = false;        ///< At least one sample accepted
+};
+
+/**
+ * @brief Reference clock that tracks the exchange's time from a timestamp feed
+ *
+ * Receives fixed-layout timestamp messages (see TimestampMessage.h) over UDP
+ * on loopback or a Unix datagram socket, parses them in place and feeds an
+ * alpha-beta filter that estimates the exchange clock's offset and drift
+ * against the local system clock. Countdown timers that use this as their
+ * IReferenceClock align their deadlines to exchange time.
+ *
+ * The estimate includes the feed's mean one-way latency; subtract a known
+ * latency with setLatencyCompensation() if required.
+ */
+class ExchangeClockSync : public IReferenceClock {
+public:
+    /**
+     * @brief Constructor
+     */
+    ExchangeClockSync();
+
+    /**
+     * @brief Destructor - stops the receive thread and closes the socket
+     */
+    ~ExchangeClockSync() override;
+
+    // Disable copy constructor and assignment operator
+    ExchangeClockSync(const ExchangeClockSync&) = delete;
+    ExchangeClockSync& operator=(const ExchangeClockSync&) = delete;
+
+    /**
+     * @brief Bind a UDP socket on the loopback interface
+     * @param port UDP port to listen on
+     * @return true if successful, false otherwise
+     */
+    bool openUdp(std::uint16_t port);
+
+    /**
+     * @brief Bind a Unix datagram socket
+     * @param path Filesystem path of the socket (replaced if it exists)
+     * @return true if successful, false otherwise
+     */
+    bool openUnixSocket(const std::string& path);
+
+    /**
+     * @brief Start receiving on the opened socket
+     * @return true if the receive thread is running, false otherwise
+     */
+    bool start();
+
+    /**
+     * @brief Stop receiving and close the socket
+     */
+    void stop();
+
+    /**
+     * @brief Check if the receive thread is running
+     * @return true if running, false otherwise
+     */
+    bool isRunning() const;
+
+    /**
+     * @brief Parse one message and update the estimate
+     *
+     * Used by the receive thread; also callable directly to replay a feed
+     * offline without sockets.
+     * @param data Received bytes (parsed in place)
+     * @param length Number of received bytes
+     * @param localNs Local receive time in ns since Unix epoch
+     * @return true if the message was accepted, false if malformed or stale
+     */
+    bool processMessage(const unsigned char* data, std::size_t length, std::int64_t localNs);
+
+    /**
+     * @brief Set the alpha-beta filter gains
+     * @param alpha Offset gain in (0, 1] (default: 0.1)
+     * @param beta Drift gain in [0, 1) (default: 0.005)
+     */
+    void setFilterGains(double alpha, double beta);
+
+    /**
+     * @brief Set a known one-way feed latency to add back to the offset
+     * @param latencyNs Latency in nanoseconds
+     */
+    void setLatencyCompensation(std::int64_t latencyNs);
+
+    /**
+     * @brief Get a snapshot of the current estimate
+     * @return Offset/drift estimate
+     */
+    ClockOffsetEstimate getEstimate() const;
+
+    /**
+     * @brief Get the number of accepted messages
+     * @return Accepted message count
+     */
+    std::uint64_t getAcceptedCount() const;
+
+    /**
+     * @brief Get the number of rejected (malformed or stale) messages
+     * @return Rejected message count
+     */
+    std::uint64_t getRejectedCount() const;
+
+    // IReferenceClock interface implementation
+    std::chrono::system_clock::time_point now() const override;
+
+private:
+    /**
+     * @brief Receive thread function
+     */
+    void receiveThreadFunction();
+
+    /**
+     * @brief Close the socket and remove a bound Unix socket path
+     */
+    void closeSocket();
+
+private:
+    mutable std::mutex m_estimateMutex;                  ///< Protects the filter state
+    ClockOffsetEstimate m_estimate;                      ///< Current offset/drift estimate
+    std::uint64_t m_lastSequence;                        ///< Last accepted sequence number
+    double m_alpha;                                      ///< Offset filter gain
+    double m_beta;                                       ///< Drift filter gain
+    std::int64_t m_latencyCompensationNs;                ///< Known one-way latency
+
+    std::atomic<std::uint64_t> m_acceptedCount;          ///< Accepted messages
+    std::atomic<std::uint64_t> m_rejectedCount;          ///< Rejected messages
+
+    int m_socket;                                        ///< Bound datagram socket
+    int m_wakePipe[2];                                   ///< Self-pipe used to wake the receiver on stop
+    std::string m_unixPath;                              ///< Bound Unix socket path (if any)
+    std::atomic<bool> m_isRunning;                       ///< Running state flag
+    std::atomic<bool> m_shouldStop;                      ///< Stop request flag
+    std::unique_ptr<std::thread> m_receiveThread;        ///< Receive execution thread
+};
+
+} // namespace TradingTimeCounter
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Framebuffer.h"
+#include "IDisplayManager.h"
+
+namespace TradingTimeCounter {
+
+class SoftwareRenderer;
+
+/**
+ * @brief Frame cache counters
+ */
+struct FrameCacheStats {
+    std::uint64_t hits = 0;             ///< Lookups that found a frame
+    std::uint64_t misses = 0;           ///< Lookups that found nothing
+    std::uint64_t evictions = 0;        ///< Frames dropped to stay within budget
+    std::uint64_t prewarmed = 0;        ///< Frames rendered ahead of time
+    std::size_t entryCount = 0;         ///< Frames currently cached
+    std::size_t memoryBytes = 0;        ///< Memory held by cached frames
+    std::size_t memoryBudget = 0;       ///< Configured memory budget
+
+    /**
+     * @brief Get the fraction of lookups that hit
+     * @return Hit rate 0-1 (0 before any lookup)
+     */
+    double getHitRate() const {
+        std::uint64_t lookups = hits + misses;
+        return lookups ? static_cast<double>(hits) / lookups : 0.0;
+    }
+};
+
+/**
+ * @brief Bounded LRU cache of finished frames keyed by text and display config
+ *
+ * A countdown only ever shows a few thousand distinct strings, and each
+ * renders to the same pixels under the same configuration. Display
+ * backends look frames up here before rendering, so presenting a tick that
+ * was seen (or pre-warmed) before is a copy of finished pixels. Frames are
+ * shared immutably, so a frame handed out stays valid after eviction.
+ * Thread-safe.
+ */
+class FrameCache {
+public:
+    /**
+     * @brief Default memory budget (about a hundred 150x60 frames)
+     */
+    static const std::size_t DEFAULT_MEMORY_BUDGET = 4 * 1024 * 1024;
+
+    /**
+     * @brief Constructor
+     * @param memoryBudget Maximum bytes held by cached frames
+     */
+    explicit FrameCache(std::size_t memoryBudget = DEFAULT_MEMORY_BUDGET);
+
+    /**
+     * @brief Hash the parts of a display configuration that affect pixels
+     *
+     * Position, dragging and lock state are excluded.
+     * @param config Display configuration
+     * @return Configuration hash
+     */
+    static std::uint64_t hashConfig(const DisplayConfig& config);
+
+    /**
+     * @brief Look up a frame and mark it most recently used
+     * @param text Displayed text
+     * @param configHash Hash from hashConfig()
+     * @return Frame, nullptr on a miss
+     */
+    std::shared_ptr<const Framebuffer> find(const std::string& text, std::uint64_t configHash);
+
+    /**
+     * @brief Insert or replace a frame, evicting least recently used frames over budget
+     * @param text Displayed text
+     * @param configHash Hash from hashConfig()
+     * @param frame Finished frame
+     */
+    void insert(const std::string& text, std::uint64_t configHash, std::shared_ptr<const Framebuffer> frame);
+
+    /**
+     * @brief Render and cache frames that are not cached yet
+     *
+     * Meant for idle time between ticks. Leaves the renderer's framebuffer
+     * holding the last rendered text.
+     * @param renderer Configured renderer for configHash
+     * @param configHash Hash from hashConfig()
+     * @param texts Texts expected to be shown soon
+     * @return Number of frames rendered
+     */
+    std::size_t prewarm(SoftwareRenderer& renderer, std::uint64_t configHash, const std::vector<std::string>& texts);
+
+    /**
+     * @brief Drop every frame (counters are kept)
+     */
+    void clear();
+
+    /**
+     * @brief Change the memory budget, evicting as needed
+     * @param memoryBudget Maximum bytes held by cached frames
+     */
+    void setMemoryBudget(std::size_t memoryBudget);
+
+    /**
+     * @brief Get cache counters and memory use
+     * @return Snapshot of the statistics
+     */
+    FrameCacheStats getStats() const;
+
+private:
+    /**
+     * @brief Cache key
+     */
+    struct Key {
+        std::string text;
+        std::uint64_t configHash;
+
+        bool operator==(const Key& other) const { return configHash == other.configHash && text == other.text; }
+    };
+
+    struct KeyHash {
+        std::size_t operator()(const Key& key) const;
+    };
+
+    /**
+     * @brief Cached frame in LRU order
+     */
+    struct Entry {
+        Key key;
+        std::shared_ptr<const Framebuffer> frame;
+        std::size_t bytes;
+    };
+
+    /**
+     * @brief Check for a frame without touching counters or LRU order (caller holds m_mutex)
+     */
+    bool containsLocked(const Key& key) const;
+
+    /**
+     * @brief Evict least recently used frames until within budget (caller holds m_mutex)
+     */
+    void evictLocked();
+
+    /**
+     * @brief Estimate the memory a frame holds
+     */
+    static std::size_t frameBytes(const Key& key, const Framebuffer& frame);
+
+private:
+    mutable std::mutex m_mutex;                                          ///< Protects everything below
+    std::list<Entry> m_entries;                                          ///< Most recently used first
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> m_index; ///< Key -> entry
+    FrameCacheStats m_stats;                                             ///< Counters and memory use
+};
+
+} // namespace TradingTimeCounter
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "IDisplayManager.h"
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief Byte order of a 32-bit framebuffer pixel
+ */
+enum class PixelFormat {
+    RGBA8,              ///< R, G, B, A in memory order
+    BGRA8               ///< B, G, R, A in memory order (Windows DIB order)
+};
+
+/**
+ * @brief Axis-aligned pixel rectangle
+ */
+struct RenderRect {
+    int x = 0;
+    int y = 0;
+    int width = 0;
+    int height = 0;
+
+    /**
+     * @brief Check if the rectangle covers no pixels
+     * @return true if empty, false otherwise
+     */
+    bool isEmpty() const { return width <= 0 || height <= 0; }
+
+    /**
+     * @brief Grow to the bounding box of this and another rectangle
+     * @param other Rectangle to include
+     */
+    void unite(const RenderRect& other);
+};
+
+/**
+ * @brief In-memory premultiplied-alpha 32-bit framebuffer
+ *
+ * Rows are padded to a multiple of 8 pixels so SIMD kernels can process
+ * whole 32-byte blocks.
+ */
+class Framebuffer {
+public:
+    /**
+     * @brief Construct an empty framebuffer
+     * @param format Pixel byte order
+     */
+    explicit Framebuffer(PixelFormat format = PixelFormat::RGBA8);
+
+    /**
+     * @brief Resize the framebuffer (contents become undefined)
+     * @param width Width in pixels
+     * @param height Height in pixels
+     */
+    void resize(int width, int height);
+
+    /**
+     * @brief Fill a rectangle with a packed color
+     * @param rect Rectangle to fill (clipped to the framebuffer)
+     * @param color Packed premultiplied color
+     */
+    void fill(const RenderRect& rect, std::uint32_t color);
+
+    /**
+     * @brief Pack a color as premultiplied alpha in this framebuffer's format
+     * @param color RGB color
+     * @param alpha Alpha 0-255
+     * @return Packed pixel
+     */
+    std::uint32_t packColor(const DisplayConfig::Color& color, int alpha) const;
+
+    /**
+     * @brief Get a pointer to the first pixel of a row
+     * @param y Row index
+     * @return Row pointer
+     */
+    std::uint32_t* row(int y);
+    const std::uint32_t* row(int y) const;
+
+    int getWidth() const;
+    int getHeight() const;
+
+    /**
+     * @brief Get the distance between rows
+     * @return Row stride in pixels
+     */
+    int getStride() const;
+
+    PixelFormat getFormat() const;
+
+private:
+    std::vector<std::uint32_t> m_pixels;                 ///< Pixel storage, row-major
+    int m_width;                                         ///< Width in pixels
+    int m_height;                                        ///< Height in pixels
+    int m_stride;                                        ///< Row stride in pixels
+    PixelFormat m_format;                                ///< Pixel byte order
+};
+
+} // namespace TradingTimeCounter
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "IGlyphRasterizer.h"
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief Metrics and pixels of one pre-rasterised atlas face
+ *
+ * Every glyph of a face has the same cell size. Glyph rows are padded to
+ * rowStride bytes (a multiple of 16) and every glyph starts on a 64-byte
+ * boundary, so rows can be blitted with aligned vector loads.
+ */
+struct GlyphAtlasFace {
+    int fontSize;                        ///< Nominal font size the face is generated for
+    int scale;                           ///< Pixels per font-pattern dot
+    bool isBold;                         ///< Bold weight
+    int glyphWidth;                      ///< Cell width in pixels (also the advance)
+    int glyphHeight;                     ///< Cell height in pixels
+    int rowStride;                       ///< Bytes between glyph rows
+    int baseline;                        ///< Rows from cell top to the baseline
+    const std::uint8_t* pixels;          ///< Glyph coverage, glyph-major then row-major
+};
+
+/**
+ * @brief Compile-time generated atlas of the countdown's glyphs
+ *
+ * The built-in 5x7 font covers "0123456789:-. ", letters and '/'. The
+ * countdown glyphs (the first getAtlasGlyphCount() characters) are
+ * rasterised by constexpr code into read-only tables at a fixed set of
+ * sizes, in regular and bold weights; looking them up costs no font-engine
+ * call, measurement or rasterisation at runtime. Other sizes and the
+ * label characters are rasterised on demand by the same code, so both
+ * paths produce identical pixels.
+ */
+class GlyphAtlas {
+public:
+    /**
+     * @brief Get the characters the built-in font covers, in glyph index order
+     * @return Null-terminated character set
+     */
+    static const char* getCharacters();
+
+    /**
+     * @brief Get the number of leading glyphs stored in the atlas faces
+     * @return Pre-rasterised glyph count
+     */
+    static int getAtlasGlyphCount();
+
+    /**
+     * @brief Get the atlas index of a character
+     * @param ch Character
+     * @return Glyph index, -1 if the character is not in the font
+     */
+    static int getGlyphIndex(char ch);
+
+    /**
+     * @brief Find the pre-rasterised face for a font size and weight
+     * @param fontSize Requested font size
+     * @param bold Bold weight
+     * @return Face, nullptr if that size is not in the table
+     */
+    static const GlyphAtlasFace* findFace(int fontSize, bool bold);
+
+    /**
+     * @brief Get the number of pre-rasterised faces
+     * @return Face count
+     */
+    static std::size_t getFaceCount();
+
+    /**
+     * @brief Get a pre-rasterised face by position
+     * @param index Face index, below getFaceCount()
+     * @return Face
+     */
+    static const GlyphAtlasFace& getFace(std::size_t index);
+
+    /**
+     * @brief Get one row of a glyph
+     * @param face Face
+     * @param glyph Glyph index, below getAtlasGlyphCount()
+     * @param row Row within the cell
+     * @return Pointer to face.glyphWidth coverage bytes
+     */
+    static const std::uint8_t* glyphRow(const GlyphAtlasFace& face, int glyph, int row);
+
+    /**
+     * @brief Produce a glyph bitmap for any font size
+     *
+     * Copies rows from the table when the glyph and size are
+     * pre-rasterised and rasterises at runtime otherwise.
+     * @param fontSize Font size
+     * @param bold Bold weight
+     * @param ch Character
+     * @param glyph Receives the coverage mask
+     * @return true if the character is covered, false otherwise
+     */
+    static bool rasterize(int fontSize, bool bold, char ch, GlyphBitmap& glyph);
+};
+
+} // namespace TradingTimeCounter
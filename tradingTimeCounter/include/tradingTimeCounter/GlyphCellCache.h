@@ -0,0 +1,78 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "CpuFeatures.h"
+#include "Framebuffer.h"
+#include "IGlyphRasterizer.h"
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief Rasterised glyphs laid out in fixed-size character cells
+ *
+ * Built once per configuration: every character of a set is rasterised and
+ * centred in a cell as large as the largest glyph, so text lays out on a
+ * monospace grid and any cell can be redrawn on its own. Cell metrics are
+ * cached here, so layout never measures text.
+ */
+class GlyphCellCache {
+public:
+    /**
+     * @brief Construct an empty cache
+     */
+    GlyphCellCache();
+
+    /**
+     * @brief Rasterise a character set
+     * @param rasterizer Glyph source
+     * @param config Display configuration (font family, size, weight)
+     * @param characters Null-terminated characters to rasterise
+     * @return true if at least one glyph was produced, false otherwise
+     */
+    bool build(IGlyphRasterizer& rasterizer, const DisplayConfig& config, const char* characters);
+
+    /**
+     * @brief Drop every glyph
+     */
+    void clear();
+
+    /**
+     * @brief Check whether a character has a glyph
+     * @param ch Character
+     * @return true if rasterised, false otherwise (drawn blank)
+     */
+    bool contains(char ch) const;
+
+    int getCellWidth() const;
+    int getCellHeight() const;
+
+    /**
+     * @brief Fill one cell with the background and blend a character over it
+     * @param framebuffer Target (the cell is clipped to it)
+     * @param x Cell left edge
+     * @param y Cell top edge
+     * @param ch Character to draw
+     * @param background Packed premultiplied background
+     * @param foreground Packed premultiplied text color
+     * @param level Blending kernel
+     */
+    void drawCell(Framebuffer& framebuffer, int x, int y, char ch,
+                  std::uint32_t background, std::uint32_t foreground, SimdLevel level) const;
+
+private:
+    /**
+     * @brief Get the glyph index of a character
+     * @return Index into m_glyphs, -1 if blank
+     */
+    int glyphIndex(char ch) const;
+
+private:
+    std::vector<GlyphBitmap> m_glyphs;                   ///< Cell-sized coverage masks
+    std::array<int, 128> m_glyphIndex;                   ///< Character -> m_glyphs index (-1 = blank)
+    int m_cellWidth;                                     ///< Width of every character cell
+    int m_cellHeight;                                    ///< Height of every character cell
+};
+
+} // namespace TradingTimeCounter
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
+#include <vector>
 #include <functional>
 
 namespace TradingTimeCounter {
@@ -10,7 +12,7 @@ namespace TradingTimeCounter {
  */
 struct DisplayConfig {
     // Font settings
-    std::string fontFamily = "Arial";
+    std::string fontFamily = "Arial";    // "builtin" = compile-time glyph atlas, no font engine
     int fontSize = 24;
     bool isBold = true;
     
@@ -32,6 +34,57 @@ struct DisplayConfig {
     int opacity = 200;                   // 0-255, 200 = ~78% opacity
 };
 
+/**
+ * @brief Appearance variant of the configured display (e.g. an alert stage)
+ *
+ * Font family, size and window geometry come from the DisplayConfig;
+ * a style only overrides weight, colors and opacity.
+ */
+struct DisplayStyle {
+    bool isBold = true;
+    DisplayConfig::Color textColor{255, 255, 255};
+    DisplayConfig::Color backgroundColor{0, 0, 0};
+    int opacity = 200;                   // 0-255
+    
+    /**
+     * @brief Take the style of a configuration
+     * @param config Display configuration
+     * @return Its weight, colors and opacity
+     */
+    static DisplayStyle fromConfig(const DisplayConfig& config) {
+        DisplayStyle style;
+        style.isBold = config.isBold;
+        style.textColor = config.textColor;
+        style.backgroundColor = config.backgroundColor;
+        style.opacity = config.opacity;
+        return style;
+    }
+    
+    /**
+     * @brief Apply the style to a configuration
+     * @param config Display configuration
+     * @return Copy of config with this style's weight, colors and opacity
+     */
+    DisplayConfig applyTo(DisplayConfig config) const {
+        config.isBold = isBold;
+        config.textColor = textColor;
+        config.backgroundColor = backgroundColor;
+        config.opacity = opacity;
+        return config;
+    }
+};
+
+/**
+ * @brief One labelled countdown of a dashboard
+ */
+struct DashboardRow {
+    std::string label;                   // e.g. "ES 5m"
+    std::string value;                   // e.g. "02:13"
+    
+    bool operator==(const DashboardRow& other) const { return label == other.label && value == other.value; }
+    bool operator!=(const DashboardRow& other) const { return !(*this == other); }
+};
+
 /**
  * @brief Abstract interface for display management
  * 
@@ -65,12 +118,48 @@ public:
      */
     virtual void updateText(const std::string& text) = 0;
     
+    /**
+     * @brief Prepare texts that are about to be displayed (optional)
+     * 
+     * Called during idle time between updates; backends with a frame cache
+     * render these ahead so the matching updateText() only presents.
+     * @param texts Upcoming texts
+     */
+    virtual void prewarmTexts(const std::vector<std::string>& texts) { (void)texts; }
+    
+    /**
+     * @brief Show a list of labelled countdowns instead of a single text (optional)
+     * 
+     * The display shows whichever of updateText() and updateDashboard()
+     * was called last.
+     * @param rows Dashboard rows, top to bottom
+     * @return true if the backend supports dashboards, false otherwise
+     */
+    virtual bool updateDashboard(const std::vector<DashboardRow>& rows) { (void)rows; return false; }
+    
     /**
      * @brief Update display configuration
      * @param config New configuration
      */
     virtual void updateConfig(const DisplayConfig& config) = 0;
     
+    /**
+     * @brief Provide the styles the countdown text can switch between (optional)
+     * 
+     * Backends resolve every style (fonts, packed colors, glyphs) here and
+     * again on updateConfig(), so selectStyle() never rebuilds resources.
+     * Index 0 is selected afterwards.
+     * @param styles Style table
+     * @return true if the backend supports styles, false otherwise
+     */
+    virtual bool setStyles(const std::vector<DisplayStyle>& styles) { (void)styles; return false; }
+    
+    /**
+     * @brief Switch the countdown text to an entry of the style table (optional)
+     * @param index Index into the table given to setStyles(); out-of-range indices are ignored
+     */
+    virtual void selectStyle(std::size_t index) { (void)index; }
+    
     /**
      * @brief Set position lock state
      * @param locked true to lock position, false to allow dragging
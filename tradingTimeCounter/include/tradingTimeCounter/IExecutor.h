@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief Interface for running timer-event work on a chosen context
+ * 
+ * Lets the code that detects an event (a timer thread) hand the work it
+ * triggers to the thread or pool the subscriber wants it on.
+ */
+class IExecutor {
+public:
+    virtual ~IExecutor() = default;
+    
+    /**
+     * @brief Queue a task for execution
+     * 
+     * May run the task before returning. Must be safe to call from any thread.
+     * @param task Work to run
+     */
+    virtual void post(std::function<void()> task) = 0;
+    
+    /**
+     * @brief Queue a task that must run after earlier tasks with the same key
+     * 
+     * Used for the events of one timer, which subscribers expect in order.
+     * The default suits executors that run tasks one at a time in post
+     * order; executors that run tasks concurrently must override it.
+     * @param key Ordering key (e.g. the timer's address)
+     * @param task Work to run
+     */
+    virtual void postOrdered(std::uint64_t key, std::function<void()> task) {
+        (void)key;
+        post(std::move(task));
+    }
+    
+    /**
+     * @brief Queue many unordered tasks at once
+     * 
+     * Lets a pool hand off a whole boundary's expiries in one step instead
+     * of one queue operation per task. The vector is left empty.
+     * @param tasks Work to run
+     */
+    virtual void postBatch(std::vector<std::function<void()>>& tasks) {
+        for (std::function<void()>& task : tasks) {
+            post(std::move(task));
+        }
+        tasks.clear();
+    }
+};
+
+} // namespace TradingTimeCounter
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "IDisplayManager.h"
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief 8-bit coverage mask of one rasterised glyph
+ */
+struct GlyphBitmap {
+    int width = 0;                       ///< Width in pixels (also the advance)
+    int height = 0;                      ///< Height in pixels
+    std::vector<std::uint8_t> coverage;  ///< Row-major coverage, width * height bytes
+};
+
+/**
+ * @brief Interface for turning characters into coverage masks
+ * 
+ * Called only when the display configuration changes; the renderer caches
+ * the results and never touches a font engine per frame.
+ */
+class IGlyphRasterizer {
+public:
+    virtual ~IGlyphRasterizer() = default;
+    
+    /**
+     * @brief Rasterise one character for the given configuration
+     * @param config Display configuration (font family, size, weight)
+     * @param ch Character to rasterise
+     * @param glyph Receives the coverage mask
+     * @return true if the character is supported, false otherwise
+     */
+    virtual bool rasterize(const DisplayConfig& config, char ch, GlyphBitmap& glyph) = 0;
+};
+
+} // namespace TradingTimeCounter
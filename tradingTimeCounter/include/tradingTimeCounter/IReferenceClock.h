@@ -0,0 +1,25 @@
+#pragma once
+
+#include <chrono>
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief Interface for the reference wall clock that boundaries align to
+ * 
+ * The default reference is the local system clock. Implementations can
+ * substitute another time base, such as the exchange's clock estimated
+ * from a market-data feed.
+ */
+class IReferenceClock {
+public:
+    virtual ~IReferenceClock() = default;
+    
+    /**
+     * @brief Get the current reference time
+     * @return Reference time as a system_clock time point
+     */
+    virtual std::chrono::system_clock::time_point now() const = 0;
+};
+
+} // namespace TradingTimeCounter
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 namespace TradingTimeCounter {
 
 /**
@@ -13,8 +15,11 @@ public:
     virtual ~ITimerCallback() = default;
     
     /**
-     * @brief Called every second when timer updates
-     * @param remainingSeconds Number of seconds remaining
+     * @brief Called whenever the displayed text changes
+     * 
+     * Follows the timer's display-precision policy: once a second in MM:SS,
+     * once a minute in HH:MM and ten times a second in SS.t.
+     * @param remainingSeconds Number of seconds remaining (rounded up)
      */
     virtual void onTimerUpdate(int remainingSeconds) = 0;
     
@@ -23,6 +28,16 @@ public:
      */
     virtual void onTimerCompleted() = 0;
     
+    /**
+     * @brief Called with the instant a completion stands for, just before onTimerCompleted
+     * 
+     * For a wall-clock-aligned timer this is the bar close it counted down
+     * to on its reference clock, however late the notification is
+     * delivered; otherwise the reference time at which the countdown ran out.
+     * @param boundaryNs Boundary in ns since Unix epoch
+     */
+    virtual void onTimerBoundary(std::int64_t boundaryNs) { (void)boundaryNs; }
+    
     /**
      * @brief Called when timer is started
      */
@@ -32,6 +47,31 @@ public:
      * @brief Called when timer is stopped
      */
     virtual void onTimerStopped() = 0;
+    
+    /**
+     * @brief Called when the deadline was recomputed after a wall-clock jump
+     *        or a system suspend/resume
+     * @param remainingSeconds Number of seconds remaining after the resync
+     */
+    virtual void onTimerResync(int remainingSeconds) { (void)remainingSeconds; }
+    
+    /**
+     * @brief Called when the countdown enters another stage of its alert plan
+     * 
+     * Delivered before the update of the same wakeup, and again with -1
+     * when a re-armed countdown leaves its last stage.
+     * @param stage Stage index into the timer's AlertPlan, -1 for none
+     */
+    virtual void onTimerAlert(int stage) { (void)stage; }
+    
+    /**
+     * @brief Called when a flashing alert stage toggles its style
+     * 
+     * Delivered every AlertPlan::FLASH_PHASE_MS while a stage with
+     * AlertAction::Flash is active, starting right after its onTimerAlert.
+     * @param highlighted true to show the stage's style, false for the base style
+     */
+    virtual void onTimerFlash(bool highlighted) { (void)highlighted; }
 };
 
 } // namespace TradingTimeCounter
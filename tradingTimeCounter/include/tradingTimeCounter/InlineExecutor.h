@@ -0,0 +1,17 @@
+#pragma once
+
+#include "IExecutor.h"
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief Executor that runs each task immediately on the posting thread
+ */
+class InlineExecutor : public IExecutor {
+public:
+    // IExecutor interface implementation
+    void post(std::function<void()> task) override;
+    void postBatch(std::vector<std::function<void()>>& tasks) override;
+};
+
+} // namespace TradingTimeCounter
@@ -0,0 +1,209 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief Ordered stream of upcoming events (bar closes, session boundaries, scheduled releases, ...)
+ *
+ * A source is queried by time rather than iterated, so the aggregator can
+ * look ahead for top-K queries without disturbing it. Times are ns since
+ * the Unix epoch.
+ */
+class ICountdownSource {
+public:
+    /**
+     * @brief Time returned when the source has no further events
+     */
+    static const std::int64_t NEVER = std::numeric_limits<std::int64_t>::max();
+
+    virtual ~ICountdownSource() = default;
+
+    /**
+     * @brief Get the first event strictly after a time
+     * @param timeNs Time in ns since the Unix epoch
+     * @return Event time, or NEVER if there is none
+     */
+    virtual std::int64_t eventAfter(std::int64_t timeNs) const = 0;
+
+    /**
+     * @brief Get the label shown for the source's events
+     * @return Label, e.g. "ES 5m" or "NFP"
+     */
+    virtual const std::string& getLabel() const = 0;
+};
+
+/**
+ * @brief Wall-clock-aligned bar closes, with the same boundary rule as BoundaryBatch
+ */
+class BarCloseSource : public ICountdownSource {
+public:
+    /**
+     * @brief Constructor
+     * @param label Label, e.g. "ES 5m"
+     * @param periodSeconds Bar length in seconds (positive)
+     * @param offsetSeconds Boundary offset in seconds (e.g. session open within the period)
+     */
+    BarCloseSource(const std::string& label, int periodSeconds, int offsetSeconds = 0);
+
+    std::int64_t eventAfter(std::int64_t timeNs) const override;
+    const std::string& getLabel() const override;
+
+private:
+    std::string m_label;                                 ///< Label
+    std::int64_t m_periodNs;                             ///< Bar length
+    std::int64_t m_offsetNs;                             ///< Boundary offset
+};
+
+/**
+ * @brief Explicit list of event times: session opens and closes, economic releases, manual timers
+ */
+class EventListSource : public ICountdownSource {
+public:
+    /**
+     * @brief Constructor
+     * @param label Label, e.g. "Session close"
+     * @param timesNs Event times (any order)
+     */
+    explicit EventListSource(const std::string& label, std::vector<std::int64_t> timesNs = {});
+
+    /**
+     * @brief Replace the event times
+     *
+     * Call NextEventAggregator::refresh() for the source afterwards.
+     * @param timesNs Event times (any order)
+     */
+    void setEvents(std::vector<std::int64_t> timesNs);
+
+    std::int64_t eventAfter(std::int64_t timeNs) const override;
+    const std::string& getLabel() const override;
+
+private:
+    std::string m_label;                                 ///< Label
+    std::vector<std::int64_t> m_timesNs;                 ///< Event times, sorted
+};
+
+/**
+ * @brief Event reported by NextEventAggregator
+ */
+struct UpcomingEvent {
+    std::int64_t timeNs = ICountdownSource::NEVER;       ///< Event time (ns since the Unix epoch)
+    std::size_t source = 0;                              ///< Index returned by addSource()
+};
+
+/**
+ * @brief Earliest upcoming event across many countdown sources
+ *
+ * Keeps a binary min-heap holding each source's next event. advanceTo()
+ * pops the events that are due and asks only the sources that fired for
+ * their following event, so moving time forward costs O(log S) per event
+ * instead of a rescan of all S sources. upcoming() lists the next K events
+ * across every source by merging lazily from the heap root, looking ahead
+ * in a source only when its previous event has been taken: O(K log K),
+ * independent of S. Not thread-safe; owned by one thread.
+ */
+class NextEventAggregator {
+public:
+    /**
+     * @brief Constructor
+     * @param nowNs Time the sources' next events are taken after
+     */
+    explicit NextEventAggregator(std::int64_t nowNs = 0);
+
+    /**
+     * @brief Add a source
+     * @param source Source to follow
+     * @return Source index used in UpcomingEvent and refresh()
+     */
+    std::size_t addSource(std::shared_ptr<ICountdownSource> source);
+
+    /**
+     * @brief Re-read a source's next event after its schedule changed
+     * @param index Source index
+     */
+    void refresh(std::size_t index);
+
+    /**
+     * @brief Move time forward and collect the events passed
+     * @param nowNs New current time; must not go backwards
+     * @param fired Receives events at or before nowNs in time order (may be nullptr)
+     * @return Number of events passed
+     */
+    std::size_t advanceTo(std::int64_t nowNs, std::vector<UpcomingEvent>* fired = nullptr);
+
+    /**
+     * @brief Get the earliest upcoming event
+     * @return Event, with timeNs NEVER if no source has one
+     */
+    UpcomingEvent next() const;
+
+    /**
+     * @brief List the next events across all sources in time order
+     * @param count Maximum number of events
+     * @param events Receives the events (cleared first)
+     */
+    void upcoming(std::size_t count, std::vector<UpcomingEvent>& events) const;
+
+    /**
+     * @brief Get a source
+     * @param index Source index
+     * @return Source
+     */
+    const ICountdownSource& getSource(std::size_t index) const;
+
+    /**
+     * @brief Get the number of sources
+     * @return Sources added
+     */
+    std::size_t getSourceCount() const;
+
+private:
+    /**
+     * @brief Entry of the upcoming() merge frontier
+     */
+    struct Candidate {
+        UpcomingEvent event;                             ///< Event
+        std::size_t heapPosition;                        ///< Heap position it was taken from, or NOT_IN_HEAP for a look-ahead
+    };
+
+    static const std::size_t NOT_IN_HEAP = std::numeric_limits<std::size_t>::max();
+
+    /**
+     * @brief Restore heap order around a position after its time changed
+     * @param position Heap position
+     */
+    void reposition(std::size_t position);
+
+    /**
+     * @brief Move an entry towards the root while it is earlier than its parent
+     * @param position Heap position
+     * @return Final position
+     */
+    std::size_t siftUp(std::size_t position);
+
+    /**
+     * @brief Move an entry towards the leaves while a child is earlier
+     * @param position Heap position
+     */
+    void siftDown(std::size_t position);
+
+    /**
+     * @brief Swap two heap entries and update the position index
+     */
+    void swapEntries(std::size_t a, std::size_t b);
+
+private:
+    std::int64_t m_nowNs;                                ///< Time events are taken after
+    std::vector<std::shared_ptr<ICountdownSource>> m_sources; ///< Sources by index
+    std::vector<UpcomingEvent> m_heap;                   ///< Next event of each source, min-heap on timeNs
+    std::vector<std::size_t> m_positions;                ///< Heap position of each source
+    mutable std::vector<Candidate> m_candidates;         ///< Scratch merge frontier for upcoming()
+};
+
+} // namespace TradingTimeCounter
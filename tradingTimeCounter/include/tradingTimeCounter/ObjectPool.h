@@ -0,0 +1,154 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include "Arena.h"
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief Counters reported by FixedBlockPool and PoolSet
+ */
+struct PoolStats {
+    std::size_t capacity = 0;            ///< Blocks carved from chunks
+    std::size_t inUse = 0;               ///< Blocks handed out
+    std::size_t highWater = 0;           ///< Largest inUse seen
+    std::size_t chunks = 0;              ///< Chunks taken from the heap or arena
+};
+
+/**
+ * @brief Free list of equal-sized blocks, grown a chunk at a time
+ *
+ * allocate() and deallocate() are a pointer pop and push. Chunks are
+ * never returned, so after the population's high-water mark is reached
+ * the pool does not touch the heap again. Chunks come from an Arena when
+ * one is given, otherwise from the heap. Not thread-safe.
+ */
+class FixedBlockPool {
+public:
+    /**
+     * @brief Constructor
+     * @param blockSize Bytes per block (rounded up to 16)
+     * @param blocksPerChunk Blocks added per growth step
+     * @param arena Arena to take chunks from, or nullptr for the heap
+     */
+    explicit FixedBlockPool(std::size_t blockSize, std::size_t blocksPerChunk = 256, Arena* arena = nullptr);
+
+    /**
+     * @brief Take a block
+     * @return Block of getBlockSize() bytes, 16-byte aligned
+     */
+    void* allocate();
+
+    /**
+     * @brief Return a block
+     * @param block Block from allocate()
+     */
+    void deallocate(void* block);
+
+    /**
+     * @brief Get the block size
+     * @return Bytes per block
+     */
+    std::size_t getBlockSize() const;
+
+    /**
+     * @brief Get usage counters
+     * @return Counters
+     */
+    PoolStats getStats() const;
+
+private:
+    /**
+     * @brief Add a chunk of blocks to the free list
+     */
+    void grow();
+
+private:
+    std::size_t m_blockSize;                             ///< Bytes per block
+    std::size_t m_blocksPerChunk;                        ///< Blocks per growth step
+    Arena* m_arena;                                      ///< Chunk source (nullptr = heap)
+    std::vector<std::unique_ptr<unsigned char[]>> m_chunks; ///< Heap chunks (no arena)
+    void* m_free;                                        ///< Free list head (next pointer in each block)
+    PoolStats m_stats;                                   ///< Counters
+};
+
+/**
+ * @brief FixedBlockPools for every 16-byte size class up to MAX_BLOCK_SIZE
+ *
+ * Backs PoolAllocator, so node-based containers (maps, lists) recycle
+ * their nodes instead of calling the heap for each insertion. Larger
+ * requests (e.g. hash bucket arrays) go to the heap.
+ */
+class PoolSet {
+public:
+    static const std::size_t SIZE_CLASS = 16;            ///< Size-class granularity
+    static const std::size_t MAX_BLOCK_SIZE = 256;       ///< Largest pooled request
+
+    /**
+     * @brief Constructor
+     * @param blocksPerChunk Blocks added per growth step of each class
+     * @param arena Arena to take chunks from, or nullptr for the heap
+     */
+    explicit PoolSet(std::size_t blocksPerChunk = 256, Arena* arena = nullptr);
+
+    /**
+     * @brief Allocate memory
+     * @param bytes Size in bytes
+     * @return Memory, 16-byte aligned
+     */
+    void* allocate(std::size_t bytes);
+
+    /**
+     * @brief Free memory
+     * @param memory Memory from allocate()
+     * @param bytes Size passed to allocate()
+     */
+    void deallocate(void* memory, std::size_t bytes);
+
+    /**
+     * @brief Get usage counters summed over the size classes
+     * @return Counters (highWater is the sum of per-class high-water marks)
+     */
+    PoolStats getStats() const;
+
+private:
+    std::vector<FixedBlockPool> m_pools;                 ///< Pool per size class
+};
+
+/**
+ * @brief Standard allocator drawing from a PoolSet
+ * @tparam T Value type
+ */
+template <typename T>
+class PoolAllocator {
+public:
+    using value_type = T;
+
+    explicit PoolAllocator(PoolSet& pools) : m_pools(&pools) {}
+
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>& other) : m_pools(other.getPools()) {}
+
+    T* allocate(std::size_t count) {
+        return static_cast<T*>(m_pools->allocate(count * sizeof(T)));
+    }
+
+    void deallocate(T* memory, std::size_t count) {
+        m_pools->deallocate(memory, count * sizeof(T));
+    }
+
+    PoolSet* getPools() const { return m_pools; }
+
+    template <typename U>
+    bool operator==(const PoolAllocator<U>& other) const { return m_pools == other.getPools(); }
+
+    template <typename U>
+    bool operator!=(const PoolAllocator<U>& other) const { return m_pools != other.getPools(); }
+
+private:
+    PoolSet* m_pools;                                    ///< Source pools
+};
+
+} // namespace TradingTimeCounter
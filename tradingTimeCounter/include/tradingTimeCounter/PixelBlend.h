@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "CpuFeatures.h"
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief Coverage blending kernels for premultiplied 32-bit pixels
+ * 
+ * Each destination pixel is interpolated towards a solid color by an 8-bit
+ * coverage value: dst = (dst * (255 - c) + color * c) / 255, rounded, on
+ * every channel including alpha. All kernels produce bit-identical output.
+ */
+namespace PixelBlend {
+
+/**
+ * @brief Blend a solid color into a span using the best supported kernel
+ * @param dst Destination pixels
+ * @param coverage Per-pixel coverage 0-255
+ * @param count Number of pixels
+ * @param color Packed premultiplied color
+ */
+void blendSpan(std::uint32_t* dst, const std::uint8_t* coverage, std::size_t count, std::uint32_t color);
+
+/**
+ * @brief Blend a solid color into a span using a specific kernel
+ * 
+ * Falls back to the scalar kernel if the CPU lacks the requested level.
+ * @param level Kernel to use
+ * @param dst Destination pixels
+ * @param coverage Per-pixel coverage 0-255
+ * @param count Number of pixels
+ * @param color Packed premultiplied color
+ */
+void blendSpanWith(SimdLevel level, std::uint32_t* dst, const std::uint8_t* coverage,
+                   std::size_t count, std::uint32_t color);
+
+} // namespace PixelBlend
+
+} // namespace TradingTimeCounter
@@ -0,0 +1,172 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "AlertPlan.h"
+#include "CountdownTimer.h"
+#include "ITimerCallback.h"
+#include "TickFile.h"
+#include "VirtualClock.h"
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief Summary of a completed replay run
+ */
+struct ReplayStats {
+    std::size_t recordsProcessed = 0;   ///< Tick records consumed
+    std::uint64_t timerEvents = 0;      ///< Timer callbacks delivered (alerts, flashes, updates and completions)
+    std::int64_t virtualStartNs = 0;    ///< Virtual time of the first record
+    std::int64_t virtualEndNs = 0;      ///< Virtual time of the last record
+    double wallSeconds = 0.0;           ///< Real time spent replaying
+    std::size_t outOfOrderRecords = 0;  ///< Records stamped before an earlier one, replayed at the later time
+};
+
+/**
+ * @brief Drives bar-aligned countdowns through historical data on a virtual clock
+ *
+ * Tick records (typically memory-mapped from a TickFile) advance a
+ * VirtualClock. Each registered countdown behaves like a wall-clock-aligned
+ * CountdownTimer on that clock with the same alert plan and precision
+ * policy: its callback receives onTimerAlert as each stage is reached,
+ * onTimerFlash at each toggle of a flashing stage, onTimerUpdate whenever
+ * the displayed text changes and onTimerBoundary then onTimerCompleted
+ * at every bar close, in the order the timer thread delivers them and with
+ * the virtual clock set to the event's own instant. Replay runs as fast as
+ * possible by default or paced at a multiple of real time; the per-record
+ * path neither allocates nor sleeps.
+ */
+class ReplayEngine {
+public:
+    /**
+     * @brief Constructor
+     */
+    ReplayEngine();
+
+    // Disable copy constructor and assignment operator
+    ReplayEngine(const ReplayEngine&) = delete;
+    ReplayEngine& operator=(const ReplayEngine&) = delete;
+
+    /**
+     * @brief Register a bar-aligned countdown subscriber
+     * @param durationMinutes Bar length in minutes
+     * @param callback Subscriber that receives timer events
+     * @param alertPlan Pre-warning stages, as set with CountdownTimer::setAlertPlan
+     * @param policy Display precision, as set with CountdownTimer::setPrecisionPolicy
+     */
+    void addCountdown(int durationMinutes, std::shared_ptr<ITimerCallback> callback,
+                      const AlertPlan& alertPlan = AlertPlan(),
+                      const DisplayPrecisionPolicy& policy = DisplayPrecisionPolicy::fixedSeconds());
+
+    /**
+     * @brief Set replay speed
+     * @param speed Multiple of real time, or 0 to replay as fast as possible (default)
+     */
+    void setSpeed(double speed);
+
+    /**
+     * @brief Set callback invoked for every tick record after timers are advanced
+     * @param callback Function to call with each record
+     */
+    void setRecordCallback(std::function<void(const TickRecord&)> callback);
+
+    /**
+     * @brief Get the virtual clock driven by the replay
+     *
+     * Pass to CountdownTimer::setReferenceClock or query from subscribers to
+     * read the replayed time.
+     * @return Shared virtual clock
+     */
+    std::shared_ptr<VirtualClock> getClock() const;
+
+    /**
+     * @brief Replay records in timestamp order
+     *
+     * The virtual clock never moves backwards: a record stamped before the
+     * one preceding it is delivered at the preceding record's time and
+     * counted in ReplayStats::outOfOrderRecords.
+     * @param records First record
+     * @param count Number of records
+     * @return Replay summary
+     */
+    ReplayStats run(const TickRecord* records, std::size_t count);
+
+    /**
+     * @brief Replay a memory-mapped tick file
+     * @param file Open tick file
+     * @return Replay summary
+     */
+    ReplayStats run(const TickFile& file);
+
+    /**
+     * @brief Ask a running replay to stop after the current record (thread-safe)
+     */
+    void requestStop();
+
+private:
+    /**
+     * @brief Replayed state of one countdown
+     */
+    struct Countdown {
+        std::int64_t periodNs;                           ///< Bar length
+        std::int64_t boundaryNs;                         ///< Next bar close
+        std::uint32_t changeAtMs;                        ///< Remaining time of the next text change
+        std::uint32_t alertAtMs;                         ///< Remaining time of the next alert threshold
+        std::uint32_t flashAtMs;                         ///< Remaining time of the next flash toggle (0 = none)
+        int alertStage;                                  ///< Active alert stage, -1 for none
+        int flashHighlighted;                            ///< Last flash phase delivered, -1 when not flashing
+        AlertPlan alertPlan;                             ///< Pre-warning stages
+        DisplayPrecisionPolicy policy;                   ///< Display precision
+        std::shared_ptr<ITimerCallback> callback;        ///< Subscriber
+    };
+
+    /**
+     * @brief Arm every countdown for the first bar after startNs
+     * @param startNs Virtual start time
+     */
+    void startCountdowns(std::int64_t startNs);
+
+    /**
+     * @brief Deliver every timer event due up to nowNs, then move the clock there
+     * @param nowNs Target virtual time
+     */
+    void advanceTo(std::int64_t nowNs);
+
+    /**
+     * @brief Deliver what a timer thread waking at nowNs would: alert stage, flash, text change, completion
+     * @param countdown Countdown to wake
+     * @param nowNs Virtual time of the wakeup
+     */
+    void wakeCountdown(Countdown& countdown, std::int64_t nowNs);
+
+    /**
+     * @brief Get the instant a countdown's timer thread next wakes
+     * @param countdown Countdown to query
+     * @return Virtual time of the next text change, alert threshold or flash toggle
+     */
+    static std::int64_t nextWakeNs(const Countdown& countdown);
+
+    /**
+     * @brief Sleep until real time catches up with virtual time (paced replay only)
+     * @param virtualNs Virtual time about to be delivered
+     */
+    void pace(std::int64_t virtualNs) const;
+
+private:
+    std::vector<Countdown> m_countdowns;                 ///< Registered countdowns
+    std::shared_ptr<VirtualClock> m_clock;               ///< Replayed time
+    std::function<void(const TickRecord&)> m_recordCallback; ///< Per-record hook
+    double m_speed;                                      ///< Multiple of real time (0 = unpaced)
+    std::atomic<bool> m_shouldStop;                      ///< Stop request flag
+
+    std::int64_t m_nextEventNs;                          ///< Earliest pending timer event
+    std::uint64_t m_timerEvents;                         ///< Timer callbacks delivered this run
+    std::int64_t m_virtualStartNs;                       ///< Virtual time at run start
+    std::chrono::steady_clock::time_point m_realStart;   ///< Real time at run start
+};
+
+} // namespace TradingTimeCounter
@@ -0,0 +1,244 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "Arena.h"
+#include "BoundedMailbox.h"
+#include "ObjectPool.h"
+#include "TimerTable.h"
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief Counters of one ShardedTimerScheduler shard
+ */
+struct ShardStats {
+    std::uint64_t timers = 0;            ///< Timers held by the shard
+    std::uint64_t commands = 0;          ///< Add/cancel commands applied
+    std::uint64_t expired = 0;           ///< Expiries delivered
+    std::uint64_t mailboxFull = 0;       ///< Times a producer found the mailbox full and waited
+    std::uint64_t timersHighWater = 0;   ///< Most timers held at once
+    std::uint64_t poolBytes = 0;         ///< Bytes reserved for timer records
+};
+
+/**
+ * @brief Timer scheduler partitioned across shard threads
+ *
+ * Timers are identified by a caller-chosen 64-bit key (e.g. symbol and
+ * timeframe) that picks their shard. Each shard thread owns a TimerTable
+ * and runs its own expiry loop, so shards share no timer state and take
+ * no locks on the hot path: add() and cancel() from any thread enqueue a
+ * command in the shard's lock-free mailbox, which the shard applies
+ * before its next expiry pass. A producer only touches the shard's mutexes
+ * to wake a sleeping shard thread or, with the thread stopped, to drain a
+ * full mailbox. Key records are pooled in a per-shard arena, so re-arming
+ * and cancelling alerts does not call the heap once the shard's timer
+ * count has reached its high-water mark.
+ *
+ * Deadlines are TscClock / steady-clock nanoseconds. The expiry handler
+ * runs on the shard thread, so it is called concurrently from different
+ * shards; the expiries of one key arrive in order. With a manually
+ * driven clock do not start the threads and call runDue() instead.
+ */
+class ShardedTimerScheduler {
+public:
+    /**
+     * @brief Called on the shard thread for every expiry
+     * @param key Timer key
+     * @param deadlineNs Deadline that was reached
+     */
+    using ExpiryHandler = std::function<void(std::uint64_t key, std::int64_t deadlineNs)>;
+
+    static const std::size_t MAILBOX_CAPACITY = 65536;   ///< Pending commands per shard
+
+    /**
+     * @brief Constructor
+     * @param handler Expiry handler
+     * @param shardCount Number of shards (0 = hardware concurrency)
+     * @param pinThreads true to pin shard i to CPU i (Linux and Windows)
+     */
+    explicit ShardedTimerScheduler(ExpiryHandler handler, std::size_t shardCount = 0, bool pinThreads = false);
+
+    /**
+     * @brief Destructor - stops the shard threads
+     */
+    ~ShardedTimerScheduler();
+
+    // Disable copy constructor and assignment operator
+    ShardedTimerScheduler(const ShardedTimerScheduler&) = delete;
+    ShardedTimerScheduler& operator=(const ShardedTimerScheduler&) = delete;
+
+    /**
+     * @brief Add a timer, or replace the timer with the same key
+     *
+     * Safe to call from any thread, including from the expiry handler.
+     * Waits while the shard's mailbox is full; on a stopped scheduler the
+     * caller applies the pending commands itself.
+     * @param key Timer key
+     * @param deadlineNs First deadline (steady-clock ns)
+     * @param periodNs Re-arm period, or 0 for a one-shot timer
+     */
+    void add(std::uint64_t key, std::int64_t deadlineNs, std::int64_t periodNs = 0);
+
+    /**
+     * @brief Cancel a timer (no effect if it is unknown or has fired)
+     *
+     * Safe to call from any thread, including from the expiry handler.
+     * @param key Timer key
+     */
+    void cancel(std::uint64_t key);
+
+    /**
+     * @brief Apply pending commands and deliver due expiries on the calling thread
+     *
+     * For manually driven clocks; must not be called while started.
+     * @param nowNs Current time
+     * @return Number of expiries delivered
+     */
+    std::size_t runDue(std::int64_t nowNs);
+
+    /**
+     * @brief Start the shard threads
+     */
+    void start();
+
+    /**
+     * @brief Stop and join the shard threads
+     *
+     * Timers and pending commands stay and are handled after a later
+     * start() or runDue().
+     */
+    void stop();
+
+    /**
+     * @brief Check if the shard threads are running
+     * @return true if running, false otherwise
+     */
+    bool isRunning() const;
+
+    /**
+     * @brief Get the number of shards
+     * @return Shard count
+     */
+    std::size_t getShardCount() const;
+
+    /**
+     * @brief Get the shard a key belongs to
+     * @param key Timer key
+     * @return Shard index
+     */
+    std::size_t shardOf(std::uint64_t key) const;
+
+    /**
+     * @brief Get a shard's counters
+     * @param shard Shard index
+     * @return Counters
+     */
+    ShardStats getStats(std::size_t shard) const;
+
+private:
+    /**
+     * @brief Mailbox entry
+     */
+    struct Command {
+        std::uint64_t key = 0;                           ///< Timer key
+        std::int64_t deadlineNs = 0;                     ///< Deadline (add only)
+        std::int64_t periodNs = 0;                       ///< Period (add only)
+        bool cancel = false;                             ///< true to cancel, false to add
+    };
+
+    /**
+     * @brief One partition: its timers, mailbox and thread
+     */
+    struct Shard {
+        using HandleMap = std::unordered_map<std::uint64_t, TimerHandle, std::hash<std::uint64_t>,
+                                             std::equal_to<std::uint64_t>,
+                                             PoolAllocator<std::pair<const std::uint64_t, TimerHandle>>>;
+
+        explicit Shard(std::size_t mailboxCapacity)
+            : mailbox(mailboxCapacity)
+            , pools(1024, &arena)
+            , handles(0, std::hash<std::uint64_t>(), std::equal_to<std::uint64_t>(),
+                      PoolAllocator<std::pair<const std::uint64_t, TimerHandle>>(pools)) {
+        }
+
+        std::mutex consumerMutex;                        ///< Held by the thread that owns the table
+        BoundedMailbox<Command> mailbox;                 ///< Commands from other threads
+        Arena arena;                                     ///< Record storage (owner only)
+        PoolSet pools;                                   ///< Record pools in the arena (owner only)
+        TimerTable table;                                ///< Timers (owner only)
+        HandleMap handles;                               ///< Key to timer (owner only)
+        std::vector<std::uint64_t> keys;                 ///< Key of each table slot (owner only)
+        std::vector<ExpiredTimer> expired;               ///< Reused expiry output
+        std::vector<std::uint64_t> expiredKeys;          ///< Keys of expired, in the same order
+        std::int64_t nextDeadlineNs = TimerTable::NEVER; ///< Earliest deadline (may be early after a cancel)
+
+        std::mutex sleepMutex;                           ///< Guards the sleep wait
+        std::condition_variable sleepCondition;          ///< Signalled on a command or stop
+        std::atomic<bool> sleeping{false};               ///< Shard thread is (about to be) waiting
+
+        std::atomic<std::uint64_t> timers{0};            ///< Timers in the table
+        std::atomic<std::uint64_t> commands{0};          ///< Commands applied
+        std::atomic<std::uint64_t> expiries{0};          ///< Expiries delivered
+        std::atomic<std::uint64_t> mailboxFull{0};       ///< Full-mailbox waits
+        std::atomic<std::uint64_t> timersHighWater{0};   ///< Most timers held
+        std::atomic<std::uint64_t> poolBytes{0};         ///< Arena bytes reserved
+        std::thread thread;                              ///< Shard thread
+    };
+
+    /**
+     * @brief Shard thread function
+     * @param index Shard index
+     */
+    void shardThreadFunction(std::size_t index);
+
+    /**
+     * @brief Enqueue a command for a key's shard and wake it if asleep
+     * @param command Command to enqueue
+     */
+    void send(const Command& command);
+
+    /**
+     * @brief Wake a shard thread that is waiting
+     * @param shard Shard to wake
+     */
+    void wake(Shard& shard);
+
+    /**
+     * @brief Apply the commands waiting in a shard's mailbox (shard thread)
+     * @param shard Shard
+     */
+    void applyCommands(Shard& shard);
+
+    /**
+     * @brief Apply one command to a shard's table (shard thread)
+     * @param shard Shard
+     * @param command Command to apply
+     */
+    void applyCommand(Shard& shard, const Command& command);
+
+    /**
+     * @brief Deliver a shard's due expiries (shard thread)
+     * @param shard Shard
+     * @param nowNs Current time
+     * @return Number of expiries delivered
+     */
+    std::size_t expire(Shard& shard, std::int64_t nowNs);
+
+private:
+    ExpiryHandler m_handler;                             ///< Expiry handler
+    std::vector<std::unique_ptr<Shard>> m_shards;        ///< Shards
+    bool m_pinThreads;                                   ///< Pin shard threads to CPUs
+    std::atomic<bool> m_isRunning;                       ///< Running state flag
+    std::atomic<bool> m_shouldStop;                      ///< Stop request flag
+};
+
+} // namespace TradingTimeCounter
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "CpuFeatures.h"
+#include "Framebuffer.h"
+#include "GlyphCellCache.h"
+#include "IDisplayManager.h"
+#include "IGlyphRasterizer.h"
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief Backend-agnostic renderer of the countdown text into a framebuffer
+ *
+ * Glyphs for the countdown's character set are rasterised once per
+ * configuration into coverage masks laid out in fixed-width cells. Each
+ * render() compares the new text with the previous one and redraws only
+ * the cells whose character changed, blending glyph coverage with SIMD
+ * kernels. Platform backends present the framebuffer (or just its dirty
+ * rectangle) and never draw text themselves.
+ *
+ * An optional style table (alert stages) is resolved together with the
+ * configuration: packed colors per style and glyph cells per weight.
+ * Switching styles then only swaps an index and redraws.
+ */
+class SoftwareRenderer {
+public:
+    /**
+     * @brief Constructor
+     * @param format Pixel byte order expected by the presenting backend
+     */
+    explicit SoftwareRenderer(PixelFormat format = PixelFormat::RGBA8);
+
+    /**
+     * @brief Set the glyph rasteriser (default: BuiltinGlyphRasterizer)
+     *
+     * Takes effect at the next configure().
+     * @param rasterizer Rasteriser to use
+     */
+    void setGlyphRasterizer(std::shared_ptr<IGlyphRasterizer> rasterizer);
+
+    /**
+     * @brief Apply a display configuration
+     *
+     * Resizes the framebuffer, resolves colors and opacity to packed pixels
+     * and rasterises the glyph set. The next render() redraws everything.
+     * @param config Display configuration
+     * @return true if successful, false otherwise
+     */
+    bool configure(const DisplayConfig& config);
+
+    /**
+     * @brief Set the styles the text can switch between and resolve them
+     *
+     * Resolved against the current configuration and again at every
+     * configure(); style 0 is selected. An empty table means the
+     * configuration's own style only.
+     * @param styles Style table
+     * @return true if successful, false otherwise
+     */
+    bool setStyles(const std::vector<DisplayStyle>& styles);
+
+    /**
+     * @brief Switch to a resolved style; the next render() redraws everything
+     * @param index Index into the style table
+     * @return true if selected, false if out of range
+     */
+    bool selectStyle(std::size_t index);
+
+    /**
+     * @brief Get the selected style
+     * @return Index into the style table
+     */
+    std::size_t getStyle() const;
+
+    /**
+     * @brief Render text, redrawing only changed cells
+     * @param text Text to render
+     * @return Rectangle that changed (empty if nothing changed)
+     */
+    RenderRect render(const std::string& text);
+
+    /**
+     * @brief Force the next render() to redraw the whole framebuffer
+     */
+    void invalidate();
+
+    /**
+     * @brief Get the rendered framebuffer
+     * @return Framebuffer
+     */
+    const Framebuffer& getFramebuffer() const;
+
+    /**
+     * @brief Override the blending kernel (for benchmarks and cross-checks)
+     * @param level Kernel to use; unsupported levels fall back to scalar
+     */
+    void setSimdLevel(SimdLevel level);
+
+private:
+    /**
+     * @brief Redraw one character cell
+     * @param x Cell left edge
+     * @param y Cell top edge
+     * @param ch Character to draw
+     */
+    void drawCell(int x, int y, char ch);
+
+    /**
+     * @brief Resolve the style table against the configuration and reselect the current style
+     * @return true if successful, false otherwise
+     */
+    bool resolveStyles();
+
+private:
+    /**
+     * @brief A style resolved for drawing
+     */
+    struct ResolvedStyle {
+        std::uint32_t background;                        ///< Packed premultiplied background
+        std::uint32_t foreground;                        ///< Packed premultiplied text color
+        std::size_t cells;                               ///< Index into m_cells (weight)
+    };
+
+
+    Framebuffer m_framebuffer;                           ///< Render target
+    std::shared_ptr<IGlyphRasterizer> m_rasterizer;      ///< Glyph source
+    SimdLevel m_simdLevel;                               ///< Blending kernel
+
+    DisplayConfig m_config;                              ///< Configuration styles are resolved against
+    std::vector<DisplayStyle> m_styles;                  ///< Style table (empty = configuration only)
+    std::vector<ResolvedStyle> m_resolvedStyles;         ///< m_styles resolved for drawing
+    std::size_t m_style;                                 ///< Selected entry of m_resolvedStyles
+    std::array<GlyphCellCache, 2> m_cells;               ///< Glyphs per weight (regular, bold)
+    std::size_t m_activeWeight;                          ///< m_cells entry of the selected style
+
+    std::uint32_t m_background;                          ///< Packed premultiplied background
+    std::uint32_t m_foreground;                          ///< Packed premultiplied text color
+    std::string m_renderedText;                          ///< Text currently in the framebuffer
+    bool m_needsFullRedraw;                              ///< Configuration changed since last render
+};
+
+} // namespace TradingTimeCounter
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief Persisted state of one countdown
+ */
+struct PersistedTimer {
+    std::int32_t durationSeconds;       ///< Countdown duration (bar length when aligned)
+    std::uint8_t state;                 ///< CountdownState at the last transition
+    std::uint8_t wallClockAligned;      ///< Non-zero if aligned to wall-clock boundaries
+    std::uint16_t reserved;             ///< Zero
+    std::uint32_t remainingMs;          ///< Remaining time of a stopped countdown
+    std::uint32_t reserved2;            ///< Zero
+    std::int64_t deadlineNs;            ///< Wall-clock deadline of a running countdown (ns since epoch)
+};
+
+static_assert(sizeof(PersistedTimer) == 24, "PersistedTimer must match the on-disk layout");
+
+/**
+ * @brief Persisted definition of one dashboard countdown
+ */
+struct PersistedDashboardTimer {
+    char label[32];                     ///< Null-terminated row label
+    std::int32_t periodSeconds;         ///< Bar length in seconds
+    std::int32_t offsetSeconds;         ///< Boundary offset in seconds
+};
+
+static_assert(sizeof(PersistedDashboardTimer) == 40, "PersistedDashboardTimer must match the on-disk layout");
+
+/**
+ * @brief Everything the application restores after a restart
+ */
+struct PersistedState {
+    static const std::size_t MAX_DASHBOARD_TIMERS = 32;  ///< Dashboard rows that fit the file
+
+    PersistedTimer timer;                                ///< Main countdown
+    std::uint32_t dashboardCount;                        ///< Valid entries in dashboard
+    std::uint32_t reserved;                              ///< Zero
+    PersistedDashboardTimer dashboard[MAX_DASHBOARD_TIMERS]; ///< Dashboard definitions
+};
+
+/**
+ * @brief Small memory-mapped file holding the application's timer state
+ *
+ * The file (a few KB, little-endian) has a header and two state slots,
+ * each with a sequence number and an FNV-1a checksum. save() writes the
+ * older slot in place through a shared mapping and never flushes, so a
+ * state change costs a memcpy and a checksum; the page cache keeps the
+ * data across a process crash. A write torn by a system crash fails its
+ * checksum and load() falls back to the other slot.
+ */
+class StateFile {
+public:
+    /**
+     * @brief Constructor
+     */
+    StateFile();
+
+    /**
+     * @brief Destructor - unmaps the file
+     */
+    ~StateFile();
+
+    // Disable copy constructor and assignment operator
+    StateFile(const StateFile&) = delete;
+    StateFile& operator=(const StateFile&) = delete;
+
+    /**
+     * @brief Map a state file, creating or reinitialising it if needed
+     * @param path Path of the state file
+     * @return true if successful, false otherwise
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Schedule write-back and unmap the file
+     */
+    void close();
+
+    /**
+     * @brief Check if a file is mapped
+     * @return true if open, false otherwise
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Read the newest slot whose checksum matches
+     * @param state Receives the state
+     * @return true if a valid state was found, false otherwise
+     */
+    bool load(PersistedState& state) const;
+
+    /**
+     * @brief Write the state to the older slot (no flush)
+     * @param state State to persist
+     * @return true if successful, false if the file is not open
+     */
+    bool save(const PersistedState& state);
+
+private:
+    mutable std::mutex m_mutex;                          ///< Serialises save() and load()
+    void* m_mapping;                                     ///< Start of the mapping
+    std::size_t m_mappingSize;                           ///< Size of the mapping in bytes
+    std::uint64_t m_sequence;                            ///< Sequence number of the newest slot
+};
+
+} // namespace TradingTimeCounter
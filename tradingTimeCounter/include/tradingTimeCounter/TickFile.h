@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief One historical event in a tick file
+ */
+struct TickRecord {
+    std::int64_t timestampNs;           ///< Event time in ns since Unix epoch
+    std::uint32_t type;                 ///< Application-defined event type
+    std::uint32_t value;                ///< Application-defined payload
+};
+
+static_assert(sizeof(TickRecord) == 16, "TickRecord must match the on-disk layout");
+
+/**
+ * @brief Read-only memory-mapped file of historical tick records
+ *
+ * File layout (little-endian): a 16-byte header (uint32 magic "TTCT",
+ * uint32 version, uint64 record count) followed by packed TickRecords in
+ * timestamp order. Records are read straight from the mapping; nothing is
+ * copied or allocated per record.
+ */
+class TickFile {
+public:
+    /**
+     * @brief Constructor
+     */
+    TickFile();
+
+    /**
+     * @brief Destructor - unmaps the file
+     */
+    ~TickFile();
+
+    // Disable copy constructor and assignment operator
+    TickFile(const TickFile&) = delete;
+    TickFile& operator=(const TickFile&) = delete;
+
+    /**
+     * @brief Map a tick file into memory
+     * @param path Path of the tick file
+     * @return true if successful, false otherwise
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Unmap the file
+     */
+    void close();
+
+    /**
+     * @brief Get the mapped records
+     * @return Pointer to the first record, or nullptr if not open
+     */
+    const TickRecord* records() const;
+
+    /**
+     * @brief Get the number of mapped records
+     * @return Record count
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Write records to a new tick file
+     * @param path Path of the file to create (replaced if it exists)
+     * @param records Records in timestamp order
+     * @param count Number of records
+     * @return true if successful, false otherwise
+     */
+    static bool write(const std::string& path, const TickRecord* records, std::size_t count);
+
+private:
+    void* m_mapping;                                     ///< Start of the mapping
+    std::size_t m_mappingSize;                           ///< Size of the mapping in bytes
+    const TickRecord* m_records;                         ///< First record in the mapping
+    std::size_t m_recordCount;                           ///< Number of records
+};
+
+} // namespace TradingTimeCounter
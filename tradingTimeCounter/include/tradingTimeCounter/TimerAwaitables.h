@@ -0,0 +1,233 @@
+#pragma once
+
+#if __cplusplus < 202002L && (!defined(_MSVC_LANG) || _MSVC_LANG < 202002L)
+#error "TimerAwaitables.h requires C++20; link TimerCoroutines (TTC_ENABLE_COROUTINES=ON)"
+#endif
+
+#include <chrono>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "DeadlineScheduler.h"
+#include "IExecutor.h"
+#include "ITimerCallback.h"
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief Return type of fire-and-forget coroutines
+ *
+ * The coroutine starts running immediately and frees its frame when it
+ * finishes; an escaping exception terminates the program. A suspended
+ * coroutine costs its frame only, so thousands of strategies can wait on
+ * boundaries without a thread each.
+ */
+struct DetachedTask {
+    struct promise_type {
+        DetachedTask get_return_object() noexcept { return DetachedTask(); }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+};
+
+/**
+ * @brief Awaitable that resumes the coroutine on an executor at a reference time
+ *
+ * Always suspends: a deadline already in the past resumes at once, but
+ * still through the executor. co_await yields the deadline.
+ */
+class DeadlineAwaitable {
+public:
+    /**
+     * @brief Constructor
+     * @param scheduler Scheduler that fires the wakeup
+     * @param executor Executor the coroutine resumes on
+     * @param deadlineNs Reference time in ns since Unix epoch
+     */
+    DeadlineAwaitable(DeadlineScheduler& scheduler, IExecutor& executor, std::int64_t deadlineNs);
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> handle);
+    std::chrono::system_clock::time_point await_resume() const noexcept;
+
+private:
+    DeadlineScheduler& m_scheduler;                      ///< Wakeup source
+    IExecutor& m_executor;                               ///< Resumption context
+    std::int64_t m_deadlineNs;                           ///< Reference time to resume at
+};
+
+/**
+ * @brief Coroutine view of the reference clock
+ *
+ * Usage: co_await clock.untilNextBar(std::chrono::minutes(5));
+ */
+class CoroutineClock {
+public:
+    /**
+     * @brief Constructor
+     * @param scheduler Scheduler that fires wakeups (must outlive the clock)
+     * @param executor Executor coroutines resume on (must outlive the clock)
+     */
+    CoroutineClock(DeadlineScheduler& scheduler, IExecutor& executor);
+
+    /**
+     * @brief Wait until a reference time
+     * @param when Time to resume at
+     * @return Awaitable
+     */
+    DeadlineAwaitable until(std::chrono::system_clock::time_point when) const;
+
+    /**
+     * @brief Wait for a duration of reference time
+     * @param duration Time to wait
+     * @return Awaitable
+     */
+    DeadlineAwaitable sleepFor(std::chrono::nanoseconds duration) const;
+
+    /**
+     * @brief Wait for the next bar boundary
+     *
+     * Boundaries are the instants t where (t - offset) is a multiple of the
+     * period, as for a wall-clock-aligned CountdownTimer; the next one is
+     * strictly after the current reference time.
+     * @param period Bar length
+     * @param offset Boundary offset (e.g. session open within the period)
+     * @return Awaitable yielding the boundary
+     */
+    DeadlineAwaitable untilNextBar(std::chrono::seconds period,
+                                   std::chrono::seconds offset = std::chrono::seconds(0)) const;
+
+    /**
+     * @brief Compute the first boundary strictly after a time
+     * @param nowNs Reference time in ns since Unix epoch
+     * @param periodNs Bar length in ns (positive)
+     * @param offsetNs Boundary offset in ns
+     * @return Boundary in ns since Unix epoch
+     */
+    static std::int64_t nextBoundaryNs(std::int64_t nowNs, std::int64_t periodNs, std::int64_t offsetNs);
+
+    /**
+     * @brief Get the scheduler
+     * @return Scheduler
+     */
+    DeadlineScheduler& getScheduler() const;
+
+    /**
+     * @brief Get the executor coroutines resume on
+     * @return Executor
+     */
+    IExecutor& getExecutor() const;
+
+private:
+    DeadlineScheduler& m_scheduler;                      ///< Wakeup source
+    IExecutor& m_executor;                               ///< Resumption context
+};
+
+/**
+ * @brief Daily trading session with awaitable open and close
+ *
+ * Times are offsets from UTC midnight; every day is a session day.
+ * Usage: co_await session.close();
+ */
+class TradingSession {
+public:
+    /**
+     * @brief Constructor
+     * @param clock Coroutine clock (must outlive the session)
+     * @param openUtc Session open as an offset from UTC midnight
+     * @param closeUtc Session close as an offset from UTC midnight
+     */
+    TradingSession(const CoroutineClock& clock, std::chrono::seconds openUtc, std::chrono::seconds closeUtc);
+
+    /**
+     * @brief Wait for the next session open
+     * @return Awaitable yielding the open time
+     */
+    DeadlineAwaitable open() const;
+
+    /**
+     * @brief Wait for the next session close
+     * @return Awaitable yielding the close time
+     */
+    DeadlineAwaitable close() const;
+
+private:
+    const CoroutineClock& m_clock;                       ///< Clock to wait on
+    std::chrono::seconds m_openUtc;                      ///< Open time of day (UTC)
+    std::chrono::seconds m_closeUtc;                     ///< Close time of day (UTC)
+};
+
+/**
+ * @brief Timer callback that lets coroutines await a CountdownTimer's completion
+ *
+ * Install with CountdownTimer::setCallback(); every notification is also
+ * forwarded to an optional inner callback. Awaiters resume on the executor
+ * at the next completion after they suspended (each bar close for a
+ * wall-clock-aligned timer).
+ * Usage: co_await events->completed();
+ */
+class TimerEvents : public ITimerCallback {
+public:
+    /**
+     * @brief Awaitable for the next completion
+     */
+    class CompletionAwaitable {
+    public:
+        explicit CompletionAwaitable(TimerEvents& events) : m_events(events) {}
+
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle) { m_events.addWaiter(handle); }
+        void await_resume() const noexcept {}
+
+    private:
+        TimerEvents& m_events;                           ///< Event source
+    };
+
+    /**
+     * @brief Constructor
+     * @param executor Executor awaiters resume on (must outlive the events)
+     * @param forward Callback to forward notifications to, or nullptr
+     */
+    explicit TimerEvents(IExecutor& executor, std::shared_ptr<ITimerCallback> forward = nullptr);
+
+    /**
+     * @brief Wait for the timer's next completion
+     * @return Awaitable
+     */
+    CompletionAwaitable completed();
+
+    /**
+     * @brief Get the number of suspended awaiters
+     * @return Awaiter count
+     */
+    std::size_t getWaiterCount() const;
+
+    // ITimerCallback interface implementation
+    void onTimerUpdate(int remainingSeconds) override;
+    void onTimerCompleted() override;
+    void onTimerBoundary(std::int64_t boundaryNs) override;
+    void onTimerStarted() override;
+    void onTimerStopped() override;
+    void onTimerResync(int remainingSeconds) override;
+    void onTimerAlert(int stage) override;
+    void onTimerFlash(bool highlighted) override;
+
+private:
+    /**
+     * @brief Register a suspended awaiter
+     */
+    void addWaiter(std::coroutine_handle<> handle);
+
+private:
+    IExecutor& m_executor;                               ///< Resumption context
+    std::shared_ptr<ITimerCallback> m_forward;           ///< Inner callback (may be nullptr)
+    mutable std::mutex m_mutex;                          ///< Protects m_waiters
+    std::vector<std::coroutine_handle<>> m_waiters;      ///< Awaiters of the next completion
+};
+
+} // namespace TradingTimeCounter
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief Stable handle to a timer stored in a TimerTable
+ *
+ * The generation detects use after removal: a handle whose slot has been
+ * reused by another timer no longer resolves.
+ */
+struct TimerHandle {
+    std::uint32_t slot = std::numeric_limits<std::uint32_t>::max();   ///< Slot map index
+    std::uint32_t generation = 0;                                     ///< Slot generation when issued
+
+    bool operator==(const TimerHandle& other) const { return slot == other.slot && generation == other.generation; }
+    bool operator!=(const TimerHandle& other) const { return !(*this == other); }
+};
+
+/**
+ * @brief Lifecycle state of a timer in a TimerTable
+ */
+enum class TimerState : std::uint8_t {
+    Running,            ///< Waiting for its deadline
+    Expired             ///< One-shot timer that has fired
+};
+
+/**
+ * @brief Timer reported by TimerTable::expire
+ */
+struct ExpiredTimer {
+    TimerHandle handle;                 ///< Timer that fired
+    std::uint32_t subscriberId;         ///< Subscriber to notify
+    std::int64_t deadlineNs;            ///< Deadline that was reached
+};
+
+/**
+ * @brief Struct-of-arrays storage for large timer populations
+ *
+ * Deadlines, periods, states and subscriber ids live in parallel contiguous
+ * arrays kept dense by swap-removal, so a tick pass is a linear scan over
+ * the deadline array alone. Callers hold TimerHandles, which stay valid
+ * across other timers' removal through a generation-counted slot map.
+ * Not thread-safe; owned by a single scheduler thread.
+ */
+class TimerTable {
+public:
+    /**
+     * @brief Deadline stored for timers that must never fire
+     */
+    static const std::int64_t NEVER = std::numeric_limits<std::int64_t>::max();
+
+    /**
+     * @brief Construct an empty table
+     * @param capacity Number of timers to reserve storage for
+     */
+    explicit TimerTable(std::size_t capacity = 0);
+
+    /**
+     * @brief Add a running timer
+     * @param deadlineNs First deadline (ns, any monotonic time base)
+     * @param periodNs Re-arm period, or 0 for a one-shot timer
+     * @param subscriberId Subscriber to notify on expiry
+     * @return Handle to the new timer
+     */
+    TimerHandle add(std::int64_t deadlineNs, std::int64_t periodNs, std::uint32_t subscriberId);
+
+    /**
+     * @brief Remove a timer
+     * @param handle Timer to remove
+     * @return true if removed, false if the handle was stale
+     */
+    bool remove(TimerHandle handle);
+
+    /**
+     * @brief Check whether a handle still refers to a timer
+     * @param handle Handle to check
+     * @return true if valid, false if stale
+     */
+    bool contains(TimerHandle handle) const;
+
+    /**
+     * @brief Set a new deadline and mark the timer running
+     * @param handle Timer to reschedule
+     * @param deadlineNs New deadline
+     * @return true if successful, false if the handle was stale
+     */
+    bool reschedule(TimerHandle handle, std::int64_t deadlineNs);
+
+    /**
+     * @brief Get a timer's deadline
+     * @param handle Timer to query
+     * @return Deadline, or NEVER if expired or stale
+     */
+    std::int64_t getDeadline(TimerHandle handle) const;
+
+    /**
+     * @brief Get a timer's state
+     * @param handle Timer to query
+     * @return Timer state (Expired if stale)
+     */
+    TimerState getState(TimerHandle handle) const;
+
+    /**
+     * @brief Shift every running deadline by the same amount
+     *
+     * Used to apply a clock correction to the whole table in one pass.
+     * @param deltaNs Amount to add to each running deadline
+     */
+    void shiftDeadlines(std::int64_t deltaNs);
+
+    /**
+     * @brief Fire every timer whose deadline has been reached
+     *
+     * Periodic timers are re-armed by whole periods past nowNs; one-shot
+     * timers move to TimerState::Expired. The output vector is cleared and
+     * reused, so steady-state calls do not allocate.
+     * @param nowNs Current time
+     * @param expired Receives the timers that fired
+     * @return Number of timers that fired
+     */
+    std::size_t expire(std::int64_t nowNs, std::vector<ExpiredTimer>& expired);
+
+    /**
+     * @brief Get the earliest running deadline
+     * @return Earliest deadline, or NEVER if nothing is running
+     */
+    std::int64_t nextDeadline() const;
+
+    /**
+     * @brief Get the number of timers in the table
+     * @return Timer count
+     */
+    std::size_t size() const;
+
+private:
+    /**
+     * @brief Resolve a handle to its dense index
+     * @param handle Handle to resolve
+     * @return Dense index, or size() if stale
+     */
+    std::size_t denseIndex(TimerHandle handle) const;
+
+private:
+    // Dense parallel arrays, indexed by dense position
+    std::vector<std::int64_t> m_deadlines;               ///< Next deadline (NEVER when not running)
+    std::vector<std::int64_t> m_periods;                 ///< Re-arm period (0 = one-shot)
+    std::vector<TimerState> m_states;                    ///< Lifecycle state
+    std::vector<std::uint32_t> m_subscribers;            ///< Subscriber ids
+    std::vector<std::uint32_t> m_denseToSlot;            ///< Owning slot of each dense entry
+
+    // Slot map, indexed by TimerHandle::slot
+    std::vector<std::uint32_t> m_slotToDense;            ///< Dense index of each live slot
+    std::vector<std::uint32_t> m_slotGenerations;        ///< Current generation of each slot
+    std::vector<std::uint32_t> m_freeSlots;              ///< Slots available for reuse
+};
+
+} // namespace TradingTimeCounter
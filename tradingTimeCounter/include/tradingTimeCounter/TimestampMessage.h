@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief Fixed wire layout of an exchange timestamp message
+ *
+ * All fields are little-endian:
+ *   offset 0  uint32  magic ("TTCF")
+ *   offset 4  uint16  version
+ *   offset 6  uint16  flags (reserved)
+ *   offset 8  uint64  sequence number
+ *   offset 16 int64   exchange timestamp (ns since Unix epoch)
+ */
+namespace TimestampWire {
+    const std::uint32_t MAGIC = 0x46435454;              ///< "TTCF" read as little-endian
+    const std::uint16_t VERSION = 1;                     ///< Supported layout version
+    const std::size_t MAGIC_OFFSET = 0;
+    const std::size_t VERSION_OFFSET = 4;
+    const std::size_t FLAGS_OFFSET = 6;
+    const std::size_t SEQUENCE_OFFSET = 8;
+    const std::size_t TIMESTAMP_OFFSET = 16;
+    const std::size_t MESSAGE_SIZE = 24;                 ///< Total message size in bytes
+}
+
+/**
+ * @brief Zero-copy view over a received timestamp message
+ *
+ * Fields are decoded directly from the receive buffer on access; the
+ * message itself is never copied. The buffer must outlive the view.
+ * Assumes a little-endian host, like every platform the counter targets.
+ */
+class TimestampMessageView {
+public:
+    /**
+     * @brief Construct a view over a received buffer
+     * @param data Pointer to the received bytes
+     * @param length Number of received bytes
+     */
+    TimestampMessageView(const unsigned char* data, std::size_t length)
+        : m_data(data), m_length(length) {}
+
+    /**
+     * @brief Check size, magic and version
+     * @return true if the buffer holds a well-formed message
+     */
+    bool isValid() const {
+        return m_data && m_length >= TimestampWire::MESSAGE_SIZE &&
+               read<std::uint32_t>(TimestampWire::MAGIC_OFFSET) == TimestampWire::MAGIC &&
+               read<std::uint16_t>(TimestampWire::VERSION_OFFSET) == TimestampWire::VERSION;
+    }
+
+    /**
+     * @brief Get the message sequence number
+     * @return Sequence number
+     */
+    std::uint64_t sequence() const { return read<std::uint64_t>(TimestampWire::SEQUENCE_OFFSET); }
+
+    /**
+     * @brief Get the exchange timestamp
+     * @return Nanoseconds since Unix epoch on the exchange clock
+     */
+    std::int64_t exchangeTimeNs() const { return read<std::int64_t>(TimestampWire::TIMESTAMP_OFFSET); }
+
+    /**
+     * @brief Encode a message into a caller-provided buffer
+     * @param out Buffer of at least TimestampWire::MESSAGE_SIZE bytes
+     * @param sequence Sequence number
+     * @param exchangeTimeNs Exchange timestamp in ns since Unix epoch
+     */
+    static void encode(unsigned char* out, std::uint64_t sequence, std::int64_t exchangeTimeNs) {
+        const std::uint32_t magic = TimestampWire::MAGIC;
+        const std::uint16_t version = TimestampWire::VERSION;
+        const std::uint16_t flags = 0;
+        std::memcpy(out + TimestampWire::MAGIC_OFFSET, &magic, sizeof(magic));
+        std::memcpy(out + TimestampWire::VERSION_OFFSET, &version, sizeof(version));
+        std::memcpy(out + TimestampWire::FLAGS_OFFSET, &flags, sizeof(flags));
+        std::memcpy(out + TimestampWire::SEQUENCE_OFFSET, &sequence, sizeof(sequence));
+        std::memcpy(out + TimestampWire::TIMESTAMP_OFFSET, &exchangeTimeNs, sizeof(exchangeTimeNs));
+    }
+
+private:
+    // memcpy of a scalar compiles to a single (possibly unaligned) load
+    template <typename T>
+    T read(std::size_t offset) const {
+        T value;
+        std::memcpy(&value, m_data + offset, sizeof(T));
+        return value;
+    }
+
+    const unsigned char* m_data;                         ///< Received bytes (not owned)
+    std::size_t m_length;                                ///< Number of received bytes
+};
+
+} // namespace TradingTimeCounter
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "TscClock.h"
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief One completed span in a trace buffer
+ */
+struct TraceEvent {
+    const char* name;                   ///< Span name (string literal, never freed)
+    std::int64_t startNs;               ///< Steady-clock start in ns
+    std::int64_t durationNs;            ///< Span length in ns
+};
+
+/**
+ * @brief Per-thread span recorder exported as Chrome trace-event JSON
+ *
+ * Each thread records into its own fixed-size ring buffer, created on the
+ * thread's first span: the owning thread writes an event and publishes it
+ * with one release store, with no lock or shared cache line on the
+ * recording path. Once a ring is full the oldest events are overwritten.
+ * A thread's ring outlives the thread so its spans still export; once
+ * they have been exported (or more than RETIRED_BUFFERS threads have
+ * exited since), the ring is handed to the next new thread instead of
+ * allocating another, so per-start timer threads do not grow the trace.
+ * The output loads in Perfetto (ui.perfetto.dev) and chrome://tracing.
+ *
+ * Call sites use TTC_TRACE_SCOPE, which compiles to nothing unless the
+ * library is built with TTC_ENABLE_TRACING.
+ */
+class Trace {
+public:
+    static const std::size_t BUFFER_EVENTS = 8192;       ///< Events kept per thread
+    static const std::size_t RETIRED_BUFFERS = 64;       ///< Exited threads' rings kept unexported before reuse
+
+    /**
+     * @brief Check if trace points are compiled into the library
+     * @return true if built with TTC_ENABLE_TRACING
+     */
+    static bool isCompiledIn();
+
+    /**
+     * @brief Get the current time used for spans (TscClock)
+     * @return Nanoseconds in the steady_clock epoch
+     */
+    static std::int64_t nowNs() {
+        return TscClock::nowNs();
+    }
+
+    /**
+     * @brief Record a completed span on the calling thread's buffer
+     * @param name Span name; must outlive the trace (use string literals)
+     * @param startNs Start time from nowNs()
+     * @param endNs End time from nowNs()
+     */
+    static void record(const char* name, std::int64_t startNs, std::int64_t endNs);
+
+    /**
+     * @brief Name the calling thread in exported traces
+     * @param name Thread name (copied)
+     */
+    static void setThreadName(const std::string& name);
+
+    /**
+     * @brief Write every buffered span as Chrome trace-event JSON
+     *
+     * Safe to call while other threads keep recording; spans that are
+     * overwritten during the export are left out.
+     * @param path Output file path
+     * @return true if successful, false otherwise
+     */
+    static bool writeChromeJson(const std::string& path);
+
+    /**
+     * @brief Get the number of spans currently held in all buffers
+     * @return Buffered span count
+     */
+    static std::size_t getBufferedCount();
+
+    /**
+     * @brief Get the number of thread rings allocated so far
+     * @return Ring count (live threads plus exited threads' rings kept or free for reuse)
+     */
+    static std::size_t getBufferCount();
+
+    /**
+     * @brief Discard all buffered spans
+     *
+     * Call only while no other thread is recording.
+     */
+    static void clear();
+};
+
+/**
+ * @brief Records the span from construction to destruction
+ */
+class TraceScope {
+public:
+    /**
+     * @brief Start a span
+     * @param name Span name (string literal)
+     */
+    explicit TraceScope(const char* name)
+        : m_name(name)
+        , m_startNs(Trace::nowNs()) {
+    }
+
+    /**
+     * @brief End the span and record it
+     */
+    ~TraceScope() {
+        Trace::record(m_name, m_startNs, Trace::nowNs());
+    }
+
+    // Disable copy constructor and assignment operator
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* m_name;                                  ///< Span name
+    std::int64_t m_startNs;                              ///< Start time
+};
+
+} // namespace TradingTimeCounter
+
+#define TTC_TRACE_CONCAT_INNER(a, b) a##b
+#define TTC_TRACE_CONCAT(a, b) TTC_TRACE_CONCAT_INNER(a, b)
+
+/// Trace the rest of the enclosing scope as a span named `name`; TTC_TRACE_THREAD_NAME names the thread
+#ifdef TTC_ENABLE_TRACING
+#define TTC_TRACE_SCOPE(name) ::TradingTimeCounter::TraceScope TTC_TRACE_CONCAT(ttcTraceScope, __LINE__)(name)
+#define TTC_TRACE_THREAD_NAME(name) ::TradingTimeCounter::Trace::setThreadName(name)
+#else
+#define TTC_TRACE_SCOPE(name) static_cast<void>(0)
+#define TTC_TRACE_THREAD_NAME(name) static_cast<void>(0)
+#endif
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include "CpuFeatures.h"
+
+#if defined(TTC_SIMD_X86) && defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(TTC_SIMD_X86)
+#include <x86intrin.h>
+#endif
+
+namespace TradingTimeCounter {
+
+#if defined(__SIZEOF_INT128__)
+/// 128-bit product used by TscClock::scaleCycles (__extension__ keeps -Wpedantic quiet)
+__extension__ typedef unsigned __int128 TscProduct;
+#endif
+
+/**
+ * @brief Where TscClock timestamps come from
+ */
+enum class TscClockSource {
+    Calibrating,        ///< First calibration window still open; steady clock meanwhile
+    Tsc,                ///< Calibrated time-stamp counter
+    SteadyClock         ///< TSC unusable; steady clock (vDSO clock_gettime on Linux)
+};
+
+/**
+ * @brief Cheap steady-clock timestamps from the calibrated time-stamp counter
+ *
+ * Timestamps are nanoseconds in the std::chrono::steady_clock epoch, so
+ * they mix freely with steady_clock values. With an invariant TSC a
+ * timestamp is one RDTSC and a fixed-point multiply (ns = base + cycles *
+ * mult >> 32) against parameters read through a sequence lock; no system
+ * call or vDSO page is touched.
+ *
+ * The rate is calibrated against the steady clock over the first
+ * CALIBRATION_NS after the first use and re-measured every
+ * RECALIBRATION_NS. A recalibration keeps the converted time continuous
+ * and slews it onto the steady clock over the next interval, so
+ * timestamps never step backwards. Without an invariant TSC, on non-x86
+ * builds, when the kernel does not use the TSC as its clocksource or when
+ * two calibration windows disagree, every call falls back to the steady
+ * clock.
+ */
+class TscClock {
+public:
+    static const std::int64_t CALIBRATION_NS = 10000000;     ///< First calibration window (10 ms)
+    static const std::int64_t RECALIBRATION_NS = 1000000000; ///< Interval between recalibrations (1 s)
+
+    /**
+     * @brief Get the current time
+     * @return Nanoseconds in the steady_clock epoch
+     */
+    static std::int64_t nowNs() {
+#ifdef TTC_SIMD_X86
+        if (s_source.load(std::memory_order_acquire) == TscClockSource::Tsc) {
+            for (bool recalibrated = false;; recalibrated = true) {
+                std::uint64_t cycles;
+                std::uint64_t baseCycles;
+                std::int64_t baseNs;
+                std::uint64_t mult;
+                std::uint32_t sequence;
+                do {
+                    sequence = s_sequence.load(std::memory_order_acquire);
+                    cycles = __rdtsc(); // After the parameters' base, never before
+                    baseCycles = s_baseCycles.load(std::memory_order_relaxed);
+                    baseNs = s_baseNs.load(std::memory_order_relaxed);
+                    mult = s_mult.load(std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                } while ((sequence & 1) != 0 || s_sequence.load(std::memory_order_relaxed) != sequence);
+                
+                std::uint64_t elapsed = cycles - baseCycles;
+                if (recalibrated || elapsed < s_intervalCycles.load(std::memory_order_relaxed)) {
+                    return baseNs + scaleCycles(elapsed, mult);
+                }
+                
+                // Due for recalibration: convert with the fresh parameters
+                recalibrate(cycles);
+                if (s_source.load(std::memory_order_acquire) != TscClockSource::Tsc) {
+                    break;
+                }
+            }
+        }
+#endif
+        return slowNowNs();
+    }
+
+    /**
+     * @brief Get the current time as a steady_clock time point
+     * @return Current time
+     */
+    static std::chrono::steady_clock::time_point now() {
+        return std::chrono::steady_clock::time_point(
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::nanoseconds(nowNs())));
+    }
+
+    /**
+     * @brief Get the active timestamp source (finishes calibration if due)
+     * @return Source
+     */
+    static TscClockSource getSource();
+
+    /**
+     * @brief Get a printable name for a source
+     * @param source Source
+     * @return Source name
+     */
+    static const char* getSourceName(TscClockSource source);
+
+    /**
+     * @brief Get the calibrated TSC rate
+     * @return Cycles per second, 0 if the TSC is not in use
+     */
+    static double getFrequencyHz();
+
+    /**
+     * @brief Block until the first calibration has finished
+     *
+     * Normally calibration completes in the background of the first
+     * CALIBRATION_NS of calls; benchmarks and tools can wait for it.
+     * @return Source in use afterwards
+     */
+    static TscClockSource waitForCalibration();
+
+private:
+    /**
+     * @brief Multiply elapsed cycles by the 32.32 fixed-point ns-per-cycle factor
+     */
+    static std::int64_t scaleCycles(std::uint64_t cycles, std::uint64_t mult) {
+#if defined(__SIZEOF_INT128__)
+        return static_cast<std::int64_t>((static_cast<TscProduct>(cycles) * mult) >> 32);
+#elif defined(_MSC_VER) && defined(_M_X64)
+        std::uint64_t high = 0;
+        std::uint64_t low = _umul128(cycles, mult, &high);
+        return static_cast<std::int64_t>(__shiftright128(low, high, 32));
+#else
+        return static_cast<std::int64_t>((cycles >> 16) * mult >> 16);
+#endif
+    }
+
+    /**
+     * @brief Steady-clock read used while calibrating and as the fallback
+     */
+    static std::int64_t slowNowNs();
+
+    /**
+     * @brief Re-measure the rate and publish new parameters (one thread at a time)
+     */
+    static void recalibrate(std::uint64_t cycles);
+
+private:
+    static std::atomic<TscClockSource> s_source;         ///< Active source
+    static std::atomic<std::uint32_t> s_sequence;        ///< Sequence lock over the parameters (odd = writing)
+    static std::atomic<std::uint64_t> s_baseCycles;      ///< TSC value at the last recalibration
+    static std::atomic<std::int64_t> s_baseNs;           ///< Converted time at s_baseCycles
+    static std::atomic<std::uint64_t> s_mult;            ///< ns per cycle, 32.32 fixed point
+    static std::atomic<std::uint64_t> s_intervalCycles;  ///< Cycles between recalibrations
+};
+
+} // namespace TradingTimeCounter
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include "IReferenceClock.h"
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief Manually advanced reference clock for replay and simulation
+ * 
+ * Time only moves when the owner calls advanceTo(), so a whole trading day
+ * can be driven through the countdown logic without real sleeping.
+ */
+class VirtualClock : public IReferenceClock {
+public:
+    /**
+     * @brief Construct virtual clock at the given time
+     * @param startNs Initial time in ns since Unix epoch
+     */
+    explicit VirtualClock(std::int64_t startNs = 0);
+    
+    /**
+     * @brief Move the clock to the given time
+     * @param nowNs New time in ns since Unix epoch
+     */
+    void advanceTo(std::int64_t nowNs);
+    
+    /**
+     * @brief Get current virtual time
+     * @return Nanoseconds since Unix epoch
+     */
+    std::int64_t nowNs() const;
+    
+    // IReferenceClock interface implementation
+    std::chrono::system_clock::time_point now() const override;
+
+private:
+    std::atomic<std::int64_t> m_nowNs;                   ///< Current virtual time (ns since epoch)
+};
+
+} // namespace TradingTimeCounter
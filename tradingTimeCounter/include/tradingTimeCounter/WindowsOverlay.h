@@ -3,17 +3,53 @@
 #ifdef _WIN32
 
 #include "IDisplayManager.h"
+#include "BuiltinGlyphRasterizer.h"
+#include "DashboardRenderer.h"
+#include "FrameCache.h"
+#include "IGlyphRasterizer.h"
+#include "SoftwareRenderer.h"
 #include <windows.h>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace TradingTimeCounter {
 
+/**
+ * @brief Glyph rasteriser backed by a GDI font
+ * 
+ * Draws each character once into a grayscale DIB with the overlay's font and
+ * reads back the coverage, so the configured font family is honoured while
+ * per-frame rendering stays in SoftwareRenderer.
+ */
+class GdiGlyphRasterizer : public IGlyphRasterizer {
+public:
+    GdiGlyphRasterizer();
+    
+    /**
+     * @brief Set the font used for rasterisation at one weight
+     * @param font Font handle (owned by the caller)
+     * @param bold true for the bold font, false for the regular one
+     */
+    void setFont(HFONT font, bool bold);
+    
+    // IGlyphRasterizer interface implementation
+    bool rasterize(const DisplayConfig& config, char ch, GlyphBitmap& glyph) override;
+
+private:
+    HFONT m_fonts[2];                               ///< Regular and bold fonts to rasterise with (not owned)
+};
+
 /**
  * @brief Windows-specific implementation of IDisplayManager
  * 
  * This class creates a layered window that stays on top of all other windows.
  * It supports transparency, custom fonts, colors, and mouse dragging.
+ * Text is rendered by SoftwareRenderer; the window only presents the
+ * resulting premultiplied framebuffer with UpdateLayeredWindow. Finished
+ * frames are kept in a FrameCache, so a repeated tick is a copy. Alert
+ * styles are resolved with the configuration (both font weights, packed
+ * colors, cache keys), so selectStyle() never creates a GDI object.
  */
 class WindowsOverlay : public IDisplayManager {
 public:
@@ -44,6 +80,16 @@ public:
     void destroy() override;
     void setCloseCallback(std::function<void()> callback) override;
     void setPositionChangeCallback(std::function<void(int, int)> callback) override;
+    void prewarmTexts(const std::vector<std::string>& texts) override;
+    bool updateDashboard(const std::vector<DashboardRow>& rows) override;
+    bool setStyles(const std::vector<DisplayStyle>& styles) override;
+    void selectStyle(std::size_t index) override;
+    
+    /**
+     * @brief Get frame cache hit rate and memory use
+     * @return Snapshot of the cache statistics
+     */
+    FrameCacheStats getFrameCacheStats() const;
 
 private:
     /**
@@ -54,15 +100,36 @@ private:
     
     /**
      * @brief Create or update font based on current config
+     * 
+     * Selects the built-in glyph atlas instead when the font family is
+     * BuiltinGlyphRasterizer::FONT_FAMILY, so no GDI font is created.
      */
     void updateFont();
     
     /**
-     * @brief Calculate text size for current font and text
-     * @param text Text to measure
-     * @return SIZE structure with width and height
+     * @brief Compute the frame-cache key of every style and select the current one
+     */
+    void resolveStyleHashes();
+    
+    /**
+     * @brief Copy a region of a frame to the window surface and present it
+     * @param frame Rendered or cached frame
+     * @param dirty Region of the frame that differs from the surface
+     */
+    void present(const Framebuffer& frame, const RenderRect& dirty);
+    
+    /**
+     * @brief Create or resize the DIB section used for presenting
+     * @param width Surface width
+     * @param height Surface height
+     * @return true if the surface is ready, false otherwise
+     */
+    bool ensureSurface(int width, int height);
+    
+    /**
+     * @brief Release the presenting surface
      */
-    SIZE calculateTextSize(const std::string& text);
+    void releaseSurface();
     
     /**
      * @brief Window procedure for handling Windows messages
@@ -88,11 +155,28 @@ private:
     HWND m_hwnd;                                    ///< Window handle
     HDC m_hdc;                                      ///< Device context
     HDC m_memDC;                                    ///< Memory device context
-    HBITMAP m_bitmap;                               ///< Bitmap for drawing
+    HBITMAP m_bitmap;                               ///< DIB section presented to the window
     HBITMAP m_oldBitmap;                            ///< Previous bitmap
-    HFONT m_font;                                   ///< Current font
+    void* m_surfaceBits;                            ///< Pixels of m_bitmap
+    int m_surfaceWidth;                             ///< Width of m_bitmap
+    int m_surfaceHeight;                            ///< Height of m_bitmap
+    HFONT m_font;                                   ///< Current font (regular weight)
+    HFONT m_boldFont;                               ///< Current font (bold weight)
     HFONT m_oldFont;                                ///< Previous font
     
+    // Rendering
+    SoftwareRenderer m_renderer;                    ///< Renders text into a BGRA framebuffer
+    std::shared_ptr<GdiGlyphRasterizer> m_glyphRasterizer; ///< Font-backed glyph source
+    FrameCache m_frameCache;                        ///< Finished frames by (text, config)
+    std::uint64_t m_configHash;                     ///< Frame-cache key of the config in the selected style
+    std::vector<DisplayStyle> m_styles;             ///< Style table (empty = configuration only)
+    std::vector<std::uint64_t> m_styleHashes;       ///< Frame-cache key per style
+    std::size_t m_style;                            ///< Selected style
+    bool m_surfaceMatchesRenderer;                  ///< Surface holds m_renderer's last frame
+    DashboardRenderer m_dashboard;                  ///< Renders dashboard rows into a BGRA framebuffer
+    std::vector<DashboardRow> m_dashboardRows;      ///< Rows last passed to updateDashboard()
+    bool m_showingDashboard;                        ///< Surface shows the dashboard, not the text
+    
     // Configuration and state
     DisplayConfig m_config;                         ///< Current display configuration
     std::string m_currentText;                      ///< Currently displayed text
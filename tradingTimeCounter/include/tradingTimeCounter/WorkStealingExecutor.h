@@ -0,0 +1,146 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "IExecutor.h"
+
+namespace TradingTimeCounter {
+
+/**
+ * @brief Counters reported by WorkStealingExecutor
+ */
+struct ExecutorStats {
+    std::uint64_t posted = 0;            ///< Tasks accepted (ordered tasks included)
+    std::uint64_t stolen = 0;            ///< Tasks taken from another worker's deque
+    std::uint64_t batches = 0;           ///< postBatch() hand-offs
+};
+
+/**
+ * @brief Thread pool with per-worker deques and work stealing
+ *
+ * Each worker runs tasks from the front of its own deque and, when that is
+ * empty, steals half of another worker's deque from the back, so a boundary
+ * storm posted as one batch spreads across all workers. Tasks posted from a
+ * worker stay on that worker; others are dealt round-robin. Ordered tasks
+ * go through one of a fixed set of lanes chosen by key; a lane runs its
+ * tasks one at a time, in post order, on whichever worker picks it up.
+ * Queued work is finished before the destructor returns.
+ */
+class WorkStealingExecutor : public IExecutor {
+public:
+    /**
+     * @brief Constructor - starts the workers
+     * @param threadCount Number of workers (0 = hardware concurrency)
+     */
+    explicit WorkStealingExecutor(std::size_t threadCount = 0);
+    
+    /**
+     * @brief Destructor - runs queued work and joins the workers
+     */
+    ~WorkStealingExecutor();
+    
+    // Disable copy constructor and assignment operator
+    WorkStealingExecutor(const WorkStealingExecutor&) = delete;
+    WorkStealingExecutor& operator=(const WorkStealingExecutor&) = delete;
+    
+    // IExecutor interface implementation
+    void post(std::function<void()> task) override;
+    void postOrdered(std::uint64_t key, std::function<void()> task) override;
+    void postBatch(std::vector<std::function<void()>>& tasks) override;
+    
+    /**
+     * @brief Get the number of workers
+     * @return Worker count
+     */
+    std::size_t getThreadCount() const;
+    
+    /**
+     * @brief Get execution counters
+     * @return Counters
+     */
+    ExecutorStats getStats() const;
+
+private:
+    /**
+     * @brief Worker thread and its deque
+     */
+    struct Worker {
+        std::mutex mutex;                                ///< Protects tasks
+        std::deque<std::function<void()>> tasks;         ///< Owner pops front, thieves take from back
+        std::thread thread;                              ///< Worker thread
+    };
+    
+    /**
+     * @brief Serial queue for ordered tasks
+     */
+    struct Lane {
+        std::mutex mutex;                                ///< Protects tasks and scheduled
+        std::deque<std::function<void()>> tasks;         ///< Pending ordered tasks
+        bool scheduled = false;                          ///< A drain task is queued or running
+    };
+    
+    /**
+     * @brief Worker thread function
+     * @param index Worker index
+     */
+    void workerThreadFunction(std::size_t index);
+    
+    /**
+     * @brief Take the next task from a worker's own deque
+     */
+    bool popLocal(std::size_t index, std::function<void()>& task);
+    
+    /**
+     * @brief Steal half of another worker's deque
+     */
+    bool steal(std::size_t thief, std::function<void()>& task);
+    
+    /**
+     * @brief Queue a task on a worker's deque
+     */
+    void push(std::size_t index, std::function<void()> task);
+    
+    /**
+     * @brief Pick the deque for a task posted from the current thread
+     */
+    std::size_t targetWorker();
+    
+    /**
+     * @brief Wake sleeping workers after tasks were queued
+     * @param count Number of tasks queued
+     */
+    void wakeWorkers(std::size_t count);
+    
+    /**
+     * @brief Run a lane's tasks in order until it is empty
+     */
+    void drainLane(Lane& lane);
+
+private:
+    static const std::size_t LANE_COUNT = 256;           ///< Ordered lanes (power of two)
+    static const std::size_t MAX_LANE_RUN = 64;          ///< Lane tasks per drain before yielding
+    
+    std::vector<std::unique_ptr<Worker>> m_workers;      ///< Workers and their deques
+    std::unique_ptr<Lane[]> m_lanes;                     ///< Ordered lanes
+    
+    std::atomic<std::size_t> m_queued;                   ///< Tasks in deques, not yet taken
+    std::atomic<std::size_t> m_sleeping;                 ///< Workers waiting for work
+    std::atomic<std::size_t> m_nextWorker;               ///< Round-robin cursor for external posts
+    std::mutex m_sleepMutex;                             ///< Protects the sleep wait
+    std::condition_variable m_sleepCondition;            ///< Signalled when work arrives or on stop
+    bool m_shouldStop;                                   ///< Stop request flag (guarded by m_sleepMutex)
+    
+    std::atomic<std::uint64_t> m_posted;                 ///< Tasks accepted
+    std::atomic<std::uint64_t> m_stolen;                 ///< Tasks stolen
+    std::atomic<std::uint64_t> m_batches;                ///< Batch hand-offs
+};
+
+} // namespace TradingTimeCounter
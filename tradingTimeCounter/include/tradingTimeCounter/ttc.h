@@ -0,0 +1,208 @@
+#pragma once
+
+/**
+ * @file ttc.h
+ * @brief Stable C ABI of libttc for in-process use by C and scripting hosts
+ *
+ * Timers are opaque handles. Polling functions write into caller-provided
+ * structs and buffers and never allocate. Every function is safe to call
+ * with a null handle (it fails with TTC_ERROR_INVALID_ARGUMENT), and no
+ * C++ exception crosses the ABI. Structs only ever grow at the end;
+ * check ttc_abi_version() against TTC_ABI_VERSION at load time.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#  if defined(TTC_BUILDING_LIBRARY)
+#    define TTC_API __declspec(dllexport)
+#  else
+#    define TTC_API __declspec(dllimport)
+#  endif
+#elif defined(__GNUC__)
+#  define TTC_API __attribute__((visibility("default")))
+#else
+#  define TTC_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** ABI version this header describes */
+#define TTC_ABI_VERSION 1
+
+/** Status codes returned by libttc functions */
+#define TTC_OK 0                            /**< Success */
+#define TTC_ERROR_INVALID_ARGUMENT (-1)     /**< Null handle or pointer, or value out of range */
+#define TTC_ERROR_BUFFER_TOO_SMALL (-2)     /**< Output buffer cannot hold the result */
+#define TTC_ERROR_INTERNAL (-3)             /**< Unexpected failure (e.g. out of memory) */
+
+/** Opaque countdown timer */
+typedef struct ttc_timer ttc_timer;
+
+/** Timer lifecycle states */
+typedef enum ttc_state {
+    TTC_STATE_STOPPED = 0,                  /**< Not started, stopped or reset */
+    TTC_STATE_RUNNING = 1,                  /**< Counting down */
+    TTC_STATE_COMPLETED = 2                 /**< Free-running countdown reached zero */
+} ttc_state;
+
+/** Timer notifications delivered to a ttc_callback */
+typedef enum ttc_event {
+    TTC_EVENT_UPDATE = 0,                   /**< Displayed second changed */
+    TTC_EVENT_COMPLETED = 1,                /**< Countdown reached zero (each bar close if aligned) */
+    TTC_EVENT_STARTED = 2,                  /**< Timer started */
+    TTC_EVENT_STOPPED = 3,                  /**< Timer stopped */
+    TTC_EVENT_RESYNC = 4                    /**< Deadline recomputed after a wall-clock jump */
+} ttc_event;
+
+/** Consistent view of a timer's state */
+typedef struct ttc_snapshot {
+    uint32_t remaining_ms;                  /**< Milliseconds remaining (rounded up) */
+    uint32_t state;                         /**< A ttc_state value */
+    uint32_t generation;                    /**< Bumped on every transition (24-bit, wraps) */
+    uint32_t reserved;                      /**< Zero */
+} ttc_snapshot;
+
+/** Position of a time within a daily trading session */
+typedef struct ttc_session_status {
+    int32_t in_session;                     /**< 1 between open and close, 0 otherwise */
+    int32_t seconds_to_open;                /**< Seconds to the next open, in (0, 86400] */
+    int32_t seconds_to_close;               /**< Seconds to the next close, in (0, 86400] */
+    int32_t reserved;                       /**< Zero */
+} ttc_session_status;
+
+/**
+ * @brief Timer notification callback
+ *
+ * Runs on the timer's own thread; keep it short and do not destroy the
+ * timer from inside it.
+ * @param context Pointer given to ttc_timer_set_callback()
+ * @param timer Timer that produced the event
+ * @param event A ttc_event value
+ * @param remaining_seconds Seconds remaining (for UPDATE and RESYNC), 0 otherwise
+ */
+typedef void (*ttc_callback)(void* context, ttc_timer* timer, int32_t event, int32_t remaining_seconds);
+
+/**
+ * @brief Get the ABI version of the loaded library
+ * @return TTC_ABI_VERSION the library was built with
+ */
+TTC_API uint32_t ttc_abi_version(void);
+
+/**
+ * @brief Create a free-running countdown
+ * @param duration_minutes Countdown length in minutes (positive)
+ * @return New timer, NULL on invalid argument or failure
+ */
+TTC_API ttc_timer* ttc_timer_create(int32_t duration_minutes);
+
+/**
+ * @brief Create a countdown to each wall-clock bar close
+ * @param period_minutes Bar length in minutes (positive)
+ * @return New timer, NULL on invalid argument or failure
+ */
+TTC_API ttc_timer* ttc_bar_timer_create(int32_t period_minutes);
+
+/**
+ * @brief Stop and free a timer
+ * @param timer Timer, or NULL (ignored)
+ */
+TTC_API void ttc_timer_destroy(ttc_timer* timer);
+
+/**
+ * @brief Start or resume a timer
+ * @param timer Timer
+ * @return TTC_OK or an error code
+ */
+TTC_API int32_t ttc_timer_start(ttc_timer* timer);
+
+/**
+ * @brief Stop a timer, keeping its remaining time
+ * @param timer Timer
+ * @return TTC_OK or an error code
+ */
+TTC_API int32_t ttc_timer_stop(ttc_timer* timer);
+
+/**
+ * @brief Reset a timer to its full duration (restarting it if it was running)
+ * @param timer Timer
+ * @return TTC_OK or an error code
+ */
+TTC_API int32_t ttc_timer_reset(ttc_timer* timer);
+
+/**
+ * @brief Read a timer's state in one consistent snapshot
+ * @param timer Timer
+ * @param snapshot Receives the state
+ * @return TTC_OK or an error code
+ */
+TTC_API int32_t ttc_timer_get_snapshot(const ttc_timer* timer, ttc_snapshot* snapshot);
+
+/**
+ * @brief Format a timer's remaining time as "MM:SS"
+ * @param timer Timer
+ * @param buffer Receives the null-terminated text
+ * @param size Buffer size in bytes (at least 6; minutes above 99 need more)
+ * @return TTC_OK or an error code
+ */
+TTC_API int32_t ttc_timer_format(const ttc_timer* timer, char* buffer, size_t size);
+
+/**
+ * @brief Register a callback for a timer's notifications
+ *
+ * Call while the timer is stopped. Pass NULL to remove the callback.
+ * @param timer Timer
+ * @param callback Function to call, or NULL
+ * @param context Passed back to the callback unchanged
+ * @return TTC_OK or an error code
+ */
+TTC_API int32_t ttc_timer_set_callback(ttc_timer* timer, ttc_callback callback, void* context);
+
+/**
+ * @brief Seconds from a time to the next bar boundary
+ *
+ * Boundaries are the instants t where (t - offset) is a multiple of the
+ * period; the result is in (0, period].
+ * @param now_seconds Time in seconds since Unix epoch
+ * @param period_seconds Bar length in seconds (positive)
+ * @param offset_seconds Boundary offset in seconds
+ * @return Seconds to the next boundary, or TTC_ERROR_INVALID_ARGUMENT
+ */
+TTC_API int32_t ttc_seconds_to_boundary(int64_t now_seconds, int32_t period_seconds, int32_t offset_seconds);
+
+/**
+ * @brief Seconds to the next boundary for many (period, offset) pairs
+ *
+ * Uses the SIMD kernels of the C++ library and gives the same results as
+ * ttc_seconds_to_boundary() for every pair, including offsets after
+ * now_seconds. Nothing is written if any period is not positive.
+ * @param periods Bar lengths in seconds (positive)
+ * @param offsets Boundary offsets in seconds
+ * @param count Number of pairs
+ * @param now_seconds Time in seconds since Unix epoch
+ * @param remaining Receives count results
+ * @return TTC_OK, or TTC_ERROR_INVALID_ARGUMENT for a null pointer or non-positive period
+ */
+TTC_API int32_t ttc_seconds_to_boundary_batch(const int32_t* periods, const int32_t* offsets, size_t count,
+                                              int64_t now_seconds, int32_t* remaining);
+
+/**
+ * @brief Locate a time within a daily session
+ *
+ * Open and close are offsets from UTC midnight; a close before the open
+ * describes an overnight session.
+ * @param now_seconds Time in seconds since Unix epoch
+ * @param open_utc_seconds Session open, in [0, 86400)
+ * @param close_utc_seconds Session close, in [0, 86400), different from the open
+ * @param status Receives the session position
+ * @return TTC_OK or an error code
+ */
+TTC_API int32_t ttc_session_status_at(int64_t now_seconds, int32_t open_utc_seconds, int32_t close_utc_seconds,
+                                      ttc_session_status* status);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,61 @@
+#include "tradingTimeCounter/AlertPlan.h"
+#include <algorithm>
+
+namespace TradingTimeCounter {
+
+// Static member definition
+const std::uint32_t AlertPlan::FLASH_PHASE_MS;
+
+void AlertPlan::addStage(const AlertStage& stage) {
+    auto position = std::lower_bound(m_stages.begin(), m_stages.end(), stage,
+                                     [](const AlertStage& a, const AlertStage& b) { return a.thresholdMs > b.thresholdMs; });
+    if (position != m_stages.end() && position->thresholdMs == stage.thresholdMs) {
+        *position = stage;
+    } else {
+        m_stages.insert(position, stage);
+    }
+}
+
+void AlertPlan::clear() {
+    m_stages.clear();
+}
+
+bool AlertPlan::isEmpty() const {
+    return m_stages.empty();
+}
+
+const std::vector<AlertStage>& AlertPlan::getStages() const {
+    return m_stages;
+}
+
+int AlertPlan::stageAt(std::uint32_t remainingMs) const {
+    int active = -1;
+    for (std::size_t i = 0; i < m_stages.size() && remainingMs <= m_stages[i].thresholdMs; ++i) {
+        active = static_cast<int>(i);
+    }
+    return active;
+}
+
+std::uint32_t AlertPlan::nextThresholdMs(std::uint32_t remainingMs) const {
+    for (const AlertStage& stage : m_stages) {
+        if (stage.thresholdMs < remainingMs) {
+            return stage.thresholdMs;
+        }
+    }
+    return 0;
+}
+
+bool AlertPlan::flashesAt(int stage) const {
+    return stage >= 0 && static_cast<std::size_t>(stage) < m_stages.size() &&
+           m_stages[stage].action == AlertAction::Flash;
+}
+
+bool AlertPlan::isFlashHighlighted(std::uint32_t remainingMs) {
+    return (remainingMs / FLASH_PHASE_MS + (remainingMs % FLASH_PHASE_MS != 0 ? 1 : 0)) % 2 == 0;
+}
+
+std::uint32_t AlertPlan::nextFlashToggleMs(std::uint32_t remainingMs) {
+    return remainingMs == 0 ? 0 : (remainingMs - 1) / FLASH_PHASE_MS * FLASH_PHASE_MS;
+}
+
+} // namespace TradingTimeCounter
@@ -1,4 +1,9 @@
 #include "tradingTimeCounter/App.h"
+#include "tradingTimeCounter/BoundaryBatch.h"
+#include "tradingTimeCounter/Trace.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <iostream>
 
 #ifdef _WIN32
@@ -10,12 +15,22 @@ namespace TradingTimeCounter {
 
 // Static member definition
 const int App::TIMER_DURATION_MINUTES;
+const bool App::ALIGN_TO_BARS;
+const int App::PREWARM_SECONDS;
+const char* const App::TRACE_FILE = "tradingTimeCounter.trace.json";
+const char* const App::BOUNDARY_SIGNAL_LABEL = "main";
 
 App::App()
     : m_timer(nullptr)
     , m_display(nullptr)
+    , m_clockWatcher(nullptr)
     , m_isRunning(false)
-    , m_shouldExit(false) {
+    , m_shouldExit(false)
+    , m_lastLoggedSeconds(-1)
+    , m_alertStage(-1)
+    , m_flashHighlighted(true)
+    , m_launchTime(std::chrono::steady_clock::now())
+    , m_boundarySlot(-1) {
 }
 
 App::~App() {
@@ -33,19 +48,43 @@ bool App::initialize(const DisplayConfig& displayConfig) {
             std::cerr << "Failed to create timer component" << std::endl;
             return false;
         }
+        m_timer->setWallClockAligned(ALIGN_TO_BARS);
+        m_timer->setPrecisionPolicy(DisplayPrecisionPolicy::adaptive());
+        
+        // Pre-warnings: amber at T-60s, red and bold at T-10s, flashing from T-3s
+        AlertPlan alerts;
+        alerts.addStage(AlertStage{60000, 1, AlertAction::None});
+        alerts.addStage(AlertStage{10000, 2, AlertAction::None});
+        alerts.addStage(AlertStage{3000, 2, AlertAction::Flash});
+        m_timer->setAlertPlan(alerts);
         
         // Set timer callback - create a proper shared_ptr
         auto selfCallback = std::shared_ptr<ITimerCallback>(std::shared_ptr<ITimerCallback>{}, this);
         m_timer->setCallback(selfCallback);
         
+        // Create clock watcher so bar-aligned deadlines survive clock jumps
+        m_clockWatcher = std::make_unique<ClockWatcher>();
+        m_clockWatcher->addTimer(m_timer.get());
+        
+        // Continue where the previous run left off
+        restoreState();
+        
+        // Let other local processes block on bar closes
+        if (!m_boundarySignalPath.empty() && m_boundaryPublisher.open(m_boundarySignalPath)) {
+            m_boundarySlot = m_boundaryPublisher.publish(BOUNDARY_SIGNAL_LABEL, TIMER_DURATION_MINUTES * 60);
+        }
+        
         // Create display component
         std::cout << "Creating display manager..." << std::endl;
-        m_display = createDisplayManager();
-        if (!m_display) {
+        std::unique_ptr<IDisplayManager> backend = createDisplayManager();
+        if (!backend) {
             std::cerr << "Failed to create display manager" << std::endl;
             return false;
         }
         
+        // Drop duplicate updates, coalesce bursts and skip rendering while hidden
+        m_display = std::make_unique<CoalescingDisplayManager>(std::move(backend));
+        
         // Initialize display
         std::cout << "Initializing display with config..." << std::endl;
         if (!m_display->initialize(m_displayConfig)) {
@@ -53,12 +92,15 @@ bool App::initialize(const DisplayConfig& displayConfig) {
             return false;
         }
         
+        // Alert styles are resolved once here; stage changes only swap the index
+        m_display->setStyles(buildAlertStyles(m_displayConfig));
+        
         // Set display callbacks
         m_display->setCloseCallback([this]() { onWindowCloseRequested(); });
         m_display->setPositionChangeCallback([this](int x, int y) { onWindowPositionChanged(x, y); });
         
         // Initial display update
-        m_display->updateText(m_timer->getFormattedTime());
+        refreshDisplay();
         
         std::cout << "Application initialized successfully" << std::endl;
         return true;
@@ -84,10 +126,22 @@ void App::start() {
     // Start timer
     m_timer->start();
     
+    auto firstFrame = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_launchTime);
+    std::cout << "First frame " << firstFrame.count() << " ms after launch" << std::endl;
+    
+    // Start watching for wall-clock jumps
+    if (m_clockWatcher && !m_clockWatcher->start()) {
+        std::cerr << "Clock watcher unavailable - timer will not resync after clock changes" << std::endl;
+    }
+    
     std::cout << "Application started - Timer: " << TIMER_DURATION_MINUTES << " minutes" << std::endl;
 }
 
 void App::stop() {
+    if (m_clockWatcher) {
+        m_clockWatcher->stop();
+    }
+    
     if (m_timer) {
         m_timer->stop();
     }
@@ -132,15 +186,31 @@ int App::run() {
 }
 
 void App::shutdown() {
+    // Keep the running state on disk so the next launch resumes it
+    m_stateFile.close();
+    
     stop();
+    m_boundaryPublisher.close();
     
     if (m_display) {
+        DisplayUpdateStats stats = m_display->getStats();
+        std::cout << "Display: " << stats.textUpdates + stats.configUpdates << " updates, "
+                  << stats.presents << " presented (" << stats.droppedDuplicates << " duplicate, "
+                  << stats.coalesced << " coalesced, " << stats.suppressedHidden << " while hidden, "
+                  << stats.styleUpdates << " style changes)" << std::endl;
+        
         m_display->destroy();
         m_display.reset();
     }
     
+    m_clockWatcher.reset();
     m_timer.reset();
     
+    // Spans of the last minutes, for diagnosing late flips
+    if (Trace::isCompiledIn() && Trace::writeChromeJson(TRACE_FILE)) {
+        std::cout << "Trace written to " << TRACE_FILE << std::endl;
+    }
+    
     std::cout << "Application shutdown complete" << std::endl;
 }
 
@@ -153,6 +223,8 @@ void App::updateDisplayConfig(const DisplayConfig& config) {
     
     if (m_display) {
         m_display->updateConfig(config);
+        m_display->setStyles(buildAlertStyles(config));
+        applyAlertStyle();
     }
 }
 
@@ -169,6 +241,7 @@ void App::togglePositionLock() {
 void App::resetTimer() {
     if (m_timer) {
         m_timer->reset();
+        persistState();
         std::cout << "Timer reset to " << TIMER_DURATION_MINUTES << " minutes" << std::endl;
     }
 }
@@ -177,34 +250,225 @@ const DisplayConfig& App::getDisplayConfig() const {
     return m_displayConfig;
 }
 
+void App::setStatePath(const std::string& path) {
+    m_statePath = path;
+}
+
+void App::setBoundarySignalPath(const std::string& path) {
+    m_boundarySignalPath = path;
+}
+
+void App::addDashboardTimer(const std::string& label, int periodSeconds, int offsetSeconds) {
+    m_dashboardPeriods.push_back(periodSeconds);
+    m_dashboardOffsets.push_back(offsetSeconds);
+    m_dashboardRemaining.push_back(0);
+    m_dashboardRows.push_back(DashboardRow{label, std::string()});
+    persistState();
+}
+
+void App::refreshDisplay() {
+    if (!m_display || !m_timer) {
+        return;
+    }
+    TTC_TRACE_SCOPE("App::refreshDisplay");
+    
+    if (m_dashboardRows.empty()) {
+        m_display->updateText(m_timer->getFormattedTime());
+        return;
+    }
+    
+    // Every dashboard countdown in one batch pass
+    std::int64_t nowSeconds = std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    BoundaryBatch::computeRemaining(m_dashboardPeriods.data(), m_dashboardOffsets.data(),
+                                    m_dashboardRows.size(), nowSeconds, m_dashboardRemaining.data());
+    DisplayPrecisionPolicy policy = m_timer->getPrecisionPolicy();
+    for (std::size_t i = 0; i < m_dashboardRows.size(); ++i) {
+        m_dashboardRows[i].value = policy.format(static_cast<std::uint32_t>(m_dashboardRemaining[i]) * 1000);
+    }
+    m_display->updateDashboard(m_dashboardRows);
+}
+
+std::vector<DisplayStyle> App::buildAlertStyles(const DisplayConfig& config) {
+    DisplayStyle amber = DisplayStyle::fromConfig(config);
+    amber.textColor = DisplayConfig::Color(255, 191, 0);
+    
+    DisplayStyle red = DisplayStyle::fromConfig(config);
+    red.textColor = DisplayConfig::Color(255, 40, 40);
+    red.isBold = true;
+    return {DisplayStyle::fromConfig(config), amber, red};
+}
+
+void App::applyAlertStyle() {
+    if (!m_display || !m_timer) {
+        return;
+    }
+    
+    // Timer callbacks and updateDisplayConfig() both land here; selecting
+    // under the lock means the last selection reflects the latest state
+    std::lock_guard<std::mutex> lock(m_alertMutex);
+    std::size_t style = 0;
+    const std::vector<AlertStage>& stages = m_timer->getAlertPlan().getStages();
+    if (m_alertStage >= 0 && static_cast<std::size_t>(m_alertStage) < stages.size()) {
+        const AlertStage& stage = stages[m_alertStage];
+        style = stage.styleIndex;
+        
+        // The timer reports each flash toggle
+        if (stage.action == AlertAction::Flash && !m_flashHighlighted) {
+            style = 0;
+        }
+    }
+    m_display->selectStyle(style);
+}
+
+void App::restoreState() {
+    if (m_statePath.empty()) {
+        return;
+    }
+    if (!m_stateFile.open(m_statePath)) {
+        std::cerr << "State file unavailable - timers will not survive a restart" << std::endl;
+        return;
+    }
+    
+    PersistedState state{};
+    if (m_stateFile.load(state)) {
+        // Timers added before initialize() take precedence over saved ones
+        if (m_dashboardRows.empty()) {
+            for (std::uint32_t i = 0; i < state.dashboardCount; ++i) {
+                const PersistedDashboardTimer& row = state.dashboard[i];
+                addDashboardTimer(std::string(row.label, strnlen(row.label, sizeof(row.label))),
+                                  row.periodSeconds, row.offsetSeconds);
+            }
+        }
+        
+        // Aligned countdowns follow the wall clock anyway; free-running ones
+        // resume towards their saved deadline, or from where they were stopped
+        const PersistedTimer& timer = state.timer;
+        bool sameTimer = timer.durationSeconds == TIMER_DURATION_MINUTES * 60
+            && (timer.wallClockAligned != 0) == ALIGN_TO_BARS;
+        if (sameTimer && !ALIGN_TO_BARS) {
+            switch (static_cast<CountdownState>(timer.state)) {
+            case CountdownState::Running:
+                m_timer->restoreDeadline(timer.deadlineNs);
+                break;
+            case CountdownState::Completed:
+                m_timer->restoreRemaining(0);
+                break;
+            case CountdownState::Stopped:
+                m_timer->restoreRemaining(timer.remainingMs);
+                break;
+            }
+        }
+        std::cout << "Restored state from " << m_statePath << " (" << state.dashboardCount
+                  << " dashboard timers)" << std::endl;
+    }
+    persistState();
+}
+
+void App::persistState() {
+    if (!m_timer || !m_stateFile.isOpen()) {
+        return;
+    }
+    
+    PersistedState state{};
+    CountdownSnapshot snapshot = m_timer->getSnapshot();
+    state.timer.durationSeconds = TIMER_DURATION_MINUTES * 60;
+    state.timer.state = static_cast<std::uint8_t>(snapshot.state);
+    state.timer.wallClockAligned = m_timer->isWallClockAligned() ? 1 : 0;
+    state.timer.remainingMs = snapshot.remainingMs;
+    state.timer.deadlineNs = m_timer->getDeadlineNs();
+    
+    state.dashboardCount = static_cast<std::uint32_t>(
+        std::min(m_dashboardRows.size(), PersistedState::MAX_DASHBOARD_TIMERS));
+    for (std::uint32_t i = 0; i < state.dashboardCount; ++i) {
+        PersistedDashboardTimer& row = state.dashboard[i];
+        std::strncpy(row.label, m_dashboardRows[i].label.c_str(), sizeof(row.label) - 1);
+        row.periodSeconds = m_dashboardPeriods[i];
+        row.offsetSeconds = m_dashboardOffsets[i];
+    }
+    m_stateFile.save(state);
+}
+
 // ITimerCallback interface implementation
 void App::onTimerUpdate(int remainingSeconds) {
+    TTC_TRACE_SCOPE("App::onTimerUpdate");
     if (m_display) {
-        m_display->updateText(m_timer->getFormattedTime());
+        applyAlertStyle();
+        refreshDisplay();
+        if (!m_dashboardRows.empty()) {
+            return;
+        }
+        
+        // Render the next few text changes while idle until the next update
+        DisplayPrecisionPolicy policy = m_timer->getPrecisionPolicy();
+        std::uint32_t remainingMs = m_timer->getSnapshot().remainingMs;
+        std::vector<std::string> upcoming;
+        for (int i = 0; i < PREWARM_SECONDS && remainingMs > 0; ++i) {
+            remainingMs = policy.nextChangeMs(remainingMs);
+            upcoming.push_back(policy.format(remainingMs));
+        }
+        m_display->prewarmTexts(upcoming);
     }
-    // Only log significant timer milestones to reduce output
-    if (remainingSeconds % 30 == 0 || remainingSeconds <= 10) {
+    // Only log significant timer milestones to reduce output, once per second
+    if ((remainingSeconds % 30 == 0 || remainingSeconds <= 10) && remainingSeconds != m_lastLoggedSeconds) {
+        m_lastLoggedSeconds = remainingSeconds;
         std::cout << "Timer: " << m_timer->getFormattedTime() << " remaining" << std::endl;
     }
 }
 
+void App::onTimerBoundary(std::int64_t boundaryNs) {
+    // Wake subscribers first; they are waiting on exactly this instant
+    if (m_boundarySlot >= 0) {
+        m_boundaryPublisher.signal(m_boundarySlot, boundaryNs);
+    }
+}
+
 void App::onTimerCompleted() {
     std::cout << "Timer completed!" << std::endl;
+    persistState();
     
     if (m_display) {
-        m_display->updateText("00:00");
+        m_display->updateText(m_timer->getPrecisionPolicy().format(0));
     }
     
     // Optional: Show completion notification or perform other actions
-    // For now, we keep the display showing 00:00
+    // For now, we keep the display showing zero
 }
 
 void App::onTimerStarted() {
     std::cout << "Timer started" << std::endl;
+    persistState();
 }
 
 void App::onTimerStopped() {
     std::cout << "Timer stopped" << std::endl;
+    persistState();
+}
+
+void App::onTimerResync(int remainingSeconds) {
+    std::cout << "Timer resynced to wall clock: " << remainingSeconds << "s remaining" << std::endl;
+    
+    refreshDisplay();
+}
+
+void App::onTimerAlert(int stage) {
+    {
+        std::lock_guard<std::mutex> lock(m_alertMutex);
+        m_alertStage = stage;
+        m_flashHighlighted = true;
+    }
+    if (stage >= 0) {
+        std::cout << "Alert stage " << stage + 1 << ": " << m_timer->getFormattedTime() << " remaining" << std::endl;
+    }
+    applyAlertStyle();
+}
+
+void App::onTimerFlash(bool highlighted) {
+    {
+        std::lock_guard<std::mutex> lock(m_alertMutex);
+        m_flashHighlighted = highlighted;
+    }
+    applyAlertStyle();
 }
 
 void App::onWindowCloseRequested() {
@@ -0,0 +1,45 @@
+#include "tradingTimeCounter/Arena.h"
+#include <algorithm>
+#include <cstdint>
+
+namespace TradingTimeCounter {
+
+// Static member definition
+const std::size_t Arena::DEFAULT_CHUNK_SIZE;
+
+Arena::Arena(std::size_t chunkSize)
+    : m_chunkSize(chunkSize)
+    , m_used(0)
+    , m_reserved(0) {
+}
+
+void* Arena::allocate(std::size_t bytes, std::size_t alignment) {
+    if (!m_chunks.empty()) {
+        Chunk& chunk = m_chunks.back();
+        std::uintptr_t base = reinterpret_cast<std::uintptr_t>(chunk.memory.get());
+        std::size_t offset = ((base + chunk.top + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1)) - base;
+        if (offset + bytes <= chunk.size) {
+            m_used += offset + bytes - chunk.top;
+            chunk.top = offset + bytes;
+            return chunk.memory.get() + offset;
+        }
+    }
+
+    // The rest of a full chunk is left unused
+    Chunk chunk;
+    chunk.size = std::max(m_chunkSize, bytes + alignment);
+    chunk.memory.reset(new unsigned char[chunk.size]);
+    m_reserved += chunk.size;
+    m_chunks.push_back(std::move(chunk));
+    return allocate(bytes, alignment);
+}
+
+ArenaStats Arena::getStats() const {
+    ArenaStats stats;
+    stats.used = m_used;
+    stats.reserved = m_reserved;
+    stats.chunks = m_chunks.size();
+    return stats;
+}
+
+} // namespace TradingTimeCounter
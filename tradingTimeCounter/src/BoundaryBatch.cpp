@@ -0,0 +1,110 @@
+#include "tradingTimeCounter/BoundaryBatch.h"
+
+#ifdef TTC_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace TradingTimeCounter {
+namespace BoundaryBatch {
+
+namespace {
+
+void computeScalar(const std::int32_t* periods, const std::int32_t* offsets, std::size_t count,
+                   std::int64_t nowSeconds, std::int32_t* remaining) {
+    for (std::size_t i = 0; i < count; ++i) {
+        std::int64_t intoPeriod = (nowSeconds - offsets[i]) % periods[i];
+        remaining[i] = static_cast<std::int32_t>(periods[i] - intoPeriod);
+    }
+}
+
+#ifdef TTC_SIMD_X86
+
+// x86 has no packed 64-bit integer divide, so the quotient is estimated in
+// double lanes and the remainder corrected to the exact integer result.
+// Every intermediate is an integer below 2^53 and therefore exact.
+
+// Adding and subtracting 2^52 + 2^51 rounds to the nearest integer (SSE2 has no floor)
+const double ROUND_MAGIC = 6755399441055744.0;
+
+TTC_TARGET_SSE2
+void computeSse2(const std::int32_t* periods, const std::int32_t* offsets, std::size_t count,
+                 std::int64_t nowSeconds, std::int32_t* remaining) {
+    const __m128d now = _mm_set1_pd(static_cast<double>(nowSeconds));
+    const __m128d magic = _mm_set1_pd(ROUND_MAGIC);
+    const __m128d zero = _mm_setzero_pd();
+
+    std::size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        __m128d period = _mm_cvtepi32_pd(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(periods + i)));
+        __m128d offset = _mm_cvtepi32_pd(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(offsets + i)));
+
+        __m128d elapsed = _mm_sub_pd(now, offset);
+        __m128d quotient = _mm_sub_pd(_mm_add_pd(_mm_div_pd(elapsed, period), magic), magic);
+        __m128d intoPeriod = _mm_sub_pd(elapsed, _mm_mul_pd(quotient, period));
+
+        // Rounded quotient may be one too large or too small
+        intoPeriod = _mm_add_pd(intoPeriod, _mm_and_pd(_mm_cmplt_pd(intoPeriod, zero), period));
+        intoPeriod = _mm_sub_pd(intoPeriod, _mm_and_pd(_mm_cmpge_pd(intoPeriod, period), period));
+
+        __m128i result = _mm_cvttpd_epi32(_mm_sub_pd(period, intoPeriod));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(remaining + i), result);
+    }
+
+    computeScalar(periods + i, offsets + i, count - i, nowSeconds, remaining + i);
+}
+
+TTC_TARGET_AVX2
+void computeAvx2(const std::int32_t* periods, const std::int32_t* offsets, std::size_t count,
+                 std::int64_t nowSeconds, std::int32_t* remaining) {
+    const __m256d now = _mm256_set1_pd(static_cast<double>(nowSeconds));
+    const __m256d zero = _mm256_setzero_pd();
+
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256d period = _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i*>(periods + i)));
+        __m256d offset = _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i*>(offsets + i)));
+
+        __m256d elapsed = _mm256_sub_pd(now, offset);
+        __m256d quotient = _mm256_floor_pd(_mm256_div_pd(elapsed, period));
+        __m256d intoPeriod = _mm256_sub_pd(elapsed, _mm256_mul_pd(quotient, period));
+
+        // Correctly rounded division can still land on the next integer
+        intoPeriod = _mm256_add_pd(intoPeriod, _mm256_and_pd(_mm256_cmp_pd(intoPeriod, zero, _CMP_LT_OQ), period));
+        intoPeriod = _mm256_sub_pd(intoPeriod, _mm256_and_pd(_mm256_cmp_pd(intoPeriod, period, _CMP_GE_OQ), period));
+
+        __m128i result = _mm256_cvttpd_epi32(_mm256_sub_pd(period, intoPeriod));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(remaining + i), result);
+    }
+
+    computeScalar(periods + i, offsets + i, count - i, nowSeconds, remaining + i);
+}
+
+#endif // TTC_SIMD_X86
+
+} // namespace
+
+void computeRemaining(const std::int32_t* periods, const std::int32_t* offsets, std::size_t count,
+                      std::int64_t nowSeconds, std::int32_t* remaining) {
+    computeRemainingWith(getSimdLevel(), periods, offsets, count, nowSeconds, remaining);
+}
+
+void computeRemainingWith(SimdLevel level, const std::int32_t* periods, const std::int32_t* offsets,
+                          std::size_t count, std::int64_t nowSeconds, std::int32_t* remaining) {
+    // Never run a kernel the CPU cannot execute
+    switch (clampSimdLevel(level)) {
+#ifdef TTC_SIMD_X86
+        case SimdLevel::AVX2:
+            computeAvx2(periods, offsets, count, nowSeconds, remaining);
+            return;
+        case SimdLevel::SSE2:
+            computeSse2(periods, offsets, count, nowSeconds, remaining);
+            return;
+#endif
+        default:
+            computeScalar(periods, offsets, count, nowSeconds, remaining);
+            return;
+    }
+}
+
+} // namespace BoundaryBatch
+} // namespace TradingTimeCounter
@@ -0,0 +1,330 @@
+#include "tradingTimeCounter/BoundarySignal.h"
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <iostream>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+namespace TradingTimeCounter {
+
+// Static member definition
+const std::size_t BoundaryPublisher::MAX_COUNTDOWNS;
+
+namespace {
+
+const std::uint32_t SIGNAL_FILE_MAGIC = 0x42435454;      // "TTCB" read as little-endian
+const std::uint32_t SIGNAL_FILE_VERSION = 1;
+
+/**
+ * @brief Signal file header
+ */
+struct SignalFileHeader {
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint32_t slotSize;
+    std::atomic<std::uint32_t> slotCount;               // Published slots; a slot is complete before it counts
+    char reserved[48];
+};
+
+/**
+ * @brief One published countdown, on its own cache line
+ */
+struct alignas(64) SignalSlot {
+    std::atomic<std::uint32_t> sequence;                // Futex word, bumped at every boundary
+    std::atomic<std::uint32_t> waiters;                 // Subscribers blocked or about to block
+    std::atomic<std::int64_t> boundaryNs;               // Last boundary signalled
+    std::int32_t periodSeconds;
+    char label[32];
+};
+
+static_assert(sizeof(std::atomic<std::uint32_t>) == 4 && std::atomic<std::uint32_t>::is_always_lock_free,
+              "Futex words must be plain lock-free 32-bit integers");
+static_assert(std::atomic<std::int64_t>::is_always_lock_free, "Shared atomics must be lock-free");
+static_assert(sizeof(SignalFileHeader) == 64, "SignalFileHeader must match the file layout");
+static_assert(sizeof(SignalSlot) == 64, "SignalSlot must match the file layout");
+
+const std::size_t SIGNAL_FILE_SIZE = sizeof(SignalFileHeader) + BoundaryPublisher::MAX_COUNTDOWNS * sizeof(SignalSlot);
+
+SignalFileHeader* headerOf(void* mapping) {
+    return static_cast<SignalFileHeader*>(mapping);
+}
+
+SignalSlot* slotAt(void* mapping, int index) {
+    return reinterpret_cast<SignalSlot*>(static_cast<char*>(mapping) + sizeof(SignalFileHeader)) + index;
+}
+
+bool headerValid(const SignalFileHeader* header) {
+    return header->magic == SIGNAL_FILE_MAGIC && header->version == SIGNAL_FILE_VERSION
+        && header->slotSize == sizeof(SignalSlot)
+        && header->slotCount.load(std::memory_order_acquire) <= BoundaryPublisher::MAX_COUNTDOWNS;
+}
+
+bool slotInRange(void* mapping, int slot) {
+    return mapping && slot >= 0
+        && static_cast<std::uint32_t>(slot) < headerOf(mapping)->slotCount.load(std::memory_order_acquire);
+}
+
+#ifdef __linux__
+/**
+ * @brief Map a signal file of the expected size
+ * @param path Path of the file
+ * @param create true to create or resize it
+ * @param owner Class name for error messages
+ * @param fresh Set if the file was created or resized
+ */
+void* mapSignalFile(const std::string& path, bool create, const char* owner, bool& fresh) {
+    int fd = ::open(path.c_str(), O_RDWR | O_CLOEXEC | (create ? O_CREAT : 0), 0644);
+    if (fd < 0) {
+        std::cerr << owner << ": Failed to open " << path << " (errno " << errno << ")" << std::endl;
+        return nullptr;
+    }
+
+    struct stat info {};
+    if (fstat(fd, &info) != 0) {
+        std::cerr << owner << ": Failed to stat " << path << " (errno " << errno << ")" << std::endl;
+        ::close(fd);
+        return nullptr;
+    }
+    fresh = static_cast<std::size_t>(info.st_size) != SIGNAL_FILE_SIZE;
+    if (fresh && !create) {
+        std::cerr << owner << ": " << path << " is not a boundary signal file" << std::endl;
+        ::close(fd);
+        return nullptr;
+    }
+    if (fresh && (ftruncate(fd, 0) != 0 || ftruncate(fd, static_cast<off_t>(SIGNAL_FILE_SIZE)) != 0)) {
+        std::cerr << owner << ": Failed to size " << path << " (errno " << errno << ")" << std::endl;
+        ::close(fd);
+        return nullptr;
+    }
+
+    void* mapping = mmap(nullptr, SIGNAL_FILE_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        std::cerr << owner << ": Failed to map " << path << " (errno " << errno << ")" << std::endl;
+        return nullptr;
+    }
+    return mapping;
+}
+
+long futex(std::atomic<std::uint32_t>* word, int operation, std::uint32_t value, const struct timespec* timeout) {
+    // Shared (not FUTEX_PRIVATE_FLAG) so waiters in other processes are found
+    return syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(word), operation, value, timeout, nullptr, 0);
+}
+#endif
+
+} // namespace
+
+BoundaryPublisher::BoundaryPublisher()
+    : m_mapping(nullptr) {
+}
+
+BoundaryPublisher::~BoundaryPublisher() {
+    close();
+}
+
+bool BoundaryPublisher::open(const std::string& path) {
+    close();
+
+#ifndef __linux__
+    std::cerr << "BoundaryPublisher: Futex boundary signals are not implemented for this platform (" << path << ")" << std::endl;
+    return false;
+#else
+    bool fresh = false;
+    void* mapping = mapSignalFile(path, true, "BoundaryPublisher", fresh);
+    if (!mapping) {
+        return false;
+    }
+
+    // Keep a valid file so attached subscribers stay attached across restarts
+    SignalFileHeader* header = headerOf(mapping);
+    if (!headerValid(header)) {
+        if (!fresh) {
+            std::cerr << "BoundaryPublisher: " << path << " has an invalid header, starting over" << std::endl;
+        }
+        std::memset(mapping, 0, SIGNAL_FILE_SIZE);
+        header->magic = SIGNAL_FILE_MAGIC;
+        header->version = SIGNAL_FILE_VERSION;
+        header->slotSize = sizeof(SignalSlot);
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_mapping = mapping;
+    return true;
+#endif
+}
+
+void BoundaryPublisher::close() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_mapping) {
+#ifdef __linux__
+        munmap(m_mapping, SIGNAL_FILE_SIZE);
+#endif
+        m_mapping = nullptr;
+    }
+}
+
+bool BoundaryPublisher::isOpen() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_mapping != nullptr;
+}
+
+int BoundaryPublisher::publish(const std::string& label, int periodSeconds) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_mapping) {
+        return -1;
+    }
+
+    SignalFileHeader* header = headerOf(m_mapping);
+    std::uint32_t count = header->slotCount.load(std::memory_order_acquire);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        SignalSlot* slot = slotAt(m_mapping, static_cast<int>(i));
+        if (std::strncmp(slot->label, label.c_str(), sizeof(slot->label) - 1) == 0) {
+            slot->periodSeconds = periodSeconds;
+            return static_cast<int>(i);
+        }
+    }
+    if (count >= MAX_COUNTDOWNS) {
+        std::cerr << "BoundaryPublisher: No free slot for " << label << std::endl;
+        return -1;
+    }
+
+    // Fill the slot before it becomes visible to subscribers
+    SignalSlot* slot = slotAt(m_mapping, static_cast<int>(count));
+    std::memset(slot->label, 0, sizeof(slot->label));
+    std::strncpy(slot->label, label.c_str(), sizeof(slot->label) - 1);
+    slot->periodSeconds = periodSeconds;
+    header->slotCount.store(count + 1, std::memory_order_release);
+    return static_cast<int>(count);
+}
+
+void BoundaryPublisher::signal(int slot, std::int64_t boundaryNs) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!slotInRange(m_mapping, slot)) {
+        return;
+    }
+
+    SignalSlot* target = slotAt(m_mapping, slot);
+    target->boundaryNs.store(boundaryNs, std::memory_order_relaxed);
+    target->sequence.fetch_add(1, std::memory_order_seq_cst);
+
+    // Pairs with the waiter count taken before a subscriber re-checks the
+    // sequence: either it sees the new sequence or we see it waiting
+#ifdef __linux__
+    if (target->waiters.load(std::memory_order_seq_cst) != 0) {
+        futex(&target->sequence, FUTEX_WAKE, INT_MAX, nullptr);
+    }
+#endif
+}
+
+BoundarySubscriber::BoundarySubscriber()
+    : m_mapping(nullptr) {
+}
+
+BoundarySubscriber::~BoundarySubscriber() {
+    close();
+}
+
+bool BoundarySubscriber::open(const std::string& path) {
+    close();
+
+#ifndef __linux__
+    std::cerr << "BoundarySubscriber: Futex boundary signals are not implemented for this platform (" << path << ")" << std::endl;
+    return false;
+#else
+    bool fresh = false;
+    void* mapping = mapSignalFile(path, false, "BoundarySubscriber", fresh);
+    if (!mapping) {
+        return false;
+    }
+    if (!headerValid(headerOf(mapping))) {
+        std::cerr << "BoundarySubscriber: " << path << " has an invalid header" << std::endl;
+        munmap(mapping, SIGNAL_FILE_SIZE);
+        return false;
+    }
+    m_mapping = mapping;
+    return true;
+#endif
+}
+
+void BoundarySubscriber::close() {
+    if (m_mapping) {
+#ifdef __linux__
+        munmap(m_mapping, SIGNAL_FILE_SIZE);
+#endif
+        m_mapping = nullptr;
+    }
+}
+
+bool BoundarySubscriber::isOpen() const {
+    return m_mapping != nullptr;
+}
+
+int BoundarySubscriber::find(const std::string& label) const {
+    if (!m_mapping) {
+        return -1;
+    }
+
+    std::uint32_t count = headerOf(m_mapping)->slotCount.load(std::memory_order_acquire);
+    for (std::uint32_t i = 0; i < count && i < BoundaryPublisher::MAX_COUNTDOWNS; ++i) {
+        const SignalSlot* slot = slotAt(m_mapping, static_cast<int>(i));
+        if (std::strncmp(slot->label, label.c_str(), sizeof(slot->label) - 1) == 0) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+std::uint32_t BoundarySubscriber::getSequence(int slot) const {
+    return slotInRange(m_mapping, slot) ? slotAt(m_mapping, slot)->sequence.load(std::memory_order_acquire) : 0;
+}
+
+std::int64_t BoundarySubscriber::getBoundaryNs(int slot) const {
+    return slotInRange(m_mapping, slot) ? slotAt(m_mapping, slot)->boundaryNs.load(std::memory_order_relaxed) : 0;
+}
+
+int BoundarySubscriber::getPeriodSeconds(int slot) const {
+    return slotInRange(m_mapping, slot) ? slotAt(m_mapping, slot)->periodSeconds : 0;
+}
+
+bool BoundarySubscriber::wait(int slot, std::uint32_t seen, std::chrono::milliseconds timeout) const {
+    if (!slotInRange(m_mapping, slot)) {
+        return false;
+    }
+    SignalSlot* target = slotAt(m_mapping, slot);
+    if (target->sequence.load(std::memory_order_acquire) != seen) {
+        return true;
+    }
+
+#ifdef __linux__
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    target->waiters.fetch_add(1, std::memory_order_seq_cst);
+    while (target->sequence.load(std::memory_order_seq_cst) == seen) {
+        auto remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - std::chrono::steady_clock::now());
+        if (remaining.count() <= 0) {
+            break;
+        }
+
+        // Sleeps only while the word still holds `seen`; EAGAIN and EINTR re-check
+        struct timespec relative {};
+        relative.tv_sec = static_cast<time_t>(remaining.count() / 1000000000);
+        relative.tv_nsec = static_cast<long>(remaining.count() % 1000000000);
+        futex(&target->sequence, FUTEX_WAIT, seen, &relative);
+    }
+    target->waiters.fetch_sub(1, std::memory_order_relaxed);
+#else
+    (void)timeout;
+#endif
+    return target->sequence.load(std::memory_order_acquire) != seen;
+}
+
+} // namespace TradingTimeCounter
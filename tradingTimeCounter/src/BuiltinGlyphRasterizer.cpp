@@ -0,0 +1,10 @@
+#include "tradingTimeCounter/BuiltinGlyphRasterizer.h"
+#include "tradingTimeCounter/GlyphAtlas.h"
+
+namespace TradingTimeCounter {
+
+bool BuiltinGlyphRasterizer::rasterize(const DisplayConfig& config, char ch, GlyphBitmap& glyph) {
+    return GlyphAtlas::rasterize(config.fontSize, config.isBold, ch, glyph);
+}
+
+} // namespace TradingTimeCounter
@@ -0,0 +1,232 @@
+#include "tradingTimeCounter/ClockWatcher.h"
+#include <algorithm>
+#include <cerrno>
+#include <iostream>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+namespace TradingTimeCounter {
+
+namespace {
+
+// Interval between suspend/resume checks; wall-clock sets wake the watcher immediately on Linux
+const int CHECK_INTERVAL_MS = 1000;
+
+#ifdef __linux__
+std::int64_t readClockNs(clockid_t clockId) {
+    timespec ts{};
+    clock_gettime(clockId, &ts);
+    return static_cast<std::int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+#endif
+
+} // namespace
+
+ClockWatcher::ClockWatcher()
+    : m_isRunning(false)
+    , m_shouldStop(false)
+    , m_discontinuityCount(0)
+    , m_jumpThreshold(500)
+    , m_watchThread(nullptr)
+#ifdef __linux__
+    , m_wallClockFd(-1)
+    , m_wakeFd(-1)
+#endif
+{
+}
+
+ClockWatcher::~ClockWatcher() {
+    stop();
+}
+
+void ClockWatcher::addTimer(CountdownTimer* timer) {
+    if (!timer) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_timersMutex);
+    if (std::find(m_timers.begin(), m_timers.end(), timer) == m_timers.end()) {
+        m_timers.push_back(timer);
+    }
+}
+
+void ClockWatcher::removeTimer(CountdownTimer* timer) {
+    std::lock_guard<std::mutex> lock(m_timersMutex);
+    m_timers.erase(std::remove(m_timers.begin(), m_timers.end(), timer), m_timers.end());
+}
+
+bool ClockWatcher::start() {
+    if (m_isRunning.load()) {
+        return true; // Already running
+    }
+
+#ifdef __linux__
+    m_wallClockFd = timerfd_create(CLOCK_REALTIME, TFD_CLOEXEC);
+    m_wakeFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (m_wallClockFd < 0 || m_wakeFd < 0 || !armWallClockTimer()) {
+        std::cerr << "ClockWatcher: Failed to create clock watch descriptors (errno " << errno << ")" << std::endl;
+        if (m_wallClockFd >= 0) {
+            close(m_wallClockFd);
+            m_wallClockFd = -1;
+        }
+        if (m_wakeFd >= 0) {
+            close(m_wakeFd);
+            m_wakeFd = -1;
+        }
+        return false;
+    }
+#endif
+
+    m_shouldStop.store(false);
+    m_isRunning.store(true);
+    m_watchThread = std::make_unique<std::thread>(&ClockWatcher::watchThreadFunction, this);
+    return true;
+}
+
+void ClockWatcher::stop() {
+    if (!m_isRunning.load()) {
+        return; // Not running
+    }
+
+    m_shouldStop.store(true);
+
+#ifdef __linux__
+    std::uint64_t one = 1;
+    ssize_t written = write(m_wakeFd, &one, sizeof(one));
+    (void)written;
+#else
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+    }
+    m_wakeCondition.notify_all();
+#endif
+
+    if (m_watchThread && m_watchThread->joinable()) {
+        m_watchThread->join();
+        m_watchThread.reset();
+    }
+
+#ifdef __linux__
+    close(m_wallClockFd);
+    close(m_wakeFd);
+    m_wallClockFd = -1;
+    m_wakeFd = -1;
+#endif
+
+    m_isRunning.store(false);
+}
+
+bool ClockWatcher::isRunning() const {
+    return m_isRunning.load();
+}
+
+void ClockWatcher::setJumpThreshold(std::chrono::milliseconds threshold) {
+    m_jumpThreshold = threshold;
+}
+
+std::uint64_t ClockWatcher::getDiscontinuityCount() const {
+    return m_discontinuityCount.load();
+}
+
+std::size_t ClockWatcher::resyncAll(ClockDiscontinuity reason) {
+    m_discontinuityCount.fetch_add(1);
+
+    std::size_t resynced = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_timersMutex);
+        for (CountdownTimer* timer : m_timers) {
+            if (timer->resync()) {
+                ++resynced;
+            }
+        }
+    }
+
+    std::cout << "ClockWatcher: "
+              << (reason == ClockDiscontinuity::WallClockSet ? "Wall clock changed" : "System resumed")
+              << ", resynced " << resynced << " timer(s)" << std::endl;
+    return resynced;
+}
+
+std::int64_t ClockWatcher::sampleClockOffset() const {
+#ifdef __linux__
+    // Grows by the time spent suspended; unaffected by wall-clock sets
+    return readClockNs(CLOCK_BOOTTIME) - readClockNs(CLOCK_MONOTONIC);
+#else
+    auto wall = std::chrono::system_clock::now().time_since_epoch();
+    auto steady = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(wall).count() -
+           std::chrono::duration_cast<std::chrono::nanoseconds>(steady).count();
+#endif
+}
+
+#ifdef __linux__
+bool ClockWatcher::armWallClockTimer() {
+    // Absolute expiry far in the future: only a clock set should ever wake us
+    itimerspec spec{};
+    spec.it_value.tv_sec = static_cast<time_t>(readClockNs(CLOCK_REALTIME) / 1000000000LL) + 365LL * 24 * 3600;
+    return timerfd_settime(m_wallClockFd, TFD_TIMER_ABSTIME | TFD_TIMER_CANCEL_ON_SET, &spec, nullptr) == 0;
+}
+
+void ClockWatcher::watchThreadFunction() {
+    std::int64_t lastOffset = sampleClockOffset();
+    const std::int64_t thresholdNs = std::chrono::duration_cast<std::chrono::nanoseconds>(m_jumpThreshold).count();
+
+    pollfd fds[2] = {
+        {m_wallClockFd, POLLIN, 0},
+        {m_wakeFd, POLLIN, 0}
+    };
+
+    while (!m_shouldStop.load()) {
+        int ready = poll(fds, 2, CHECK_INTERVAL_MS);
+        if (m_shouldStop.load()) {
+            break;
+        }
+
+        if (ready > 0 && (fds[0].revents & POLLIN)) {
+            std::uint64_t expirations = 0;
+            ssize_t result = read(m_wallClockFd, &expirations, sizeof(expirations));
+
+            // ECANCELED means CLOCK_REALTIME was set; re-arm either way
+            armWallClockTimer();
+            if (result < 0 && errno == ECANCELED) {
+                resyncAll(ClockDiscontinuity::WallClockSet);
+            }
+        }
+
+        std::int64_t offset = sampleClockOffset();
+        if (offset - lastOffset > thresholdNs) {
+            resyncAll(ClockDiscontinuity::SystemResume);
+        }
+        lastOffset = offset;
+    }
+}
+#else
+void ClockWatcher::watchThreadFunction() {
+    std::int64_t lastOffset = sampleClockOffset();
+    const std::int64_t thresholdNs = std::chrono::duration_cast<std::chrono::nanoseconds>(m_jumpThreshold).count();
+
+    std::unique_lock<std::mutex> lock(m_wakeMutex);
+    while (!m_shouldStop.load()) {
+        m_wakeCondition.wait_for(lock, std::chrono::milliseconds(CHECK_INTERVAL_MS));
+        if (m_shouldStop.load()) {
+            break;
+        }
+
+        // Wall clock moved relative to the steady clock: step or resume
+        std::int64_t offset = sampleClockOffset();
+        std::int64_t drift = offset - lastOffset;
+        if (drift > thresholdNs || drift < -thresholdNs) {
+            resyncAll(ClockDiscontinuity::WallClockSet);
+        }
+        lastOffset = offset;
+    }
+}
+#endif
+
+} // namespace TradingTimeCounter
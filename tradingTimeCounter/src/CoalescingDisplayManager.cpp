@@ -0,0 +1,376 @@
+#include "tradingTimeCounter/CoalescingDisplayManager.h"
+#include "tradingTimeCounter/Trace.h"
+#include "tradingTimeCounter/TscClock.h"
+
+namespace TradingTimeCounter {
+
+// Static member definition
+const int CoalescingDisplayManager::DEFAULT_FRAME_INTERVAL_MS;
+
+CoalescingDisplayManager::CoalescingDisplayManager(std::unique_ptr<IDisplayManager> backend,
+                                                   std::chrono::milliseconds frameInterval)
+    : m_backend(std::move(backend))
+    , m_frameInterval(frameInterval)
+    , m_hasPendingText(false)
+    , m_hasPendingConfig(false)
+    , m_backendStyle(0)
+    , m_pendingStyle(0)
+    , m_hasPendingStyle(false)
+    , m_hasPendingRows(false)
+    , m_showingDashboard(false)
+    , m_lastPresent()
+    , m_shouldStop(false)
+    , m_flushThread(nullptr) {
+}
+
+CoalescingDisplayManager::~CoalescingDisplayManager() {
+    stopFlushThread();
+}
+
+bool CoalescingDisplayManager::initialize(const DisplayConfig& config) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_backendConfig = config;
+    if (!m_backend->initialize(config)) {
+        return false;
+    }
+
+    if (!m_flushThread) {
+        m_shouldStop = false;
+        m_flushThread = std::make_unique<std::thread>(&CoalescingDisplayManager::flushThreadFunction, this);
+    }
+    return true;
+}
+
+void CoalescingDisplayManager::show() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Bring the backend up to date before it becomes visible
+    flushLocked();
+    m_backend->show();
+    m_flushCondition.notify_one();
+}
+
+void CoalescingDisplayManager::hide() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_backend->hide();
+}
+
+void CoalescingDisplayManager::updateText(const std::string& text) {
+    TTC_TRACE_SCOPE("CoalescingDisplayManager::updateText");
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_stats.textUpdates;
+
+    // Switching back from the dashboard is never a duplicate
+    const std::string& latest = m_hasPendingText ? m_pendingText : m_backendText;
+    if (text == latest && !m_hasPendingRows && !m_showingDashboard) {
+        ++m_stats.droppedDuplicates;
+        return;
+    }
+    m_hasPendingRows = false;
+
+    if (!m_backend->isVisible()) {
+        ++m_stats.suppressedHidden;
+        m_pendingText = text;
+        m_hasPendingText = true;
+        return;
+    }
+
+    // Present right away unless within a frame interval of the last present
+    auto now = TscClock::now();
+    if (!m_hasPendingText && !m_hasPendingConfig && !m_hasPendingStyle && canPresentLocked(now)) {
+        m_backend->updateText(text);
+        m_backendText = text;
+        m_showingDashboard = false;
+        m_lastPresent = now;
+        ++m_stats.presents;
+        return;
+    }
+
+    if (m_hasPendingText) {
+        ++m_stats.coalesced;
+    }
+    m_pendingText = text;
+    m_hasPendingText = true;
+    m_flushCondition.notify_one();
+}
+
+void CoalescingDisplayManager::prewarmTexts(const std::vector<std::string>& texts) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Nothing will be presented while hidden, so there is nothing to prepare
+    if (m_backend->isVisible()) {
+        m_backend->prewarmTexts(texts);
+    }
+}
+
+bool CoalescingDisplayManager::updateDashboard(const std::vector<DashboardRow>& rows) {
+    TTC_TRACE_SCOPE("CoalescingDisplayManager::updateDashboard");
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_stats.textUpdates;
+
+    const std::vector<DashboardRow>& latest = m_hasPendingRows ? m_pendingRows : m_backendRows;
+    if (rows == latest && !m_hasPendingText && m_showingDashboard) {
+        ++m_stats.droppedDuplicates;
+        return true;
+    }
+    m_hasPendingText = false;
+
+    if (!m_backend->isVisible()) {
+        ++m_stats.suppressedHidden;
+        m_pendingRows = rows;
+        m_hasPendingRows = true;
+        return true;
+    }
+
+    auto now = TscClock::now();
+    if (!m_hasPendingRows && !m_hasPendingConfig && !m_hasPendingStyle && canPresentLocked(now)) {
+        bool supported = m_backend->updateDashboard(rows);
+        m_backendRows = rows;
+        m_showingDashboard = true;
+        m_lastPresent = now;
+        ++m_stats.presents;
+        return supported;
+    }
+
+    if (m_hasPendingRows) {
+        ++m_stats.coalesced;
+    }
+    m_pendingRows = rows;
+    m_hasPendingRows = true;
+    m_flushCondition.notify_one();
+    return true;
+}
+
+void CoalescingDisplayManager::updateConfig(const DisplayConfig& config) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_stats.configUpdates;
+
+    const DisplayConfig& latest = m_hasPendingConfig ? m_pendingConfig : m_backendConfig;
+    if (sameConfig(config, latest)) {
+        ++m_stats.droppedDuplicates;
+        return;
+    }
+
+    if (!m_backend->isVisible()) {
+        ++m_stats.suppressedHidden;
+        m_pendingConfig = config;
+        m_hasPendingConfig = true;
+        return;
+    }
+
+    auto now = TscClock::now();
+    if (!m_hasPendingText && !m_hasPendingRows && !m_hasPendingConfig && !m_hasPendingStyle && canPresentLocked(now)) {
+        m_backend->updateConfig(config);
+        m_backendConfig = config;
+        m_lastPresent = now;
+        ++m_stats.presents;
+        return;
+    }
+
+    if (m_hasPendingConfig) {
+        ++m_stats.coalesced;
+    }
+    m_pendingConfig = config;
+    m_hasPendingConfig = true;
+    m_flushCondition.notify_one();
+}
+
+bool CoalescingDisplayManager::setStyles(const std::vector<DisplayStyle>& styles) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Resolving is configuration work; it is never deferred
+    m_backendStyle = 0;
+    m_hasPendingStyle = false;
+    return m_backend->setStyles(styles);
+}
+
+void CoalescingDisplayManager::selectStyle(std::size_t index) {
+    TTC_TRACE_SCOPE("CoalescingDisplayManager::selectStyle");
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_stats.styleUpdates;
+
+    std::size_t latest = m_hasPendingStyle ? m_pendingStyle : m_backendStyle;
+    if (index == latest) {
+        ++m_stats.droppedDuplicates;
+        return;
+    }
+
+    if (!m_backend->isVisible()) {
+        ++m_stats.suppressedHidden;
+        m_pendingStyle = index;
+        m_hasPendingStyle = true;
+        return;
+    }
+
+    auto now = TscClock::now();
+    if (!m_hasPendingText && !m_hasPendingRows && !m_hasPendingConfig && !m_hasPendingStyle && canPresentLocked(now)) {
+        m_backend->selectStyle(index);
+        m_backendStyle = index;
+        m_lastPresent = now;
+        ++m_stats.presents;
+        return;
+    }
+
+    if (m_hasPendingStyle) {
+        ++m_stats.coalesced;
+    }
+    m_pendingStyle = index;
+    m_hasPendingStyle = true;
+    m_flushCondition.notify_one();
+}
+
+void CoalescingDisplayManager::setPositionLocked(bool locked) {
+    m_backend->setPositionLocked(locked);
+}
+
+void CoalescingDisplayManager::getPosition(int& x, int& y) const {
+    m_backend->getPosition(x, y);
+}
+
+void CoalescingDisplayManager::setPosition(int x, int y) {
+    m_backend->setPosition(x, y);
+}
+
+bool CoalescingDisplayManager::isVisible() const {
+    return m_backend->isVisible();
+}
+
+void CoalescingDisplayManager::destroy() {
+    stopFlushThread();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_backend->destroy();
+}
+
+void CoalescingDisplayManager::setCloseCallback(std::function<void()> callback) {
+    m_backend->setCloseCallback(std::move(callback));
+}
+
+void CoalescingDisplayManager::setPositionChangeCallback(std::function<void(int, int)> callback) {
+    m_backend->setPositionChangeCallback(std::move(callback));
+}
+
+DisplayUpdateStats CoalescingDisplayManager::getStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+IDisplayManager* CoalescingDisplayManager::getBackend() const {
+    return m_backend.get();
+}
+
+void CoalescingDisplayManager::flushThreadFunction() {
+    TTC_TRACE_THREAD_NAME("CoalescingDisplayManager flush");
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (!m_shouldStop) {
+        // Sleep until there is something to present
+        m_flushCondition.wait(lock, [this]() {
+            return m_shouldStop
+                || ((m_hasPendingText || m_hasPendingConfig || m_hasPendingRows || m_hasPendingStyle) && m_backend->isVisible());
+        });
+        if (m_shouldStop) {
+            break;
+        }
+        ++m_stats.flushWakeups;
+
+        // Present the latest state at the end of the current frame interval
+        auto due = m_lastPresent + m_frameInterval;
+        if (m_flushCondition.wait_until(lock, due, [this]() { return m_shouldStop; })) {
+            break;
+        }
+        if (m_backend->isVisible()) {
+            flushLocked();
+        }
+    }
+}
+
+void CoalescingDisplayManager::stopFlushThread() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shouldStop = true;
+    }
+    m_flushCondition.notify_all();
+
+    if (m_flushThread && m_flushThread->joinable()) {
+        m_flushThread->join();
+        m_flushThread.reset();
+    }
+}
+
+void CoalescingDisplayManager::flushLocked() {
+    TTC_TRACE_SCOPE("CoalescingDisplayManager::flush");
+    bool presented = false;
+
+    if (m_hasPendingConfig) {
+        m_hasPendingConfig = false;
+        if (!sameConfig(m_pendingConfig, m_backendConfig)) {
+            m_backend->updateConfig(m_pendingConfig);
+            m_backendConfig = m_pendingConfig;
+            ++m_stats.presents;
+            presented = true;
+        } else {
+            ++m_stats.droppedDuplicates;
+        }
+    }
+
+    // Style before text, so a stage change and its text land in one frame
+    if (m_hasPendingStyle) {
+        m_hasPendingStyle = false;
+        if (m_pendingStyle != m_backendStyle) {
+            m_backend->selectStyle(m_pendingStyle);
+            m_backendStyle = m_pendingStyle;
+            ++m_stats.presents;
+            presented = true;
+        } else {
+            ++m_stats.droppedDuplicates;
+        }
+    }
+
+    if (m_hasPendingText) {
+        m_hasPendingText = false;
+        if (m_pendingText != m_backendText || m_showingDashboard) {
+            m_backend->updateText(m_pendingText);
+            m_backendText = m_pendingText;
+            m_showingDashboard = false;
+            ++m_stats.presents;
+            presented = true;
+        } else {
+            ++m_stats.droppedDuplicates;
+        }
+    }
+
+    if (m_hasPendingRows) {
+        m_hasPendingRows = false;
+        if (m_pendingRows != m_backendRows || !m_showingDashboard) {
+            m_backend->updateDashboard(m_pendingRows);
+            m_backendRows.swap(m_pendingRows);
+            m_showingDashboard = true;
+            ++m_stats.presents;
+            presented = true;
+        } else {
+            ++m_stats.droppedDuplicates;
+        }
+    }
+
+    if (presented) {
+        m_lastPresent = TscClock::now();
+    }
+}
+
+bool CoalescingDisplayManager::canPresentLocked(std::chrono::steady_clock::time_point now) const {
+    return now - m_lastPresent >= m_frameInterval;
+}
+
+bool CoalescingDisplayManager::sameConfig(const DisplayConfig& a, const DisplayConfig& b) {
+    return a.fontFamily == b.fontFamily && a.fontSize == b.fontSize && a.isBold == b.isBold
+        && a.textColor.r == b.textColor.r && a.textColor.g == b.textColor.g && a.textColor.b == b.textColor.b
+        && a.backgroundColor.r == b.backgroundColor.r && a.backgroundColor.g == b.backgroundColor.g
+        && a.backgroundColor.b == b.backgroundColor.b
+        && a.windowWidth == b.windowWidth && a.windowHeight == b.windowHeight
+        && a.positionX == b.positionX && a.positionY == b.positionY
+        && a.isDraggable == b.isDraggable && a.isLocked == b.isLocked && a.opacity == b.opacity;
+}
+
+} // namespace TradingTimeCounter
@@ -1,65 +1,229 @@
 #include "tradingTimeCounter/CountdownTimer.h"
-#include <sstream>
-#include <iomanip>
+#include "tradingTimeCounter/Trace.h"
+#include "tradingTimeCounter/TscClock.h"
+#include <algorithm>
+#include <cstdio>
+#include <limits>
 
 namespace TradingTimeCounter {
 
+namespace {
+
+// State word layout: remaining ms in bits 0-31, state in 32-39, generation in 40-63
+const int STATE_SHIFT = 32;
+const int GENERATION_SHIFT = 40;
+const std::uint32_t GENERATION_MASK = 0xFFFFFF;
+
+std::uint64_t packState(std::uint32_t remainingMs, CountdownState state, std::uint32_t generation) {
+    return static_cast<std::uint64_t>(remainingMs)
+        | static_cast<std::uint64_t>(state) << STATE_SHIFT
+        | static_cast<std::uint64_t>(generation & GENERATION_MASK) << GENERATION_SHIFT;
+}
+
+CountdownSnapshot unpackState(std::uint64_t word) {
+    CountdownSnapshot snapshot;
+    snapshot.remainingMs = static_cast<std::uint32_t>(word);
+    snapshot.state = static_cast<CountdownState>(static_cast<std::uint8_t>(word >> STATE_SHIFT));
+    snapshot.generation = static_cast<std::uint32_t>(word >> GENERATION_SHIFT);
+    return snapshot;
+}
+
+std::uint64_t packPolicy(const DisplayPrecisionPolicy& policy) {
+    return static_cast<std::uint64_t>(policy.minutesAboveMs) << 32 | policy.tenthsAtOrBelowMs;
+}
+
+DisplayPrecisionPolicy unpackPolicy(std::uint64_t word) {
+    DisplayPrecisionPolicy policy;
+    policy.minutesAboveMs = static_cast<std::uint32_t>(word >> 32);
+    policy.tenthsAtOrBelowMs = static_cast<std::uint32_t>(word);
+    return policy;
+}
+
+std::uint32_t unitMs(DisplayPrecision precision) {
+    switch (precision) {
+        case DisplayPrecision::Minutes:
+            return 60000;
+        case DisplayPrecision::Tenths:
+            return 100;
+        default:
+            return 1000;
+    }
+}
+
+std::uint32_t clampMilliseconds(std::int64_t milliseconds) {
+    if (milliseconds <= 0) {
+        return 0;
+    }
+    const std::int64_t maximum = std::numeric_limits<std::uint32_t>::max();
+    return static_cast<std::uint32_t>(milliseconds < maximum ? milliseconds : maximum);
+}
+
+} // namespace
+
+DisplayPrecisionPolicy DisplayPrecisionPolicy::fixedSeconds() {
+    return DisplayPrecisionPolicy();
+}
+
+DisplayPrecisionPolicy DisplayPrecisionPolicy::adaptive() {
+    DisplayPrecisionPolicy policy;
+    policy.minutesAboveMs = 3600000;
+    policy.tenthsAtOrBelowMs = 10000;
+    return policy;
+}
+
+DisplayPrecision DisplayPrecisionPolicy::precisionAt(std::uint32_t remainingMs) const {
+    if (remainingMs > minutesAboveMs) {
+        return DisplayPrecision::Minutes;
+    }
+    if (tenthsAtOrBelowMs > 0 && remainingMs <= tenthsAtOrBelowMs) {
+        return DisplayPrecision::Tenths;
+    }
+    return DisplayPrecision::Seconds;
+}
+
+std::uint32_t DisplayPrecisionPolicy::nextChangeMs(std::uint32_t remainingMs) const {
+    if (remainingMs == 0) {
+        return 0;
+    }
+    
+    // Text shows ceil(remaining / unit); it changes when that drops by one
+    // or when the next precision threshold is crossed, whichever comes first
+    DisplayPrecision precision = precisionAt(remainingMs);
+    std::uint64_t unit = unitMs(precision);
+    std::uint64_t next = ((remainingMs + unit - 1) / unit - 1) * unit;
+    std::uint32_t threshold = precision == DisplayPrecision::Minutes ? minutesAboveMs
+        : (precision == DisplayPrecision::Seconds ? tenthsAtOrBelowMs : 0);
+    return static_cast<std::uint32_t>(next > threshold ? next : threshold);
+}
+
+std::string DisplayPrecisionPolicy::format(std::uint32_t remainingMs) const {
+    DisplayPrecision precision = precisionAt(remainingMs);
+    std::uint64_t unit = unitMs(precision);
+    unsigned long long units = (remainingMs + unit - 1) / unit;
+    
+    // HH:MM and MM:SS both split the unit count by 60
+    char text[24];
+    if (precision == DisplayPrecision::Tenths) {
+        std::snprintf(text, sizeof(text), "%02llu.%llu", units / 10, units % 10);
+    } else {
+        std::snprintf(text, sizeof(text), "%02llu:%02llu", units / 60, units % 60);
+    }
+    return text;
+}
+
 CountdownTimer::CountdownTimer(int durationMinutes)
     : m_totalDuration(durationMinutes * 60)
-    , m_remainingSeconds(m_totalDuration)
-    , m_isRunning(false)
-    , m_shouldStop(false)
+    , m_state(packState(clampMilliseconds(static_cast<std::int64_t>(m_totalDuration) * 1000),
+                        CountdownState::Stopped, 0))
+    , m_wallClockAligned(false)
+    , m_deadline(0)
+    , m_boundary(0)
+    , m_precisionPolicy(packPolicy(DisplayPrecisionPolicy::fixedSeconds()))
+    , m_wakeups(0)
+    , m_wakeRequested(false)
     , m_callback(nullptr)
+    , m_referenceClock(nullptr)
+    , m_callbackExecutor(nullptr)
     , m_timerThread(nullptr) {
 }
 
 CountdownTimer::~CountdownTimer() {
     stop();
+    
+    // A completed countdown's thread exits on its own but is still joinable
+    if (m_timerThread && m_timerThread->joinable()) {
+        m_timerThread->join();
+    }
 }
 
 void CountdownTimer::setCallback(std::shared_ptr<ITimerCallback> callback) {
     m_callback = callback;
 }
 
+void CountdownTimer::setCallbackExecutor(std::shared_ptr<IExecutor> executor) {
+    m_callbackExecutor = executor;
+}
+
+void CountdownTimer::setReferenceClock(std::shared_ptr<IReferenceClock> clock) {
+    m_referenceClock = clock;
+}
+
+template <typename Event>
+void CountdownTimer::notify(Event event) {
+    if (!m_callback) {
+        return;
+    }
+    TTC_TRACE_SCOPE("CountdownTimer::notify");
+    
+    if (m_callbackExecutor) {
+        // Keyed by timer so one timer's notifications stay in order
+        std::shared_ptr<ITimerCallback> callback = m_callback;
+        m_callbackExecutor->postOrdered(reinterpret_cast<std::uintptr_t>(this),
+                                        [callback, event]() { event(*callback); });
+    } else {
+        event(*m_callback);
+    }
+}
+
 void CountdownTimer::start() {
-    if (m_isRunning.load()) {
+    CountdownSnapshot current = getSnapshot();
+    if (current.isRunning()) {
         return; // Already running
     }
     
-    m_shouldStop.store(false);
-    m_isRunning.store(true);
+    // Reap a thread that finished on its own (completed countdown)
+    if (m_timerThread && m_timerThread->joinable()) {
+        m_timerThread->join();
+    }
+    
+    // Arm the deadline: next wall-clock boundary or remaining duration
+    if (m_wallClockAligned.load()) {
+        armAlignedDeadline();
+    } else {
+        auto deadline = TscClock::now() + std::chrono::milliseconds(current.remainingMs);
+        m_deadline.store(deadline.time_since_epoch().count());
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_wakeRequested = false;
+    }
+    m_state.store(packState(millisecondsUntilDeadline(TscClock::now()), CountdownState::Running,
+                            current.generation + 1), std::memory_order_release);
+    
+    // Notify callback before the thread can post its first update
+    notify([](ITimerCallback& callback) { callback.onTimerStarted(); });
     
     // Create and start timer thread
     m_timerThread = std::make_unique<std::thread>(&CountdownTimer::timerThreadFunction, this);
-    
-    // Notify callback
-    if (m_callback) {
-        m_callback->onTimerStarted();
-    }
 }
 
 void CountdownTimer::stop() {
-    if (!m_isRunning.load()) {
-        return; // Not running
-    }
-    
-    m_shouldStop.store(true);
-    m_isRunning.store(false);
+    // Keep the remaining time so a later start() resumes from it
+    std::uint64_t word = m_state.load(std::memory_order_acquire);
+    CountdownSnapshot current;
+    do {
+        current = unpackState(word);
+        if (!current.isRunning()) {
+            return; // Not running
+        }
+        current = refreshRemaining(current);
+    } while (!m_state.compare_exchange_weak(word,
+                                            packState(current.remainingMs, CountdownState::Stopped, current.generation + 1),
+                                            std::memory_order_acq_rel, std::memory_order_acquire));
     
-    // Wait for thread to finish
+    // Wake the sleeping timer thread, then wait for it to finish
+    requestWakeup();
     if (m_timerThread && m_timerThread->joinable()) {
         m_timerThread->join();
         m_timerThread.reset();
     }
     
     // Notify callback
-    if (m_callback) {
-        m_callback->onTimerStopped();
-    }
+    notify([](ITimerCallback& callback) { callback.onTimerStopped(); });
 }
 
 void CountdownTimer::reset() {
-    bool wasRunning = m_isRunning.load();
+    bool wasRunning = isRunning();
     
     // Stop timer if running
     if (wasRunning) {
@@ -67,7 +231,9 @@ void CountdownTimer::reset() {
     }
     
     // Reset remaining time
-    m_remainingSeconds.store(m_totalDuration);
+    CountdownSnapshot current = getSnapshot();
+    m_state.store(packState(clampMilliseconds(static_cast<std::int64_t>(m_totalDuration) * 1000),
+                            CountdownState::Stopped, current.generation + 1), std::memory_order_release);
     
     // Restart if it was running
     if (wasRunning) {
@@ -75,63 +241,272 @@ void CountdownTimer::reset() {
     }
 }
 
+CountdownSnapshot CountdownTimer::getSnapshot() const {
+    return refreshRemaining(unpackState(m_state.load(std::memory_order_acquire)));
+}
+
 int CountdownTimer::getRemainingSeconds() const {
-    return m_remainingSeconds.load();
+    return getSnapshot().getRemainingSeconds();
 }
 
 bool CountdownTimer::isRunning() const {
-    return m_isRunning.load();
+    return getSnapshot().isRunning();
 }
 
 std::string CountdownTimer::getFormattedTime() const {
-    return formatTime(getRemainingSeconds());
+    TTC_TRACE_SCOPE("CountdownTimer::formatTime");
+    return getPrecisionPolicy().format(getSnapshot().remainingMs);
+}
+
+void CountdownTimer::setPrecisionPolicy(const DisplayPrecisionPolicy& policy) {
+    m_precisionPolicy.store(packPolicy(policy));
+    requestWakeup();
+}
+
+DisplayPrecisionPolicy CountdownTimer::getPrecisionPolicy() const {
+    return unpackPolicy(m_precisionPolicy.load());
+}
+
+DisplayPrecision CountdownTimer::getDisplayPrecision() const {
+    return getPrecisionPolicy().precisionAt(getSnapshot().remainingMs);
+}
+
+void CountdownTimer::setAlertPlan(const AlertPlan& plan) {
+    m_alertPlan = plan;
+}
+
+const AlertPlan& CountdownTimer::getAlertPlan() const {
+    return m_alertPlan;
+}
+
+int CountdownTimer::getAlertStage() const {
+    return m_alertPlan.stageAt(getSnapshot().remainingMs);
+}
+
+std::uint64_t CountdownTimer::getWakeupCount() const {
+    return m_wakeups.load(std::memory_order_relaxed);
+}
+
+void CountdownTimer::setWallClockAligned(bool aligned) {
+    m_wallClockAligned.store(aligned);
+}
+
+bool CountdownTimer::isWallClockAligned() const {
+    return m_wallClockAligned.load();
+}
+
+bool CountdownTimer::resync() {
+    if (!m_wallClockAligned.load() || !isRunning()) {
+        return false;
+    }
+    
+    armAlignedDeadline();
+    std::uint32_t remainingMs = millisecondsUntilDeadline(TscClock::now());
+    if (!publishRunning(remainingMs, CountdownState::Running, true)) {
+        return false;
+    }
+    requestWakeup();
+    int remaining = static_cast<int>((remainingMs + 999) / 1000);
+    
+    // Notify callback of resync
+    notify([remaining](ITimerCallback& callback) { callback.onTimerResync(remaining); });
+    return true;
+}
+
+std::int64_t CountdownTimer::getDeadlineNs() const {
+    if (!isRunning()) {
+        return 0;
+    }
+    if (m_wallClockAligned.load()) {
+        return m_boundary.load();
+    }
+    
+    std::chrono::steady_clock::time_point deadline(std::chrono::steady_clock::duration(m_deadline.load()));
+    return referenceNowNs() + std::chrono::duration_cast<std::chrono::nanoseconds>(
+        deadline - TscClock::now()).count();
+}
+
+bool CountdownTimer::restoreRemaining(std::uint32_t remainingMs) {
+    // Compare-and-swap so a concurrent start() is never overwritten
+    std::uint64_t word = m_state.load(std::memory_order_acquire);
+    CountdownSnapshot current;
+    do {
+        current = unpackState(word);
+        if (current.isRunning()) {
+            return false;
+        }
+    } while (!m_state.compare_exchange_weak(word,
+                                            packState(remainingMs, CountdownState::Stopped, current.generation + 1),
+                                            std::memory_order_acq_rel, std::memory_order_acquire));
+    return true;
+}
+
+bool CountdownTimer::restoreDeadline(std::int64_t deadlineNs) {
+    std::int64_t remainingNs = deadlineNs - referenceNowNs();
+    return restoreRemaining(clampMilliseconds((remainingNs + 999999) / 1000000));
 }
 
 void CountdownTimer::timerThreadFunction() {
-    auto lastUpdateTime = std::chrono::steady_clock::now();
+    TTC_TRACE_THREAD_NAME("CountdownTimer");
+    std::uint32_t changeAtMs = getPrecisionPolicy().nextChangeMs(unpackState(m_state.load()).remainingMs);
+    std::uint32_t alertAtMs = 0;
+    std::uint32_t flashAtMs = 0;
+    int alertStage = -1;
+    int flashHighlighted = -1;
+    bool replan = false;
     
-    while (!m_shouldStop.load() && m_remainingSeconds.load() > 0) {
-        auto currentTime = std::chrono::steady_clock::now();
-        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
-            currentTime - lastUpdateTime).count();
-        
-        // Update every 1000ms (1 second)
-        if (elapsed >= 1000) {
-            int remaining = m_remainingSeconds.load() - 1;
-            m_remainingSeconds.store(remaining);
-            lastUpdateTime = currentTime;
+    while (true) {
+        {
+            TTC_TRACE_SCOPE("CountdownTimer::wakeup");
+            m_wakeups.fetch_add(1, std::memory_order_relaxed);
+            std::uint32_t remainingMs = millisecondsUntilDeadline(TscClock::now());
+            if (!publishRunning(remainingMs, CountdownState::Running, false)) {
+                break; // Stopped
+            }
+            
+            // Alert stage first, so the display switches style before the text
+            int stage = m_alertPlan.stageAt(remainingMs);
+            if (stage != alertStage) {
+                alertStage = stage;
+                notify([stage](ITimerCallback& callback) { callback.onTimerAlert(stage); });
+            }
+            alertAtMs = m_alertPlan.nextThresholdMs(remainingMs);
+            
+            // A flashing stage toggles on a fixed grid of the remaining time
+            flashAtMs = 0;
+            if (m_alertPlan.flashesAt(stage) && remainingMs > 0) {
+                bool highlighted = AlertPlan::isFlashHighlighted(remainingMs);
+                if (flashHighlighted != static_cast<int>(highlighted)) {
+                    flashHighlighted = static_cast<int>(highlighted);
+                    notify([highlighted](ITimerCallback& callback) { callback.onTimerFlash(highlighted); });
+                }
+                flashAtMs = AlertPlan::nextFlashToggleMs(remainingMs);
+            } else {
+                flashHighlighted = -1;
+            }
             
-            // Notify callback of update
-            if (m_callback) {
-                m_callback->onTimerUpdate(remaining);
+            // Notify callback whenever the displayed text changes
+            if (remainingMs <= changeAtMs || replan) {
+                replan = false;
+                changeAtMs = getPrecisionPolicy().nextChangeMs(remainingMs);
+                int remaining = static_cast<int>((remainingMs + 999) / 1000);
+                notify([remaining](ITimerCallback& callback) { callback.onTimerUpdate(remaining); });
             }
             
             // Check if timer completed
-            if (remaining <= 0) {
-                m_isRunning.store(false);
-                if (m_callback) {
-                    m_callback->onTimerCompleted();
+            if (remainingMs == 0) {
+                if (!m_wallClockAligned.load()) {
+                    if (publishRunning(0, CountdownState::Completed, true)) {
+                        std::int64_t boundaryNs = referenceNowNs();
+                        notify([boundaryNs](ITimerCallback& callback) { callback.onTimerBoundary(boundaryNs); });
+                        notify([](ITimerCallback& callback) { callback.onTimerCompleted(); });
+                    }
+                    break;
+                }
+                
+                // Aligned timers re-arm for the following boundary, unless a
+                // resync moved the deadline since this wakeup read it
+                std::int64_t boundaryNs = 0;
+                if (!advanceAlignedDeadline(boundaryNs)) {
+                    replan = true;
+                    continue;
                 }
-                break;
+                notify([boundaryNs](ITimerCallback& callback) { callback.onTimerBoundary(boundaryNs); });
+                notify([](ITimerCallback& callback) { callback.onTimerCompleted(); });
+                publishRunning(millisecondsUntilDeadline(TscClock::now()), CountdownState::Running, true);
+                replan = true;
+                continue;
             }
         }
         
-        // Sleep for a short time to avoid busy waiting
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        // Sleep until the text next changes, the next alert threshold or
+        // flash toggle; stop(), resync() and policy changes cut the sleep short
+        std::chrono::steady_clock::time_point deadline(std::chrono::steady_clock::duration(m_deadline.load()));
+        std::uint32_t wakeAtMs = std::max(std::max(changeAtMs, alertAtMs), flashAtMs);
+        std::unique_lock<std::mutex> lock(m_wakeMutex);
+        m_wakeCondition.wait_until(lock, deadline - std::chrono::milliseconds(wakeAtMs),
+                                   [this]() { return m_wakeRequested || !unpackState(m_state.load()).isRunning(); });
+        replan = replan || m_wakeRequested;
+        m_wakeRequested = false;
     }
-    
-    m_isRunning.store(false);
 }
 
-std::string CountdownTimer::formatTime(int seconds) const {
-    int minutes = seconds / 60;
-    int remainingSeconds = seconds % 60;
+void CountdownTimer::armAlignedDeadline() {
+    const std::int64_t periodNs = static_cast<std::int64_t>(m_totalDuration) * 1000000000LL;
+    std::lock_guard<std::mutex> lock(m_armMutex);
+    std::int64_t referenceNow = referenceNowNs();
+    setAlignedDeadline(referenceNow - referenceNow % periodNs + periodNs);
+}
+
+bool CountdownTimer::advanceAlignedDeadline(std::int64_t& completedBoundaryNs) {
+    const std::int64_t periodNs = static_cast<std::int64_t>(m_totalDuration) * 1000000000LL;
+    std::lock_guard<std::mutex> lock(m_armMutex);
+    if (millisecondsUntilDeadline(TscClock::now()) > 0) {
+        return false;
+    }
+    completedBoundaryNs = m_boundary.load();
+    setAlignedDeadline(completedBoundaryNs + periodNs);
+    return true;
+}
+
+void CountdownTimer::setAlignedDeadline(std::int64_t boundaryNs) {
+    std::int64_t referenceNow = referenceNowNs();
+    auto steadyNow = TscClock::now();
+    m_boundary.store(boundaryNs);
     
-    std::ostringstream oss;
-    oss << std::setfill('0') << std::setw(2) << minutes 
-        << ":" << std::setfill('0') << std::setw(2) << remainingSeconds;
+    auto deadline = steadyNow + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::nanoseconds(boundaryNs - referenceNow));
+    m_deadline.store(deadline.time_since_epoch().count());
+}
+
+std::int64_t CountdownTimer::referenceNowNs() const {
+    auto now = m_referenceClock ? m_referenceClock->now() : std::chrono::system_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count();
+}
+
+CountdownSnapshot CountdownTimer::refreshRemaining(CountdownSnapshot snapshot) const {
+    // Never above the published value: a re-armed deadline counts once published
+    if (snapshot.isRunning()) {
+        std::uint32_t remainingMs = millisecondsUntilDeadline(TscClock::now());
+        snapshot.remainingMs = remainingMs < snapshot.remainingMs ? remainingMs : snapshot.remainingMs;
+    }
+    return snapshot;
+}
+
+void CountdownTimer::requestWakeup() {
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_wakeRequested = true;
+    }
+    m_wakeCondition.notify_all();
+}
+
+std::uint32_t CountdownTimer::millisecondsUntilDeadline(std::chrono::steady_clock::time_point now) const {
+    std::chrono::steady_clock::time_point deadline(std::chrono::steady_clock::duration(m_deadline.load()));
+    if (deadline <= now) {
+        return 0;
+    }
     
-    return oss.str();
+    auto remaining = std::chrono::ceil<std::chrono::milliseconds>(deadline - now);
+    return clampMilliseconds(remaining.count());
+}
+
+bool CountdownTimer::publishRunning(std::uint32_t remainingMs, CountdownState state, bool nextGeneration) {
+    // Compare-and-swap so a concurrent stop() is never overwritten
+    std::uint64_t word = m_state.load(std::memory_order_acquire);
+    CountdownSnapshot current;
+    std::uint64_t desired;
+    do {
+        current = unpackState(word);
+        if (!current.isRunning()) {
+            return false;
+        }
+        desired = packState(remainingMs, state, current.generation + (nextGeneration ? 1 : 0));
+        if (desired == word) {
+            return true;
+        }
+    } while (!m_state.compare_exchange_weak(word, desired, std::memory_order_acq_rel, std::memory_order_acquire));
+    return true;
 }
 
 } // namespace TradingTimeCounter
@@ -0,0 +1,91 @@
+#include "tradingTimeCounter/CpuFeatures.h"
+
+#if defined(TTC_SIMD_X86) && defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(TTC_SIMD_X86) && (defined(__GNUC__) || defined(__clang__))
+#include <cpuid.h>
+#endif
+
+namespace TradingTimeCounter {
+
+namespace {
+
+SimdLevel detectSimdLevel() {
+#if defined(TTC_SIMD_X86) && (defined(__GNUC__) || defined(__clang__))
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return SimdLevel::AVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return SimdLevel::SSE2;
+    }
+#elif defined(TTC_SIMD_X86) && defined(_MSC_VER)
+    int info[4] = {0, 0, 0, 0};
+    __cpuid(info, 0);
+    int maxLeaf = info[0];
+    __cpuid(info, 1);
+    bool hasSse2 = (info[3] & (1 << 26)) != 0;
+    bool hasOsxsave = (info[2] & (1 << 27)) != 0;
+    bool hasAvx = (info[2] & (1 << 28)) != 0;
+    if (maxLeaf >= 7 && hasOsxsave && hasAvx && (_xgetbv(0) & 0x6) == 0x6) {
+        __cpuidex(info, 7, 0);
+        if (info[1] & (1 << 5)) {
+            return SimdLevel::AVX2;
+        }
+    }
+    if (hasSse2) {
+        return SimdLevel::SSE2;
+    }
+#endif
+    return SimdLevel::Scalar;
+}
+
+bool detectInvariantTsc() {
+    // CPUID 0x80000007, EDX bit 8
+#if defined(TTC_SIMD_X86) && (defined(__GNUC__) || defined(__clang__))
+    unsigned int eax = 0;
+    unsigned int ebx = 0;
+    unsigned int ecx = 0;
+    unsigned int edx = 0;
+    if (__get_cpuid_max(0x80000000, nullptr) >= 0x80000007 && __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx)) {
+        return (edx & (1u << 8)) != 0;
+    }
+#elif defined(TTC_SIMD_X86) && defined(_MSC_VER)
+    int info[4] = {0, 0, 0, 0};
+    __cpuid(info, 0x80000000);
+    if (static_cast<unsigned int>(info[0]) >= 0x80000007) {
+        __cpuid(info, 0x80000007);
+        return (info[3] & (1 << 8)) != 0;
+    }
+#endif
+    return false;
+}
+
+} // namespace
+
+SimdLevel getSimdLevel() {
+    static const SimdLevel level = detectSimdLevel();
+    return level;
+}
+
+bool hasInvariantTsc() {
+    static const bool invariant = detectInvariantTsc();
+    return invariant;
+}
+
+SimdLevel clampSimdLevel(SimdLevel requested) {
+    return static_cast<int>(requested) > static_cast<int>(getSimdLevel()) ? SimdLevel::Scalar : requested;
+}
+
+const char* getSimdLevelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX2:
+            return "AVX2";
+        case SimdLevel::SSE2:
+            return "SSE2";
+        default:
+            return "Scalar";
+    }
+}
+
+} // namespace TradingTimeCounter
@@ -0,0 +1,169 @@
+#include "tradingTimeCounter/DashboardRenderer.h"
+#include "tradingTimeCounter/BuiltinGlyphRasterizer.h"
+#include "tradingTimeCounter/Trace.h"
+#include <algorithm>
+#include <iostream>
+
+namespace TradingTimeCounter {
+
+namespace {
+
+/**
+ * @brief Every printable ASCII character, for labels as well as values
+ */
+std::string printableCharacters() {
+    std::string characters;
+    for (char ch = ' '; ch <= '~'; ++ch) {
+        characters += ch;
+    }
+    return characters;
+}
+
+} // namespace
+
+DashboardRenderer::DashboardRenderer(PixelFormat format)
+    : m_framebuffer(format)
+    , m_rasterizer(std::make_shared<BuiltinGlyphRasterizer>())
+    , m_simdLevel(getSimdLevel())
+    , m_background(0)
+    , m_foreground(0)
+    , m_needsLayout(true)
+    , m_layoutCount(0)
+    , m_lastRedrawnCells(0) {
+}
+
+void DashboardRenderer::setGlyphRasterizer(std::shared_ptr<IGlyphRasterizer> rasterizer) {
+    m_rasterizer = rasterizer ? rasterizer : std::make_shared<BuiltinGlyphRasterizer>();
+}
+
+bool DashboardRenderer::configure(const DisplayConfig& config) {
+    m_background = m_framebuffer.packColor(config.backgroundColor, config.opacity);
+    m_foreground = m_framebuffer.packColor(config.textColor, config.opacity);
+
+    m_needsLayout = true;
+    if (!m_cells.build(*m_rasterizer, config, printableCharacters().c_str())) {
+        std::cerr << "DashboardRenderer: Glyph rasterizer produced no glyphs" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+RenderRect DashboardRenderer::render(const std::vector<DashboardRow>& rows) {
+    TTC_TRACE_SCOPE("DashboardRenderer::render");
+    if (m_needsLayout || !fitsLayout(rows)) {
+        layout(rows);
+        m_needsLayout = false;
+        return RenderRect{0, 0, m_layout.width, m_layout.height};
+    }
+
+    RenderRect dirty;
+    m_lastRedrawnCells = 0;
+    const int cellY = (m_layout.rowHeight - m_layout.cellHeight) / 2;
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        std::string aligned = alignValue(rows[i].value);
+        if (aligned == m_values[i]) {
+            continue;
+        }
+
+        // Only the cells whose character changed
+        int y = m_layout.padding + static_cast<int>(i) * m_layout.rowHeight + cellY;
+        for (std::size_t column = 0; column < aligned.size(); ++column) {
+            if (aligned[column] == m_values[i][column]) {
+                continue;
+            }
+            int x = m_layout.valueX + static_cast<int>(column) * m_layout.cellWidth;
+            m_cells.drawCell(m_framebuffer, x, y, aligned[column], m_background, m_foreground, m_simdLevel);
+            dirty.unite(RenderRect{x, y, m_layout.cellWidth, m_layout.cellHeight});
+            ++m_lastRedrawnCells;
+        }
+        m_values[i] = std::move(aligned);
+    }
+    return dirty;
+}
+
+void DashboardRenderer::invalidate() {
+    m_needsLayout = true;
+}
+
+const Framebuffer& DashboardRenderer::getFramebuffer() const {
+    return m_framebuffer;
+}
+
+const DashboardLayout& DashboardRenderer::getLayout() const {
+    return m_layout;
+}
+
+std::uint64_t DashboardRenderer::getLayoutCount() const {
+    return m_layoutCount;
+}
+
+std::size_t DashboardRenderer::getLastRedrawnCells() const {
+    return m_lastRedrawnCells;
+}
+
+void DashboardRenderer::setSimdLevel(SimdLevel level) {
+    m_simdLevel = clampSimdLevel(level);
+}
+
+bool DashboardRenderer::fitsLayout(const std::vector<DashboardRow>& rows) const {
+    if (rows.size() != m_labels.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        if (rows[i].label != m_labels[i] || static_cast<int>(rows[i].value.size()) > m_layout.valueColumns) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void DashboardRenderer::layout(const std::vector<DashboardRow>& rows) {
+    DashboardLayout layout;
+    layout.cellWidth = m_cells.getCellWidth();
+    layout.cellHeight = m_cells.getCellHeight();
+    layout.rowHeight = layout.cellHeight + layout.cellHeight / 4;
+    layout.padding = std::max(1, layout.cellWidth / 2);
+    for (const DashboardRow& row : rows) {
+        layout.labelColumns = std::max(layout.labelColumns, static_cast<int>(row.label.size()));
+        layout.valueColumns = std::max(layout.valueColumns, static_cast<int>(row.value.size()));
+    }
+
+    // One blank column between labels and values
+    int gap = layout.labelColumns > 0 ? 1 : 0;
+    layout.valueX = layout.padding + (layout.labelColumns + gap) * layout.cellWidth;
+    layout.width = layout.valueX + layout.valueColumns * layout.cellWidth + layout.padding;
+    layout.height = 2 * layout.padding + static_cast<int>(rows.size()) * layout.rowHeight;
+    m_layout = layout;
+
+    m_framebuffer.resize(layout.width, layout.height);
+    m_framebuffer.fill(RenderRect{0, 0, layout.width, layout.height}, m_background);
+
+    const int cellY = (layout.rowHeight - layout.cellHeight) / 2;
+    m_labels.clear();
+    m_values.clear();
+    m_lastRedrawnCells = 0;
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        int y = layout.padding + static_cast<int>(i) * layout.rowHeight + cellY;
+        m_labels.push_back(rows[i].label);
+        m_values.push_back(alignValue(rows[i].value));
+        drawText(layout.padding, y, m_labels.back());
+        drawText(layout.valueX, y, m_values.back());
+    }
+    ++m_layoutCount;
+}
+
+std::string DashboardRenderer::alignValue(const std::string& value) const {
+    std::string aligned(static_cast<std::size_t>(m_layout.valueColumns) - value.size(), ' ');
+    aligned += value;
+    return aligned;
+}
+
+void DashboardRenderer::drawText(int x, int y, const std::string& text) {
+    for (std::size_t i = 0; i < text.size(); ++i) {
+        m_cells.drawCell(m_framebuffer, x + static_cast<int>(i) * m_layout.cellWidth, y, text[i],
+                         m_background, m_foreground, m_simdLevel);
+        ++m_lastRedrawnCells;
+    }
+}
+
+} // namespace TradingTimeCounter
@@ -0,0 +1,163 @@
+#include "tradingTimeCounter/DeadlineScheduler.h"
+#include "tradingTimeCounter/Trace.h"
+#include <algorithm>
+#include <chrono>
+
+namespace TradingTimeCounter {
+
+DeadlineScheduler::DeadlineScheduler(std::shared_ptr<IReferenceClock> clock)
+    : m_clock(clock)
+    , m_nextDeadline(TimerTable::NEVER)
+    , m_isRunning(false)
+    , m_shouldStop(false)
+    , m_schedulerThread(nullptr) {
+}
+
+DeadlineScheduler::~DeadlineScheduler() {
+    stop();
+}
+
+void DeadlineScheduler::schedule(std::int64_t deadlineNs, IExecutor& executor, std::function<void()> task) {
+    bool earliest = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        
+        std::uint32_t id;
+        if (!m_freeWaiters.empty()) {
+            id = m_freeWaiters.back();
+            m_freeWaiters.pop_back();
+            m_waiters[id] = Waiter{&executor, std::move(task)};
+        } else {
+            id = static_cast<std::uint32_t>(m_waiters.size());
+            m_waiters.push_back(Waiter{&executor, std::move(task)});
+        }
+        
+        earliest = deadlineNs < m_nextDeadline;
+        if (earliest) {
+            m_nextDeadline = deadlineNs;
+        }
+        m_table.add(deadlineNs, 0, id);
+    }
+    
+    // Only an earlier deadline changes how long the thread should sleep
+    if (earliest) {
+        m_wakeCondition.notify_one();
+    }
+}
+
+std::size_t DeadlineScheduler::runDue(std::int64_t nowNs) {
+    std::vector<Waiter> due;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        collectDueLocked(nowNs, due);
+    }
+    
+    // Post outside the lock so tasks can schedule again
+    postDue(due);
+    return due.size();
+}
+
+void DeadlineScheduler::start() {
+    if (m_isRunning.load()) {
+        return; // Already running
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shouldStop = false;
+    }
+    m_isRunning.store(true);
+    m_schedulerThread = std::make_unique<std::thread>(&DeadlineScheduler::schedulerThreadFunction, this);
+}
+
+void DeadlineScheduler::stop() {
+    if (!m_isRunning.load()) {
+        return; // Not running
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shouldStop = true;
+    }
+    m_wakeCondition.notify_all();
+    
+    if (m_schedulerThread && m_schedulerThread->joinable()) {
+        m_schedulerThread->join();
+        m_schedulerThread.reset();
+    }
+    m_isRunning.store(false);
+}
+
+bool DeadlineScheduler::isRunning() const {
+    return m_isRunning.load();
+}
+
+std::int64_t DeadlineScheduler::nowNs() const {
+    auto now = m_clock ? m_clock->now() : std::chrono::system_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count();
+}
+
+std::size_t DeadlineScheduler::getPendingCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_table.size();
+}
+
+void DeadlineScheduler::schedulerThreadFunction() {
+    TTC_TRACE_THREAD_NAME("DeadlineScheduler");
+    std::vector<Waiter> due;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    
+    while (!m_shouldStop) {
+        std::int64_t now = nowNs();
+        collectDueLocked(now, due);
+        if (!due.empty()) {
+            lock.unlock();
+            postDue(due);
+            due.clear();
+            lock.lock();
+            continue;
+        }
+        
+        // Sleep until the earliest deadline, an earlier schedule() or stop()
+        if (m_nextDeadline == TimerTable::NEVER) {
+            m_wakeCondition.wait(lock);
+        } else {
+            m_wakeCondition.wait_for(lock, std::chrono::nanoseconds(m_nextDeadline - now));
+        }
+    }
+}
+
+void DeadlineScheduler::collectDueLocked(std::int64_t nowNs, std::vector<Waiter>& due) {
+    if (nowNs < m_nextDeadline || m_table.expire(nowNs, m_expired) == 0) {
+        return;
+    }
+    
+    // Earlier deadlines run first when one pass catches up on several
+    std::sort(m_expired.begin(), m_expired.end(), [](const ExpiredTimer& a, const ExpiredTimer& b) {
+        return a.deadlineNs < b.deadlineNs;
+    });
+    for (const ExpiredTimer& expired : m_expired) {
+        m_table.remove(expired.handle);
+        Waiter& waiter = m_waiters[expired.subscriberId];
+        due.push_back(Waiter{waiter.executor, std::move(waiter.task)});
+        waiter.task = nullptr;
+        m_freeWaiters.push_back(expired.subscriberId);
+    }
+    m_nextDeadline = m_table.nextDeadline();
+}
+
+void DeadlineScheduler::postDue(std::vector<Waiter>& due) {
+    TTC_TRACE_SCOPE("DeadlineScheduler::postDue");
+    // Consecutive waiters on the same executor are handed over as one batch
+    std::vector<std::function<void()>> batch;
+    batch.reserve(due.size());
+    for (std::size_t i = 0; i < due.size(); ++i) {
+        batch.push_back(std::move(due[i].task));
+        if (i + 1 == due.size() || due[i + 1].executor != due[i].executor) {
+            due[i].executor->postBatch(batch);
+            batch.clear();
+        }
+    }
+}
+
+} // namespace TradingTimeCounter
@@ -0,0 +1,253 @@
+#include "tradingTimeCounter/ExchangeClockSync.h"
+#include "tradingTimeCounter/TimestampMessage.h"
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace TradingTimeCounter {
+
+namespace {
+
+std::int64_t localNowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+} // namespace
+
+ExchangeClockSync::ExchangeClockSync()
+    : m_lastSequence(0)
+    , m_alpha(0.1)
+    , m_beta(0.005)
+    , m_latencyCompensationNs(0)
+    , m_acceptedCount(0)
+    , m_rejectedCount(0)
+    , m_socket(-1)
+    , m_wakePipe{-1, -1}
+    , m_isRunning(false)
+    , m_shouldStop(false)
+    , m_receiveThread(nullptr) {
+}
+
+ExchangeClockSync::~ExchangeClockSync() {
+    stop();
+    closeSocket();
+}
+
+bool ExchangeClockSync::openUdp(std::uint16_t port) {
+    closeSocket();
+
+    m_socket = socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    if (m_socket < 0) {
+        std::cerr << "ExchangeClockSync: Failed to create UDP socket (errno " << errno << ")" << std::endl;
+        return false;
+    }
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (bind(m_socket, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+        std::cerr << "ExchangeClockSync: Failed to bind 127.0.0.1:" << port << " (errno " << errno << ")" << std::endl;
+        closeSocket();
+        return false;
+    }
+    return true;
+}
+
+bool ExchangeClockSync::openUnixSocket(const std::string& path) {
+    closeSocket();
+
+    sockaddr_un addr{};
+    if (path.empty() || path.size() >= sizeof(addr.sun_path)) {
+        std::cerr << "ExchangeClockSync: Invalid Unix socket path" << std::endl;
+        return false;
+    }
+
+    m_socket = socket(AF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    if (m_socket < 0) {
+        std::cerr << "ExchangeClockSync: Failed to create Unix socket (errno " << errno << ")" << std::endl;
+        return false;
+    }
+
+    addr.sun_family = AF_UNIX;
+    std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+    unlink(path.c_str());
+    if (bind(m_socket, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+        std::cerr << "ExchangeClockSync: Failed to bind " << path << " (errno " << errno << ")" << std::endl;
+        closeSocket();
+        return false;
+    }
+    m_unixPath = path;
+    return true;
+}
+
+bool ExchangeClockSync::start() {
+    if (m_isRunning.load()) {
+        return true; // Already running
+    }
+    if (m_socket < 0) {
+        std::cerr << "ExchangeClockSync: Cannot start - no socket opened" << std::endl;
+        return false;
+    }
+    if (pipe(m_wakePipe) != 0) {
+        std::cerr << "ExchangeClockSync: Failed to create wake pipe (errno " << errno << ")" << std::endl;
+        return false;
+    }
+
+    m_shouldStop.store(false);
+    m_isRunning.store(true);
+    m_receiveThread = std::make_unique<std::thread>(&ExchangeClockSync::receiveThreadFunction, this);
+    return true;
+}
+
+void ExchangeClockSync::stop() {
+    if (!m_isRunning.load()) {
+        return; // Not running
+    }
+
+    m_shouldStop.store(true);
+    char wake = 1;
+    ssize_t written = write(m_wakePipe[1], &wake, sizeof(wake));
+    (void)written;
+
+    if (m_receiveThread && m_receiveThread->joinable()) {
+        m_receiveThread->join();
+        m_receiveThread.reset();
+    }
+
+    close(m_wakePipe[0]);
+    close(m_wakePipe[1]);
+    m_wakePipe[0] = m_wakePipe[1] = -1;
+    m_isRunning.store(false);
+}
+
+bool ExchangeClockSync::isRunning() const {
+    return m_isRunning.load();
+}
+
+bool ExchangeClockSync::processMessage(const unsigned char* data, std::size_t length, std::int64_t localNs) {
+    TimestampMessageView message(data, length);
+    if (!message.isValid()) {
+        m_rejectedCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_estimateMutex);
+
+    // Drop duplicates and reordered datagrams
+    std::uint64_t sequence = message.sequence();
+    if (m_estimate.isSynchronised && sequence <= m_lastSequence) {
+        m_rejectedCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    std::int64_t measured = message.exchangeTimeNs() - localNs + m_latencyCompensationNs;
+    if (!m_estimate.isSynchronised) {
+        m_estimate.offsetNs = measured;
+        m_estimate.drift = 0.0;
+        m_estimate.isSynchronised = true;
+    } else {
+        // Alpha-beta filter: predict from drift, then correct by the residual
+        double elapsed = static_cast<double>(localNs - m_estimate.lastLocalNs);
+        double predicted = static_cast<double>(m_estimate.offsetNs) + m_estimate.drift * elapsed;
+        double residual = static_cast<double>(measured) - predicted;
+        m_estimate.offsetNs = static_cast<std::int64_t>(predicted + m_alpha * residual);
+        if (elapsed > 0.0) {
+            m_estimate.drift += m_beta * residual / elapsed;
+        }
+    }
+    m_estimate.lastLocalNs = localNs;
+    m_lastSequence = sequence;
+
+    m_acceptedCount.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void ExchangeClockSync::setFilterGains(double alpha, double beta) {
+    std::lock_guard<std::mutex> lock(m_estimateMutex);
+    m_alpha = alpha;
+    m_beta = beta;
+}
+
+void ExchangeClockSync::setLatencyCompensation(std::int64_t latencyNs) {
+    std::lock_guard<std::mutex> lock(m_estimateMutex);
+    m_latencyCompensationNs = latencyNs;
+}
+
+ClockOffsetEstimate ExchangeClockSync::getEstimate() const {
+    std::lock_guard<std::mutex> lock(m_estimateMutex);
+    return m_estimate;
+}
+
+std::uint64_t ExchangeClockSync::getAcceptedCount() const {
+    return m_acceptedCount.load();
+}
+
+std::uint64_t ExchangeClockSync::getRejectedCount() const {
+    return m_rejectedCount.load();
+}
+
+std::chrono::system_clock::time_point ExchangeClockSync::now() const {
+    std::int64_t local = localNowNs();
+    ClockOffsetEstimate estimate = getEstimate();
+
+    // Fall back to local time until the first sample arrives
+    std::int64_t offset = 0;
+    if (estimate.isSynchronised) {
+        offset = estimate.offsetNs + static_cast<std::int64_t>(estimate.drift * static_cast<double>(local - estimate.lastLocalNs));
+    }
+
+    return std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(local + offset)));
+}
+
+void ExchangeClockSync::receiveThreadFunction() {
+    unsigned char buffer[256];
+    pollfd fds[2] = {
+        {m_socket, POLLIN, 0},
+        {m_wakePipe[0], POLLIN, 0}
+    };
+
+    while (!m_shouldStop.load()) {
+        if (poll(fds, 2, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            std::cerr << "ExchangeClockSync: poll failed (errno " << errno << ")" << std::endl;
+            break;
+        }
+        if (m_shouldStop.load() || (fds[1].revents & POLLIN)) {
+            break;
+        }
+
+        if (fds[0].revents & POLLIN) {
+            ssize_t received = recv(m_socket, buffer, sizeof(buffer), MSG_DONTWAIT);
+            std::int64_t localNs = localNowNs();
+            if (received > 0) {
+                processMessage(buffer, static_cast<std::size_t>(received), localNs);
+            }
+        }
+    }
+}
+
+void ExchangeClockSync::closeSocket() {
+    if (m_socket >= 0) {
+        close(m_socket);
+        m_socket = -1;
+    }
+    if (!m_unixPath.empty()) {
+        unlink(m_unixPath.c_str());
+        m_unixPath.clear();
+    }
+}
+
+} // namespace TradingTimeCounter
@@ -0,0 +1,152 @@
+#include "tradingTimeCounter/FrameCache.h"
+#include "tradingTimeCounter/SoftwareRenderer.h"
+#include <functional>
+
+namespace TradingTimeCounter {
+
+namespace {
+
+// FNV-1a, 64-bit
+const std::uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+const std::uint64_t FNV_PRIME = 1099511628211ULL;
+
+void hashBytes(std::uint64_t& hash, const void* data, std::size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * FNV_PRIME;
+    }
+}
+
+void hashInt(std::uint64_t& hash, int value) {
+    hashBytes(hash, &value, sizeof(value));
+}
+
+} // namespace
+
+// Static member definition
+const std::size_t FrameCache::DEFAULT_MEMORY_BUDGET;
+
+FrameCache::FrameCache(std::size_t memoryBudget) {
+    m_stats.memoryBudget = memoryBudget;
+}
+
+std::uint64_t FrameCache::hashConfig(const DisplayConfig& config) {
+    std::uint64_t hash = FNV_OFFSET_BASIS;
+    hashBytes(hash, config.fontFamily.data(), config.fontFamily.size());
+    hashInt(hash, config.fontSize);
+    hashInt(hash, config.isBold ? 1 : 0);
+    hashInt(hash, config.textColor.r);
+    hashInt(hash, config.textColor.g);
+    hashInt(hash, config.textColor.b);
+    hashInt(hash, config.backgroundColor.r);
+    hashInt(hash, config.backgroundColor.g);
+    hashInt(hash, config.backgroundColor.b);
+    hashInt(hash, config.windowWidth);
+    hashInt(hash, config.windowHeight);
+    hashInt(hash, config.opacity);
+    return hash;
+}
+
+std::shared_ptr<const Framebuffer> FrameCache::find(const std::string& text, std::uint64_t configHash) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_index.find(Key{text, configHash});
+    if (it == m_index.end()) {
+        ++m_stats.misses;
+        return nullptr;
+    }
+
+    ++m_stats.hits;
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    return it->second->frame;
+}
+
+void FrameCache::insert(const std::string& text, std::uint64_t configHash, std::shared_ptr<const Framebuffer> frame) {
+    if (!frame) {
+        return;
+    }
+
+    Key key{text, configHash};
+    std::size_t bytes = frameBytes(key, *frame);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_index.find(key);
+    if (it != m_index.end()) {
+        m_stats.memoryBytes -= it->second->bytes;
+        m_entries.erase(it->second);
+        m_index.erase(it);
+    }
+
+    m_entries.push_front(Entry{key, std::move(frame), bytes});
+    m_index.emplace(std::move(key), m_entries.begin());
+    m_stats.memoryBytes += bytes;
+    evictLocked();
+    m_stats.entryCount = m_entries.size();
+}
+
+std::size_t FrameCache::prewarm(SoftwareRenderer& renderer, std::uint64_t configHash, const std::vector<std::string>& texts) {
+    std::size_t rendered = 0;
+    for (const std::string& text : texts) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (containsLocked(Key{text, configHash})) {
+                continue;
+            }
+        }
+
+        // Render outside the lock; only the insertion is serialised
+        renderer.render(text);
+        insert(text, configHash, std::make_shared<const Framebuffer>(renderer.getFramebuffer()));
+        ++rendered;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stats.prewarmed += rendered;
+    return rendered;
+}
+
+void FrameCache::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+    m_index.clear();
+    m_stats.memoryBytes = 0;
+    m_stats.entryCount = 0;
+}
+
+void FrameCache::setMemoryBudget(std::size_t memoryBudget) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stats.memoryBudget = memoryBudget;
+    evictLocked();
+    m_stats.entryCount = m_entries.size();
+}
+
+FrameCacheStats FrameCache::getStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+std::size_t FrameCache::KeyHash::operator()(const Key& key) const {
+    return std::hash<std::string>()(key.text) ^ static_cast<std::size_t>(key.configHash * FNV_PRIME);
+}
+
+bool FrameCache::containsLocked(const Key& key) const {
+    return m_index.find(key) != m_index.end();
+}
+
+void FrameCache::evictLocked() {
+    while (m_stats.memoryBytes > m_stats.memoryBudget && !m_entries.empty()) {
+        const Entry& victim = m_entries.back();
+        m_stats.memoryBytes -= victim.bytes;
+        m_index.erase(victim.key);
+        m_entries.pop_back();
+        ++m_stats.evictions;
+    }
+}
+
+std::size_t FrameCache::frameBytes(const Key& key, const Framebuffer& frame) {
+    return static_cast<std::size_t>(frame.getStride()) * frame.getHeight() * sizeof(std::uint32_t)
+        + key.text.capacity() + sizeof(Entry);
+}
+
+} // namespace TradingTimeCounter
@@ -0,0 +1,97 @@
+#include "tradingTimeCounter/Framebuffer.h"
+#include <algorithm>
+
+namespace TradingTimeCounter {
+
+namespace {
+
+// Rows are padded to this many pixels (32 bytes)
+const int ROW_ALIGNMENT_PIXELS = 8;
+
+std::uint32_t premultiply(int channel, int alpha) {
+    int clamped = std::min(255, std::max(0, channel));
+    return static_cast<std::uint32_t>((clamped * alpha + 127) / 255);
+}
+
+} // namespace
+
+void RenderRect::unite(const RenderRect& other) {
+    if (other.isEmpty()) {
+        return;
+    }
+    if (isEmpty()) {
+        *this = other;
+        return;
+    }
+
+    int right = std::max(x + width, other.x + other.width);
+    int bottom = std::max(y + height, other.y + other.height);
+    x = std::min(x, other.x);
+    y = std::min(y, other.y);
+    width = right - x;
+    height = bottom - y;
+}
+
+Framebuffer::Framebuffer(PixelFormat format)
+    : m_width(0)
+    , m_height(0)
+    , m_stride(0)
+    , m_format(format) {
+}
+
+void Framebuffer::resize(int width, int height) {
+    m_width = std::max(0, width);
+    m_height = std::max(0, height);
+    m_stride = (m_width + ROW_ALIGNMENT_PIXELS - 1) / ROW_ALIGNMENT_PIXELS * ROW_ALIGNMENT_PIXELS;
+    m_pixels.assign(static_cast<std::size_t>(m_stride) * m_height, 0);
+}
+
+void Framebuffer::fill(const RenderRect& rect, std::uint32_t color) {
+    int left = std::max(0, rect.x);
+    int top = std::max(0, rect.y);
+    int right = std::min(m_width, rect.x + rect.width);
+    int bottom = std::min(m_height, rect.y + rect.height);
+
+    for (int y = top; y < bottom; ++y) {
+        std::fill(row(y) + left, row(y) + std::max(left, right), color);
+    }
+}
+
+std::uint32_t Framebuffer::packColor(const DisplayConfig::Color& color, int alpha) const {
+    int a = std::min(255, std::max(0, alpha));
+    std::uint32_t r = premultiply(color.r, a);
+    std::uint32_t g = premultiply(color.g, a);
+    std::uint32_t b = premultiply(color.b, a);
+
+    // Little-endian: the lowest byte comes first in memory
+    if (m_format == PixelFormat::BGRA8) {
+        return b | (g << 8) | (r << 16) | (static_cast<std::uint32_t>(a) << 24);
+    }
+    return r | (g << 8) | (b << 16) | (static_cast<std::uint32_t>(a) << 24);
+}
+
+std::uint32_t* Framebuffer::row(int y) {
+    return m_pixels.data() + static_cast<std::size_t>(y) * m_stride;
+}
+
+const std::uint32_t* Framebuffer::row(int y) const {
+    return m_pixels.data() + static_cast<std::size_t>(y) * m_stride;
+}
+
+int Framebuffer::getWidth() const {
+    return m_width;
+}
+
+int Framebuffer::getHeight() const {
+    return m_height;
+}
+
+int Framebuffer::getStride() const {
+    return m_stride;
+}
+
+PixelFormat Framebuffer::getFormat() const {
+    return m_format;
+}
+
+} // namespace TradingTimeCounter
@@ -0,0 +1,246 @@
+#include "tradingTimeCounter/GlyphAtlas.h"
+#include <algorithm>
+#include <array>
+
+namespace TradingTimeCounter {
+
+namespace {
+
+constexpr int FONT_COLUMNS = 5;
+constexpr int FONT_ROWS = 7;
+constexpr int GLYPH_COUNT = 67;
+
+// Only the countdown glyphs (the first ATLAS_GLYPH_COUNT) are pre-rasterised
+constexpr int ATLAS_GLYPH_COUNT = 14;
+
+// Glyph rows are padded to this many bytes
+constexpr int ROW_ALIGNMENT = 16;
+
+constexpr char CHARACTERS[GLYPH_COUNT + 1] =
+    "0123456789:-. "
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+    "abcdefghijklmnopqrstuvwxyz"
+    "/";
+
+// 5x7 patterns in CHARACTERS order, one byte per row, bit 4 = leftmost column
+constexpr std::uint8_t FONT_PATTERNS[GLYPH_COUNT][FONT_ROWS] = {
+    {0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E},  // 0
+    {0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E},  // 1
+    {0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F},  // 2
+    {0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E},  // 3
+    {0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02},  // 4
+    {0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E},  // 5
+    {0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E},  // 6
+    {0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08},  // 7
+    {0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E},  // 8
+    {0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C},  // 9
+    {0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00},  // :
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00},  // -
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C},  // .
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},  // space
+    {0x0E, 0x11, 0x11, 0x11, 0x1F, 0x11, 0x11},  // A
+    {0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E},  // B
+    {0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E},  // C
+    {0x1C, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1C},  // D
+    {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F},  // E
+    {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10},  // F
+    {0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F},  // G
+    {0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11},  // H
+    {0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E},  // I
+    {0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0C},  // J
+    {0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11},  // K
+    {0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F},  // L
+    {0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11},  // M
+    {0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11},  // N
+    {0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E},  // O
+    {0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10},  // P
+    {0x0E, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0D},  // Q
+    {0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11},  // R
+    {0x0F, 0x10, 0x10, 0x0E, 0x01, 0x01, 0x1E},  // S
+    {0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04},  // T
+    {0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E},  // U
+    {0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04},  // V
+    {0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A},  // W
+    {0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11},  // X
+    {0x11, 0x11, 0x11, 0x0A, 0x04, 0x04, 0x04},  // Y
+    {0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1F},  // Z
+    {0x00, 0x00, 0x0E, 0x01, 0x0F, 0x11, 0x0F},  // a
+    {0x10, 0x10, 0x16, 0x19, 0x11, 0x11, 0x1E},  // b
+    {0x00, 0x00, 0x0E, 0x10, 0x10, 0x11, 0x0E},  // c
+    {0x01, 0x01, 0x0D, 0x13, 0x11, 0x11, 0x0F},  // d
+    {0x00, 0x00, 0x0E, 0x11, 0x1F, 0x10, 0x0E},  // e
+    {0x06, 0x09, 0x08, 0x1C, 0x08, 0x08, 0x08},  // f
+    {0x00, 0x0F, 0x11, 0x11, 0x0F, 0x01, 0x0E},  // g
+    {0x10, 0x10, 0x16, 0x19, 0x11, 0x11, 0x11},  // h
+    {0x04, 0x00, 0x0C, 0x04, 0x04, 0x04, 0x0E},  // i
+    {0x02, 0x00, 0x06, 0x02, 0x02, 0x12, 0x0C},  // j
+    {0x10, 0x10, 0x12, 0x14, 0x18, 0x14, 0x12},  // k
+    {0x0C, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E},  // l
+    {0x00, 0x00, 0x1A, 0x15, 0x15, 0x11, 0x11},  // m
+    {0x00, 0x00, 0x16, 0x19, 0x11, 0x11, 0x11},  // n
+    {0x00, 0x00, 0x0E, 0x11, 0x11, 0x11, 0x0E},  // o
+    {0x00, 0x00, 0x1E, 0x11, 0x1E, 0x10, 0x10},  // p
+    {0x00, 0x00, 0x0D, 0x13, 0x0F, 0x01, 0x01},  // q
+    {0x00, 0x00, 0x16, 0x19, 0x10, 0x10, 0x10},  // r
+    {0x00, 0x00, 0x0E, 0x10, 0x0E, 0x01, 0x1E},  // s
+    {0x08, 0x08, 0x1C, 0x08, 0x08, 0x09, 0x06},  // t
+    {0x00, 0x00, 0x11, 0x11, 0x11, 0x13, 0x0D},  // u
+    {0x00, 0x00, 0x11, 0x11, 0x11, 0x0A, 0x04},  // v
+    {0x00, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0A},  // w
+    {0x00, 0x00, 0x11, 0x0A, 0x04, 0x0A, 0x11},  // x
+    {0x00, 0x00, 0x11, 0x11, 0x0F, 0x01, 0x0E},  // y
+    {0x00, 0x00, 0x1F, 0x02, 0x04, 0x08, 0x1F},  // z
+    {0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00},  // /
+};
+
+constexpr int scaleForFontSize(int fontSize) {
+    return fontSize / (FONT_ROWS + 1) > 1 ? fontSize / (FONT_ROWS + 1) : 1;
+}
+
+// One blank column/row of spacing around the 5x7 pattern
+constexpr int glyphWidth(int scale) {
+    return (FONT_COLUMNS + 1) * scale;
+}
+
+constexpr int glyphHeight(int scale) {
+    return (FONT_ROWS + 1) * scale;
+}
+
+constexpr int rowStride(int scale) {
+    return (glyphWidth(scale) + ROW_ALIGNMENT - 1) / ROW_ALIGNMENT * ROW_ALIGNMENT;
+}
+
+constexpr int boldExtra(int scale, bool bold) {
+    return !bold ? 0 : (scale / 3 > 1 ? scale / 3 : 1);
+}
+
+/**
+ * @brief Rasterise one glyph into a zeroed pixel buffer
+ *
+ * Usable both in constant expressions (std::array) and at runtime
+ * (std::vector), so table and fallback glyphs are identical.
+ */
+template <typename Pixels>
+constexpr void drawGlyph(Pixels& pixels, std::size_t origin, int stride, int glyph, int scale, bool bold) {
+    const int width = glyphWidth(scale);
+    const int extra = boldExtra(scale, bold);
+    for (int row = 0; row < FONT_ROWS; ++row) {
+        for (int column = 0; column < FONT_COLUMNS; ++column) {
+            if (!(FONT_PATTERNS[glyph][row] & (0x10 >> column))) {
+                continue;
+            }
+
+            int left = column * scale + scale / 2;
+            int right = left + scale + extra < width ? left + scale + extra : width;
+            for (int y = row * scale + scale / 2; y < (row + 1) * scale + scale / 2; ++y) {
+                for (int x = left; x < right; ++x) {
+                    pixels[origin + static_cast<std::size_t>(y) * stride + x] = 255;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Compile-time rasterised face at one scale and weight
+ */
+template <int Scale, bool Bold>
+struct AtlasTable {
+    static constexpr int STRIDE = rowStride(Scale);
+    static constexpr std::size_t GLYPH_BYTES = static_cast<std::size_t>(STRIDE) * glyphHeight(Scale);
+    using Pixels = std::array<std::uint8_t, GLYPH_BYTES * ATLAS_GLYPH_COUNT>;
+
+    static_assert(GLYPH_BYTES % 64 == 0, "Atlas glyphs must start on cache-line boundaries");
+
+    static constexpr Pixels generate() {
+        Pixels pixels{};
+        for (int glyph = 0; glyph < ATLAS_GLYPH_COUNT; ++glyph) {
+            drawGlyph(pixels, glyph * GLYPH_BYTES, STRIDE, glyph, Scale, Bold);
+        }
+        return pixels;
+    }
+
+    alignas(64) static constexpr Pixels PIXELS = generate();
+
+    static GlyphAtlasFace face() {
+        return GlyphAtlasFace{Scale * (FONT_ROWS + 1), Scale, Bold, glyphWidth(Scale), glyphHeight(Scale),
+                              STRIDE, FONT_ROWS * Scale + Scale / 2, PIXELS.data()};
+    }
+};
+
+// Sizes 16, 24, 32 and 48 cover the usual overlay configurations
+const GlyphAtlasFace FACES[] = {
+    AtlasTable<2, false>::face(), AtlasTable<2, true>::face(),
+    AtlasTable<3, false>::face(), AtlasTable<3, true>::face(),
+    AtlasTable<4, false>::face(), AtlasTable<4, true>::face(),
+    AtlasTable<6, false>::face(), AtlasTable<6, true>::face(),
+};
+
+} // namespace
+
+const char* GlyphAtlas::getCharacters() {
+    return CHARACTERS;
+}
+
+int GlyphAtlas::getAtlasGlyphCount() {
+    return ATLAS_GLYPH_COUNT;
+}
+
+int GlyphAtlas::getGlyphIndex(char ch) {
+    for (int i = 0; i < GLYPH_COUNT; ++i) {
+        if (CHARACTERS[i] == ch) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+const GlyphAtlasFace* GlyphAtlas::findFace(int fontSize, bool bold) {
+    int scale = scaleForFontSize(fontSize);
+    for (const GlyphAtlasFace& face : FACES) {
+        if (face.scale == scale && face.isBold == bold) {
+            return &face;
+        }
+    }
+    return nullptr;
+}
+
+std::size_t GlyphAtlas::getFaceCount() {
+    return sizeof(FACES) / sizeof(FACES[0]);
+}
+
+const GlyphAtlasFace& GlyphAtlas::getFace(std::size_t index) {
+    return FACES[index];
+}
+
+const std::uint8_t* GlyphAtlas::glyphRow(const GlyphAtlasFace& face, int glyph, int row) {
+    return face.pixels + (static_cast<std::size_t>(glyph) * face.glyphHeight + row) * face.rowStride;
+}
+
+bool GlyphAtlas::rasterize(int fontSize, bool bold, char ch, GlyphBitmap& glyph) {
+    int index = getGlyphIndex(ch);
+    if (index < 0) {
+        return false;
+    }
+
+    const GlyphAtlasFace* face = index < ATLAS_GLYPH_COUNT ? findFace(fontSize, bold) : nullptr;
+    if (face) {
+        glyph.width = face->glyphWidth;
+        glyph.height = face->glyphHeight;
+        glyph.coverage.resize(static_cast<std::size_t>(glyph.width) * glyph.height);
+        for (int row = 0; row < glyph.height; ++row) {
+            const std::uint8_t* source = glyphRow(*face, index, row);
+            std::copy(source, source + glyph.width, glyph.coverage.begin() + row * glyph.width);
+        }
+        return true;
+    }
+
+    int scale = scaleForFontSize(fontSize);
+    glyph.width = glyphWidth(scale);
+    glyph.height = glyphHeight(scale);
+    glyph.coverage.assign(static_cast<std::size_t>(glyph.width) * glyph.height, 0);
+    drawGlyph(glyph.coverage, 0, glyph.width, index, scale, bold);
+    return true;
+}
+
+} // namespace TradingTimeCounter
@@ -0,0 +1,103 @@
+#include "tradingTimeCounter/GlyphCellCache.h"
+#include "tradingTimeCounter/PixelBlend.h"
+#include <algorithm>
+
+namespace TradingTimeCounter {
+
+GlyphCellCache::GlyphCellCache()
+    : m_cellWidth(0)
+    , m_cellHeight(0) {
+    m_glyphIndex.fill(-1);
+}
+
+bool GlyphCellCache::build(IGlyphRasterizer& rasterizer, const DisplayConfig& config, const char* characters) {
+    clear();
+
+    // Rasterise the set once; find the common cell size
+    std::vector<GlyphBitmap> glyphs;
+    for (const char* ch = characters; *ch; ++ch) {
+        unsigned char code = static_cast<unsigned char>(*ch);
+        GlyphBitmap glyph;
+        if (code >= m_glyphIndex.size() || !rasterizer.rasterize(config, *ch, glyph)) {
+            continue;
+        }
+        m_glyphIndex[code] = static_cast<int>(glyphs.size());
+        m_cellWidth = std::max(m_cellWidth, glyph.width);
+        m_cellHeight = std::max(m_cellHeight, glyph.height);
+        glyphs.push_back(std::move(glyph));
+    }
+
+    if (glyphs.empty()) {
+        return false;
+    }
+
+    // Centre every glyph in a cell-sized mask so cells can be redrawn independently
+    for (const GlyphBitmap& glyph : glyphs) {
+        GlyphBitmap cell;
+        cell.width = m_cellWidth;
+        cell.height = m_cellHeight;
+        cell.coverage.assign(static_cast<std::size_t>(m_cellWidth) * m_cellHeight, 0);
+
+        int offsetX = (m_cellWidth - glyph.width) / 2;
+        int offsetY = (m_cellHeight - glyph.height) / 2;
+        for (int y = 0; y < glyph.height; ++y) {
+            std::copy(glyph.coverage.begin() + y * glyph.width,
+                      glyph.coverage.begin() + (y + 1) * glyph.width,
+                      cell.coverage.begin() + (y + offsetY) * m_cellWidth + offsetX);
+        }
+        m_glyphs.push_back(std::move(cell));
+    }
+    return true;
+}
+
+void GlyphCellCache::clear() {
+    m_glyphs.clear();
+    m_glyphIndex.fill(-1);
+    m_cellWidth = 0;
+    m_cellHeight = 0;
+}
+
+bool GlyphCellCache::contains(char ch) const {
+    return glyphIndex(ch) >= 0;
+}
+
+int GlyphCellCache::getCellWidth() const {
+    return m_cellWidth;
+}
+
+int GlyphCellCache::getCellHeight() const {
+    return m_cellHeight;
+}
+
+void GlyphCellCache::drawCell(Framebuffer& framebuffer, int x, int y, char ch,
+                              std::uint32_t background, std::uint32_t foreground, SimdLevel level) const {
+    framebuffer.fill(RenderRect{x, y, m_cellWidth, m_cellHeight}, background);
+
+    int index = glyphIndex(ch);
+    if (index < 0) {
+        return;
+    }
+
+    // Clip the cell against the framebuffer
+    const GlyphBitmap& glyph = m_glyphs[index];
+    int left = std::max(0, x);
+    int right = std::min(framebuffer.getWidth(), x + m_cellWidth);
+    int top = std::max(0, y);
+    int bottom = std::min(framebuffer.getHeight(), y + m_cellHeight);
+    if (right <= left) {
+        return;
+    }
+
+    for (int row = top; row < bottom; ++row) {
+        const std::uint8_t* coverage = glyph.coverage.data() + (row - y) * m_cellWidth + (left - x);
+        PixelBlend::blendSpanWith(level, framebuffer.row(row) + left, coverage,
+                                  static_cast<std::size_t>(right - left), foreground);
+    }
+}
+
+int GlyphCellCache::glyphIndex(char ch) const {
+    unsigned char code = static_cast<unsigned char>(ch);
+    return code < m_glyphIndex.size() ? m_glyphIndex[code] : -1;
+}
+
+} // namespace TradingTimeCounter
@@ -0,0 +1,16 @@
+#include "tradingTimeCounter/InlineExecutor.h"
+
+namespace TradingTimeCounter {
+
+void InlineExecutor::post(std::function<void()> task) {
+    task();
+}
+
+void InlineExecutor::postBatch(std::vector<std::function<void()>>& tasks) {
+    for (std::function<void()>& task : tasks) {
+        task();
+    }
+    tasks.clear();
+}
+
+} // namespace TradingTimeCounter
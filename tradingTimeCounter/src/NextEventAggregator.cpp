@@ -0,0 +1,201 @@
+#include "tradingTimeCounter/NextEventAggregator.h"
+#include <algorithm>
+#include <utility>
+
+namespace TradingTimeCounter {
+
+// Static member definitions
+const std::int64_t ICountdownSource::NEVER;
+const std::size_t NextEventAggregator::NOT_IN_HEAP;
+
+namespace {
+
+const std::int64_t NS_PER_SECOND = 1000000000;
+
+/**
+ * @brief Event order: time, then source index so equal times list in a stable order
+ */
+bool isEarlier(const UpcomingEvent& a, const UpcomingEvent& b) {
+    return a.timeNs < b.timeNs || (a.timeNs == b.timeNs && a.source < b.source);
+}
+
+} // namespace
+
+BarCloseSource::BarCloseSource(const std::string& label, int periodSeconds, int offsetSeconds)
+    : m_label(label)
+    , m_periodNs(static_cast<std::int64_t>(std::max(periodSeconds, 1)) * NS_PER_SECOND)
+    , m_offsetNs(static_cast<std::int64_t>(offsetSeconds) * NS_PER_SECOND) {
+}
+
+std::int64_t BarCloseSource::eventAfter(std::int64_t timeNs) const {
+    if (timeNs >= NEVER - m_periodNs) {
+        return NEVER;
+    }
+
+    // Floor division so times before the offset still land on a boundary
+    std::int64_t sinceOffset = timeNs - m_offsetNs;
+    std::int64_t bars = sinceOffset / m_periodNs;
+    if (sinceOffset % m_periodNs < 0) {
+        --bars;
+    }
+    return m_offsetNs + (bars + 1) * m_periodNs;
+}
+
+const std::string& BarCloseSource::getLabel() const {
+    return m_label;
+}
+
+EventListSource::EventListSource(const std::string& label, std::vector<std::int64_t> timesNs)
+    : m_label(label) {
+    setEvents(std::move(timesNs));
+}
+
+void EventListSource::setEvents(std::vector<std::int64_t> timesNs) {
+    m_timesNs = std::move(timesNs);
+    std::sort(m_timesNs.begin(), m_timesNs.end());
+}
+
+std::int64_t EventListSource::eventAfter(std::int64_t timeNs) const {
+    auto it = std::upper_bound(m_timesNs.begin(), m_timesNs.end(), timeNs);
+    return it == m_timesNs.end() ? NEVER : *it;
+}
+
+const std::string& EventListSource::getLabel() const {
+    return m_label;
+}
+
+NextEventAggregator::NextEventAggregator(std::int64_t nowNs)
+    : m_nowNs(nowNs) {
+}
+
+std::size_t NextEventAggregator::addSource(std::shared_ptr<ICountdownSource> source) {
+    std::size_t index = m_sources.size();
+    UpcomingEvent event;
+    event.timeNs = source->eventAfter(m_nowNs);
+    event.source = index;
+    m_sources.push_back(std::move(source));
+    m_heap.push_back(event);
+    m_positions.push_back(m_heap.size() - 1);
+    siftUp(m_heap.size() - 1);
+    return index;
+}
+
+void NextEventAggregator::refresh(std::size_t index) {
+    if (index >= m_sources.size()) {
+        return;
+    }
+    std::size_t position = m_positions[index];
+    m_heap[position].timeNs = m_sources[index]->eventAfter(m_nowNs);
+    reposition(position);
+}
+
+std::size_t NextEventAggregator::advanceTo(std::int64_t nowNs, std::vector<UpcomingEvent>* fired) {
+    std::size_t passed = 0;
+    while (!m_heap.empty() && m_heap[0].timeNs <= nowNs) {
+        if (fired) {
+            fired->push_back(m_heap[0]);
+        }
+        ++passed;
+
+        // Only the source that fired is asked again; the root can only get later
+        m_heap[0].timeNs = m_sources[m_heap[0].source]->eventAfter(m_heap[0].timeNs);
+        siftDown(0);
+    }
+    m_nowNs = std::max(m_nowNs, nowNs);
+    return passed;
+}
+
+UpcomingEvent NextEventAggregator::next() const {
+    return m_heap.empty() ? UpcomingEvent() : m_heap[0];
+}
+
+void NextEventAggregator::upcoming(std::size_t count, std::vector<UpcomingEvent>& events) const {
+    events.clear();
+    if (m_heap.empty() || count == 0) {
+        return;
+    }
+
+    // Lazy k-way merge: the frontier starts at the heap root; taking a
+    // heap entry exposes its children, and taking any event exposes the
+    // same source's following event
+    auto later = [](const Candidate& a, const Candidate& b) { return isEarlier(b.event, a.event); };
+    m_candidates.clear();
+    m_candidates.push_back(Candidate{m_heap[0], 0});
+    while (events.size() < count && !m_candidates.empty()) {
+        std::pop_heap(m_candidates.begin(), m_candidates.end(), later);
+        Candidate taken = m_candidates.back();
+        m_candidates.pop_back();
+        if (taken.event.timeNs == ICountdownSource::NEVER) {
+            break;
+        }
+        events.push_back(taken.event);
+
+        if (taken.heapPosition != NOT_IN_HEAP) {
+            for (std::size_t child = 2 * taken.heapPosition + 1; child <= 2 * taken.heapPosition + 2; ++child) {
+                if (child < m_heap.size()) {
+                    m_candidates.push_back(Candidate{m_heap[child], child});
+                    std::push_heap(m_candidates.begin(), m_candidates.end(), later);
+                }
+            }
+        }
+
+        UpcomingEvent following;
+        following.timeNs = m_sources[taken.event.source]->eventAfter(taken.event.timeNs);
+        following.source = taken.event.source;
+        if (following.timeNs != ICountdownSource::NEVER) {
+            m_candidates.push_back(Candidate{following, NOT_IN_HEAP});
+            std::push_heap(m_candidates.begin(), m_candidates.end(), later);
+        }
+    }
+}
+
+const ICountdownSource& NextEventAggregator::getSource(std::size_t index) const {
+    return *m_sources[index];
+}
+
+std::size_t NextEventAggregator::getSourceCount() const {
+    return m_sources.size();
+}
+
+void NextEventAggregator::reposition(std::size_t position) {
+    siftDown(siftUp(position));
+}
+
+std::size_t NextEventAggregator::siftUp(std::size_t position) {
+    while (position > 0) {
+        std::size_t parent = (position - 1) / 2;
+        if (!isEarlier(m_heap[position], m_heap[parent])) {
+            break;
+        }
+        swapEntries(position, parent);
+        position = parent;
+    }
+    return position;
+}
+
+void NextEventAggregator::siftDown(std::size_t position) {
+    for (;;) {
+        std::size_t earliest = position;
+        std::size_t left = 2 * position + 1;
+        std::size_t right = left + 1;
+        if (left < m_heap.size() && isEarlier(m_heap[left], m_heap[earliest])) {
+            earliest = left;
+        }
+        if (right < m_heap.size() && isEarlier(m_heap[right], m_heap[earliest])) {
+            earliest = right;
+        }
+        if (earliest == position) {
+            return;
+        }
+        swapEntries(position, earliest);
+        position = earliest;
+    }
+}
+
+void NextEventAggregator::swapEntries(std::size_t a, std::size_t b) {
+    std::swap(m_heap[a], m_heap[b]);
+    m_positions[m_heap[a].source] = a;
+    m_positions[m_heap[b].source] = b;
+}
+
+} // namespace TradingTimeCounter
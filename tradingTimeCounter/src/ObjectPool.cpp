@@ -0,0 +1,97 @@
+#include "tradingTimeCounter/ObjectPool.h"
+#include <algorithm>
+
+namespace TradingTimeCounter {
+
+// Static member definitions
+const std::size_t PoolSet::SIZE_CLASS;
+const std::size_t PoolSet::MAX_BLOCK_SIZE;
+
+FixedBlockPool::FixedBlockPool(std::size_t blockSize, std::size_t blocksPerChunk, Arena* arena)
+    : m_blockSize((std::max(blockSize, sizeof(void*)) + 15) & ~static_cast<std::size_t>(15))
+    , m_blocksPerChunk(std::max<std::size_t>(blocksPerChunk, 1))
+    , m_arena(arena)
+    , m_free(nullptr) {
+}
+
+void* FixedBlockPool::allocate() {
+    if (!m_free) {
+        grow();
+    }
+
+    void* block = m_free;
+    m_free = *static_cast<void**>(block);
+    ++m_stats.inUse;
+    m_stats.highWater = std::max(m_stats.highWater, m_stats.inUse);
+    return block;
+}
+
+void FixedBlockPool::deallocate(void* block) {
+    *static_cast<void**>(block) = m_free;
+    m_free = block;
+    --m_stats.inUse;
+}
+
+std::size_t FixedBlockPool::getBlockSize() const {
+    return m_blockSize;
+}
+
+PoolStats FixedBlockPool::getStats() const {
+    return m_stats;
+}
+
+void FixedBlockPool::grow() {
+    std::size_t bytes = m_blockSize * m_blocksPerChunk;
+    unsigned char* chunk;
+    if (m_arena) {
+        chunk = static_cast<unsigned char*>(m_arena->allocate(bytes, 16));
+    } else {
+        m_chunks.emplace_back(new unsigned char[bytes]);
+        chunk = m_chunks.back().get();
+    }
+
+    // Thread the new blocks onto the free list, lowest address first
+    for (std::size_t i = m_blocksPerChunk; i > 0; --i) {
+        void* block = chunk + (i - 1) * m_blockSize;
+        *static_cast<void**>(block) = m_free;
+        m_free = block;
+    }
+    m_stats.capacity += m_blocksPerChunk;
+    ++m_stats.chunks;
+}
+
+PoolSet::PoolSet(std::size_t blocksPerChunk, Arena* arena) {
+    m_pools.reserve(MAX_BLOCK_SIZE / SIZE_CLASS);
+    for (std::size_t size = SIZE_CLASS; size <= MAX_BLOCK_SIZE; size += SIZE_CLASS) {
+        m_pools.emplace_back(size, blocksPerChunk, arena);
+    }
+}
+
+void* PoolSet::allocate(std::size_t bytes) {
+    if (bytes == 0 || bytes > MAX_BLOCK_SIZE) {
+        return ::operator new(bytes);
+    }
+    return m_pools[(bytes - 1) / SIZE_CLASS].allocate();
+}
+
+void PoolSet::deallocate(void* memory, std::size_t bytes) {
+    if (bytes == 0 || bytes > MAX_BLOCK_SIZE) {
+        ::operator delete(memory);
+        return;
+    }
+    m_pools[(bytes - 1) / SIZE_CLASS].deallocate(memory);
+}
+
+PoolStats PoolSet::getStats() const {
+    PoolStats total;
+    for (const FixedBlockPool& pool : m_pools) {
+        PoolStats stats = pool.getStats();
+        total.capacity += stats.capacity;
+        total.inUse += stats.inUse;
+        total.highWater += stats.highWater;
+        total.chunks += stats.chunks;
+    }
+    return total;
+}
+
+} // namespace TradingTimeCounter
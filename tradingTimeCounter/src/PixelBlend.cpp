@@ -0,0 +1,140 @@
+#include "tradingTimeCounter/PixelBlend.h"
+#include <cstring>
+
+#ifdef TTC_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace TradingTimeCounter {
+namespace PixelBlend {
+
+namespace {
+
+// (x + 128 + ((x + 128) >> 8)) >> 8 == round(x / 255) for 0 <= x <= 65025
+inline std::uint32_t divide255(std::uint32_t x) {
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+void blendScalar(std::uint32_t* dst, const std::uint8_t* coverage, std::size_t count, std::uint32_t color) {
+    for (std::size_t i = 0; i < count; ++i) {
+        std::uint32_t c = coverage[i];
+        if (c == 0) {
+            continue;
+        }
+        if (c == 255) {
+            dst[i] = color;
+            continue;
+        }
+
+        std::uint32_t inverse = 255 - c;
+        std::uint32_t pixel = dst[i];
+        std::uint32_t result = 0;
+        for (int shift = 0; shift < 32; shift += 8) {
+            std::uint32_t d = (pixel >> shift) & 0xff;
+            std::uint32_t s = (color >> shift) & 0xff;
+            result |= divide255(d * inverse + s * c) << shift;
+        }
+        dst[i] = result;
+    }
+}
+
+#ifdef TTC_SIMD_X86
+
+// Blend 16-bit lanes: divide255(d * (255 - c) + s * c); every sum fits in 16 bits
+TTC_TARGET_SSE2
+inline __m128i blendLanesSse2(__m128i d, __m128i c, __m128i s) {
+    __m128i t = _mm_add_epi16(_mm_mullo_epi16(d, _mm_sub_epi16(_mm_set1_epi16(255), c)), _mm_mullo_epi16(s, c));
+    t = _mm_add_epi16(t, _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+
+TTC_TARGET_AVX2
+inline __m256i blendLanesAvx2(__m256i d, __m256i c, __m256i s) {
+    __m256i t = _mm256_add_epi16(_mm256_mullo_epi16(d, _mm256_sub_epi16(_mm256_set1_epi16(255), c)), _mm256_mullo_epi16(s, c));
+    t = _mm256_add_epi16(t, _mm256_set1_epi16(128));
+    return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+}
+
+TTC_TARGET_SSE2
+void blendSse2(std::uint32_t* dst, const std::uint8_t* coverage, std::size_t count, std::uint32_t color) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i source = _mm_unpacklo_epi8(_mm_set1_epi32(static_cast<int>(color)), zero);
+
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        std::int32_t coverage4;
+        std::memcpy(&coverage4, coverage + i, sizeof(coverage4));
+        if (coverage4 == 0) {
+            continue;
+        }
+
+        // Replicate each coverage byte across its pixel's four channels
+        __m128i c = _mm_cvtsi32_si128(coverage4);
+        c = _mm_unpacklo_epi8(c, c);
+        c = _mm_unpacklo_epi16(c, c);
+
+        __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        __m128i lo = blendLanesSse2(_mm_unpacklo_epi8(pixels, zero), _mm_unpacklo_epi8(c, zero), source);
+        __m128i hi = blendLanesSse2(_mm_unpackhi_epi8(pixels, zero), _mm_unpackhi_epi8(c, zero), source);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(lo, hi));
+    }
+
+    blendScalar(dst + i, coverage + i, count - i, color);
+}
+
+TTC_TARGET_AVX2
+void blendAvx2(std::uint32_t* dst, const std::uint8_t* coverage, std::size_t count, std::uint32_t color) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i source = _mm256_unpacklo_epi8(_mm256_set1_epi32(static_cast<int>(color)), zero);
+
+    // Lane 0 expands coverage bytes 0-3, lane 1 bytes 4-7, four copies each
+    const __m256i expand = _mm256_setr_epi8(
+        0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
+        4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7);
+
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        std::int64_t coverage8;
+        std::memcpy(&coverage8, coverage + i, sizeof(coverage8));
+        if (coverage8 == 0) {
+            continue;
+        }
+
+        __m256i c = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_cvtsi64_si128(coverage8)), expand);
+        __m256i pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+        __m256i lo = blendLanesAvx2(_mm256_unpacklo_epi8(pixels, zero), _mm256_unpacklo_epi8(c, zero), source);
+        __m256i hi = blendLanesAvx2(_mm256_unpackhi_epi8(pixels, zero), _mm256_unpackhi_epi8(c, zero), source);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_packus_epi16(lo, hi));
+    }
+
+    blendScalar(dst + i, coverage + i, count - i, color);
+}
+
+#endif // TTC_SIMD_X86
+
+} // namespace
+
+void blendSpan(std::uint32_t* dst, const std::uint8_t* coverage, std::size_t count, std::uint32_t color) {
+    blendSpanWith(getSimdLevel(), dst, coverage, count, color);
+}
+
+void blendSpanWith(SimdLevel level, std::uint32_t* dst, const std::uint8_t* coverage,
+                   std::size_t count, std::uint32_t color) {
+    switch (clampSimdLevel(level)) {
+#ifdef TTC_SIMD_X86
+        case SimdLevel::AVX2:
+            blendAvx2(dst, coverage, count, color);
+            return;
+        case SimdLevel::SSE2:
+            blendSse2(dst, coverage, count, color);
+            return;
+#endif
+        default:
+            blendScalar(dst, coverage, count, color);
+            return;
+    }
+}
+
+} // namespace PixelBlend
+} // namespace TradingTimeCounter
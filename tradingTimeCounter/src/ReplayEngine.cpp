@@ -0,0 +1,224 @@
+#include "tradingTimeCounter/ReplayEngine.h"
+#include "tradingTimeCounter/TscClock.h"
+#include <algorithm>
+#include <limits>
+#include <thread>
+
+namespace TradingTimeCounter {
+
+namespace {
+
+const std::int64_t NS_PER_SECOND = 1000000000LL;
+const std::int64_t NS_PER_MS = 1000000LL;
+
+/**
+ * @brief Milliseconds left until a boundary, rounded up as the timer thread does
+ */
+std::uint32_t remainingMsAt(std::int64_t boundaryNs, std::int64_t nowNs) {
+    std::int64_t remainingNs = boundaryNs - nowNs;
+    if (remainingNs <= 0) {
+        return 0;
+    }
+    std::int64_t remainingMs = (remainingNs + NS_PER_MS - 1) / NS_PER_MS;
+    return remainingMs > 0xFFFFFFFFLL ? 0xFFFFFFFFu : static_cast<std::uint32_t>(remainingMs);
+}
+
+} // namespace
+
+ReplayEngine::ReplayEngine()
+    : m_clock(std::make_shared<VirtualClock>())
+    , m_recordCallback(nullptr)
+    , m_speed(0.0)
+    , m_shouldStop(false)
+    , m_nextEventNs(std::numeric_limits<std::int64_t>::max())
+    , m_timerEvents(0)
+    , m_virtualStartNs(0) {
+}
+
+void ReplayEngine::addCountdown(int durationMinutes, std::shared_ptr<ITimerCallback> callback,
+                                const AlertPlan& alertPlan, const DisplayPrecisionPolicy& policy) {
+    Countdown countdown;
+    countdown.periodNs = static_cast<std::int64_t>(durationMinutes) * 60 * NS_PER_SECOND;
+    countdown.boundaryNs = 0;
+    countdown.changeAtMs = 0;
+    countdown.alertAtMs = 0;
+    countdown.flashAtMs = 0;
+    countdown.alertStage = -1;
+    countdown.flashHighlighted = -1;
+    countdown.alertPlan = alertPlan;
+    countdown.policy = policy;
+    countdown.callback = callback;
+    m_countdowns.push_back(countdown);
+}
+
+void ReplayEngine::setSpeed(double speed) {
+    m_speed = speed > 0.0 ? speed : 0.0;
+}
+
+void ReplayEngine::setRecordCallback(std::function<void(const TickRecord&)> callback) {
+    m_recordCallback = callback;
+}
+
+std::shared_ptr<VirtualClock> ReplayEngine::getClock() const {
+    return m_clock;
+}
+
+ReplayStats ReplayEngine::run(const TickFile& file) {
+    return run(file.records(), file.size());
+}
+
+ReplayStats ReplayEngine::run(const TickRecord* records, std::size_t count) {
+    ReplayStats stats;
+    if (!records || count == 0) {
+        return stats;
+    }
+
+    m_shouldStop.store(false);
+    m_timerEvents = 0;
+    m_virtualStartNs = records[0].timestampNs;
+    m_realStart = TscClock::now();
+    startCountdowns(m_virtualStartNs);
+
+    std::size_t processed = 0;
+    std::int64_t lastNs = m_virtualStartNs;
+    for (; processed < count && !m_shouldStop.load(std::memory_order_relaxed); ++processed) {
+        const TickRecord& record = records[processed];
+        if (record.timestampNs < lastNs) {
+            ++stats.outOfOrderRecords;
+        } else {
+            lastNs = record.timestampNs;
+        }
+        advanceTo(lastNs);
+        if (m_recordCallback) {
+            m_recordCallback(record);
+        }
+    }
+
+    for (Countdown& countdown : m_countdowns) {
+        if (countdown.callback) {
+            countdown.callback->onTimerStopped();
+        }
+    }
+
+    stats.recordsProcessed = processed;
+    stats.timerEvents = m_timerEvents;
+    stats.virtualStartNs = m_virtualStartNs;
+    stats.virtualEndNs = m_clock->nowNs();
+    stats.wallSeconds = std::chrono::duration<double>(TscClock::now() - m_realStart).count();
+    return stats;
+}
+
+void ReplayEngine::requestStop() {
+    m_shouldStop.store(true);
+}
+
+void ReplayEngine::startCountdowns(std::int64_t startNs) {
+    m_clock->advanceTo(startNs);
+    m_nextEventNs = std::numeric_limits<std::int64_t>::max();
+
+    for (Countdown& countdown : m_countdowns) {
+        // Same arming rule as an aligned CountdownTimer: first boundary after now
+        countdown.boundaryNs = startNs - startNs % countdown.periodNs + countdown.periodNs;
+        countdown.changeAtMs = countdown.policy.nextChangeMs(remainingMsAt(countdown.boundaryNs, startNs));
+        countdown.alertStage = -1;
+        countdown.flashHighlighted = -1;
+
+        if (countdown.callback) {
+            countdown.callback->onTimerStarted();
+        }
+        wakeCountdown(countdown, startNs);
+        m_nextEventNs = std::min(m_nextEventNs, nextWakeNs(countdown));
+    }
+}
+
+void ReplayEngine::advanceTo(std::int64_t nowNs) {
+    // Fast path: most records fall between timer wakeups
+    while (m_nextEventNs <= nowNs) {
+        std::int64_t eventNs = m_nextEventNs;
+        pace(eventNs);
+        m_clock->advanceTo(eventNs);
+
+        std::int64_t next = std::numeric_limits<std::int64_t>::max();
+        for (Countdown& countdown : m_countdowns) {
+            if (nextWakeNs(countdown) <= eventNs) {
+                wakeCountdown(countdown, eventNs);
+            }
+            next = std::min(next, nextWakeNs(countdown));
+        }
+        m_nextEventNs = next;
+    }
+
+    pace(nowNs);
+    m_clock->advanceTo(nowNs);
+}
+
+void ReplayEngine::wakeCountdown(Countdown& countdown, std::int64_t nowNs) {
+    // Mirrors one pass of CountdownTimer::timerThreadFunction
+    bool replan = false;
+    while (true) {
+        std::uint32_t remainingMs = remainingMsAt(countdown.boundaryNs, nowNs);
+
+        int stage = countdown.alertPlan.stageAt(remainingMs);
+        if (stage != countdown.alertStage) {
+            countdown.alertStage = stage;
+            ++m_timerEvents;
+            if (countdown.callback) {
+                countdown.callback->onTimerAlert(stage);
+            }
+        }
+        countdown.alertAtMs = countdown.alertPlan.nextThresholdMs(remainingMs);
+
+        countdown.flashAtMs = 0;
+        if (countdown.alertPlan.flashesAt(stage) && remainingMs > 0) {
+            bool highlighted = AlertPlan::isFlashHighlighted(remainingMs);
+            if (countdown.flashHighlighted != static_cast<int>(highlighted)) {
+                countdown.flashHighlighted = static_cast<int>(highlighted);
+                ++m_timerEvents;
+                if (countdown.callback) {
+                    countdown.callback->onTimerFlash(highlighted);
+                }
+            }
+            countdown.flashAtMs = AlertPlan::nextFlashToggleMs(remainingMs);
+        } else {
+            countdown.flashHighlighted = -1;
+        }
+
+        if (remainingMs <= countdown.changeAtMs || replan) {
+            replan = false;
+            countdown.changeAtMs = countdown.policy.nextChangeMs(remainingMs);
+            ++m_timerEvents;
+            if (countdown.callback) {
+                countdown.callback->onTimerUpdate(static_cast<int>((remainingMs + 999) / 1000));
+            }
+        }
+
+        if (remainingMs > 0) {
+            return;
+        }
+
+        // Bar closed: complete and re-arm for the following boundary
+        ++m_timerEvents;
+        if (countdown.callback) {
+            countdown.callback->onTimerBoundary(countdown.boundaryNs);
+            countdown.callback->onTimerCompleted();
+        }
+        countdown.boundaryNs += countdown.periodNs;
+        replan = true;
+    }
+}
+
+std::int64_t ReplayEngine::nextWakeNs(const Countdown& countdown) {
+    std::uint32_t wakeAtMs = std::max(std::max(countdown.changeAtMs, countdown.alertAtMs), countdown.flashAtMs);
+    return countdown.boundaryNs - static_cast<std::int64_t>(wakeAtMs) * NS_PER_MS;
+}
+
+void ReplayEngine::pace(std::int64_t virtualNs) const {
+    if (m_speed <= 0.0) {
+        return;
+    }
+
+    auto offset = std::chrono::duration<double, std::nano>(static_cast<double>(virtualNs - m_virtualStartNs) / m_speed);
+    std::this_thread::sleep_until(m_realStart + std::chrono::duration_cast<std::chrono::steady_clock::duration>(offset));
+}
+
+} // namespace TradingTimeCounter
@@ -0,0 +1,288 @@
+#include "tradingTimeCounter/ShardedTimerScheduler.h"
+#include "tradingTimeCounter/Trace.h"
+#include "tradingTimeCounter/TscClock.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#elif defined(_WIN32)
+#include <windows.h>
+#endif
+
+namespace TradingTimeCounter {
+
+namespace {
+
+// Shard whose table the current thread owns (shard thread or runDue caller)
+thread_local const void* t_currentShard = nullptr;
+
+/**
+ * @brief Pin the calling thread to one CPU
+ */
+bool pinCurrentThread(std::size_t cpu) {
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(static_cast<int>(cpu), &set);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0) {
+        std::cerr << "ShardedTimerScheduler: Failed to pin shard thread to CPU " << cpu << std::endl;
+        return false;
+    }
+    return true;
+#elif defined(_WIN32)
+    if (SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(1) << cpu) == 0) {
+        std::cerr << "ShardedTimerScheduler: Failed to pin shard thread to CPU " << cpu << std::endl;
+        return false;
+    }
+    return true;
+#else
+    (void)cpu;
+    std::cerr << "ShardedTimerScheduler: Thread pinning is not supported on this platform" << std::endl;
+    return false;
+#endif
+}
+
+} // namespace
+
+// Static member definition
+const std::size_t ShardedTimerScheduler::MAILBOX_CAPACITY;
+
+ShardedTimerScheduler::ShardedTimerScheduler(ExpiryHandler handler, std::size_t shardCount, bool pinThreads)
+    : m_handler(std::move(handler))
+    , m_pinThreads(pinThreads)
+    , m_isRunning(false)
+    , m_shouldStop(false) {
+    if (shardCount == 0) {
+        shardCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    for (std::size_t i = 0; i < shardCount; ++i) {
+        m_shards.push_back(std::make_unique<Shard>(MAILBOX_CAPACITY));
+    }
+}
+
+ShardedTimerScheduler::~ShardedTimerScheduler() {
+    stop();
+}
+
+void ShardedTimerScheduler::add(std::uint64_t key, std::int64_t deadlineNs, std::int64_t periodNs) {
+    Command command;
+    command.key = key;
+    command.deadlineNs = deadlineNs;
+    command.periodNs = periodNs;
+    send(command);
+}
+
+void ShardedTimerScheduler::cancel(std::uint64_t key) {
+    Command command;
+    command.key = key;
+    command.cancel = true;
+    send(command);
+}
+
+std::size_t ShardedTimerScheduler::runDue(std::int64_t nowNs) {
+    std::size_t fired = 0;
+    for (std::unique_ptr<Shard>& shard : m_shards) {
+        std::lock_guard<std::mutex> lock(shard->consumerMutex);
+        t_currentShard = shard.get();
+        applyCommands(*shard);
+        fired += expire(*shard, nowNs);
+        t_currentShard = nullptr;
+    }
+    return fired;
+}
+
+void ShardedTimerScheduler::start() {
+    if (m_isRunning.load()) {
+        return; // Already running
+    }
+    
+    m_shouldStop.store(false);
+    m_isRunning.store(true);
+    for (std::size_t i = 0; i < m_shards.size(); ++i) {
+        m_shards[i]->thread = std::thread(&ShardedTimerScheduler::shardThreadFunction, this, i);
+    }
+}
+
+void ShardedTimerScheduler::stop() {
+    if (!m_isRunning.load()) {
+        return; // Not running
+    }
+    
+    m_shouldStop.store(true);
+    for (std::unique_ptr<Shard>& shard : m_shards) {
+        wake(*shard);
+    }
+    for (std::unique_ptr<Shard>& shard : m_shards) {
+        if (shard->thread.joinable()) {
+            shard->thread.join();
+        }
+    }
+    m_isRunning.store(false);
+}
+
+bool ShardedTimerScheduler::isRunning() const {
+    return m_isRunning.load();
+}
+
+std::size_t ShardedTimerScheduler::getShardCount() const {
+    return m_shards.size();
+}
+
+std::size_t ShardedTimerScheduler::shardOf(std::uint64_t key) const {
+    // Fibonacci hashing spreads sequential keys (symbol ids) evenly
+    return static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ULL) >> 32) % m_shards.size();
+}
+
+ShardStats ShardedTimerScheduler::getStats(std::size_t shard) const {
+    const Shard& source = *m_shards[shard];
+    ShardStats stats;
+    stats.timers = source.timers.load(std::memory_order_relaxed);
+    stats.commands = source.commands.load(std::memory_order_relaxed);
+    stats.expired = source.expiries.load(std::memory_order_relaxed);
+    stats.mailboxFull = source.mailboxFull.load(std::memory_order_relaxed);
+    stats.timersHighWater = source.timersHighWater.load(std::memory_order_relaxed);
+    stats.poolBytes = source.poolBytes.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void ShardedTimerScheduler::shardThreadFunction(std::size_t index) {
+    TTC_TRACE_THREAD_NAME("TimerShard " + std::to_string(index));
+    if (m_pinThreads) {
+        pinCurrentThread(index % std::max(1u, std::thread::hardware_concurrency()));
+    }
+    
+    Shard& shard = *m_shards[index];
+    std::lock_guard<std::mutex> owner(shard.consumerMutex);
+    t_currentShard = &shard;
+    while (!m_shouldStop.load()) {
+        applyCommands(shard);
+        expire(shard, TscClock::nowNs());
+        
+        // Announce the sleep before the last look at the mailbox, so a
+        // producer either sees the flag or its command is seen here
+        shard.sleeping.store(true);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!shard.mailbox.isEmpty() || m_shouldStop.load() || shard.nextDeadlineNs <= TscClock::nowNs()) {
+            shard.sleeping.store(false);
+            continue;
+        }
+        
+        std::unique_lock<std::mutex> lock(shard.sleepMutex);
+        auto woken = [&shard]() { return !shard.sleeping.load(); };
+        if (shard.nextDeadlineNs == TimerTable::NEVER) {
+            shard.sleepCondition.wait(lock, woken);
+        } else {
+            std::chrono::steady_clock::time_point deadline(
+                std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::nanoseconds(shard.nextDeadlineNs)));
+            shard.sleepCondition.wait_until(lock, deadline, woken);
+        }
+        shard.sleeping.store(false);
+    }
+    t_currentShard = nullptr;
+}
+
+void ShardedTimerScheduler::send(const Command& command) {
+    Shard& shard = *m_shards[shardOf(command.key)];
+    
+    // The owning thread (e.g. an expiry handler re-arming) applies directly
+    if (t_currentShard == &shard) {
+        applyCommand(shard, command);
+        return;
+    }
+    
+    while (!shard.mailbox.push(command)) {
+        shard.mailboxFull.fetch_add(1, std::memory_order_relaxed);
+        
+        // Without a shard thread to drain the mailbox, drain it here
+        if (!m_isRunning.load() && shard.consumerMutex.try_lock()) {
+            t_currentShard = &shard;
+            applyCommands(shard);
+            t_currentShard = nullptr;
+            shard.consumerMutex.unlock();
+            continue;
+        }
+        wake(shard);
+        std::this_thread::yield();
+    }
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    wake(shard);
+}
+
+void ShardedTimerScheduler::wake(Shard& shard) {
+    if (shard.sleeping.load() && shard.sleeping.exchange(false)) {
+        std::lock_guard<std::mutex> lock(shard.sleepMutex);
+        shard.sleepCondition.notify_one();
+    }
+}
+
+void ShardedTimerScheduler::applyCommands(Shard& shard) {
+    Command command;
+    while (shard.mailbox.pop(command)) {
+        applyCommand(shard, command);
+    }
+}
+
+void ShardedTimerScheduler::applyCommand(Shard& shard, const Command& command) {
+    auto found = shard.handles.find(command.key);
+    if (found != shard.handles.end()) {
+        shard.table.remove(found->second);
+        if (command.cancel) {
+            shard.handles.erase(found);
+        }
+    }
+    
+    if (!command.cancel) {
+        TimerHandle handle = shard.table.add(command.deadlineNs, command.periodNs, 0);
+        if (handle.slot >= shard.keys.size()) {
+            shard.keys.resize(handle.slot + 1);
+        }
+        shard.keys[handle.slot] = command.key;
+        if (found != shard.handles.end()) {
+            found->second = handle;
+        } else {
+            shard.handles.emplace(command.key, handle);
+        }
+        shard.nextDeadlineNs = std::min(shard.nextDeadlineNs, command.deadlineNs);
+        if (shard.table.size() > shard.timersHighWater.load(std::memory_order_relaxed)) {
+            shard.timersHighWater.store(shard.table.size(), std::memory_order_relaxed);
+            shard.poolBytes.store(shard.arena.getStats().reserved, std::memory_order_relaxed);
+        }
+    }
+    shard.timers.store(shard.table.size(), std::memory_order_relaxed);
+    shard.commands.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::size_t ShardedTimerScheduler::expire(Shard& shard, std::int64_t nowNs) {
+    if (nowNs < shard.nextDeadlineNs) {
+        return 0;
+    }
+    
+    TTC_TRACE_SCOPE("ShardedTimerScheduler::expire");
+    shard.table.expire(nowNs, shard.expired);
+    
+    // Settle the table first, so handlers may add and cancel freely
+    shard.expiredKeys.clear();
+    for (const ExpiredTimer& expired : shard.expired) {
+        std::uint64_t key = shard.keys[expired.handle.slot];
+        shard.expiredKeys.push_back(key);
+        if (shard.table.getState(expired.handle) == TimerState::Expired) {
+            shard.table.remove(expired.handle);
+            shard.handles.erase(key);
+        }
+    }
+    shard.nextDeadlineNs = shard.table.nextDeadline();
+    shard.timers.store(shard.table.size(), std::memory_order_relaxed);
+    
+    std::size_t count = shard.expired.size();
+    for (std::size_t i = 0; i < count; ++i) {
+        m_handler(shard.expiredKeys[i], shard.expired[i].deadlineNs);
+    }
+    shard.expiries.fetch_add(count, std::memory_order_relaxed);
+    return count;
+}
+
+} // namespace TradingTimeCounter
@@ -0,0 +1,155 @@
+#include "tradingTimeCounter/SoftwareRenderer.h"
+#include "tradingTimeCounter/BuiltinGlyphRasterizer.h"
+#include "tradingTimeCounter/Trace.h"
+#include <algorithm>
+#include <iostream>
+
+namespace TradingTimeCounter {
+
+namespace {
+
+// Everything a countdown can display
+const char GLYPH_SET[] = "0123456789:-. ";
+
+} // namespace
+
+SoftwareRenderer::SoftwareRenderer(PixelFormat format)
+    : m_framebuffer(format)
+    , m_rasterizer(std::make_shared<BuiltinGlyphRasterizer>())
+    , m_simdLevel(getSimdLevel())
+    , m_style(0)
+    , m_activeWeight(0)
+    , m_background(0)
+    , m_foreground(0)
+    , m_needsFullRedraw(true) {
+}
+
+void SoftwareRenderer::setGlyphRasterizer(std::shared_ptr<IGlyphRasterizer> rasterizer) {
+    m_rasterizer = rasterizer ? rasterizer : std::make_shared<BuiltinGlyphRasterizer>();
+}
+
+bool SoftwareRenderer::configure(const DisplayConfig& config) {
+    m_config = config;
+    m_framebuffer.resize(config.windowWidth, config.windowHeight);
+    return resolveStyles();
+}
+
+bool SoftwareRenderer::setStyles(const std::vector<DisplayStyle>& styles) {
+    m_styles = styles;
+    m_style = 0;
+    return resolveStyles();
+}
+
+bool SoftwareRenderer::selectStyle(std::size_t index) {
+    if (index >= m_resolvedStyles.size()) {
+        return false;
+    }
+    if (index != m_style) {
+        m_style = index;
+        m_background = m_resolvedStyles[index].background;
+        m_foreground = m_resolvedStyles[index].foreground;
+        m_activeWeight = m_resolvedStyles[index].cells;
+        m_needsFullRedraw = true;
+    }
+    return true;
+}
+
+std::size_t SoftwareRenderer::getStyle() const {
+    return m_style;
+}
+
+bool SoftwareRenderer::resolveStyles() {
+    m_needsFullRedraw = true;
+    std::vector<DisplayStyle> styles = m_styles.empty() ? std::vector<DisplayStyle>{DisplayStyle::fromConfig(m_config)} : m_styles;
+
+    // Glyphs once per weight in use, colors once per style
+    bool weightUsed[2] = {false, false};
+    m_resolvedStyles.clear();
+    for (const DisplayStyle& style : styles) {
+        std::size_t weight = style.isBold ? 1 : 0;
+        weightUsed[weight] = true;
+        m_resolvedStyles.push_back(ResolvedStyle{m_framebuffer.packColor(style.backgroundColor, style.opacity),
+                                                 m_framebuffer.packColor(style.textColor, style.opacity), weight});
+    }
+    for (std::size_t weight = 0; weight < m_cells.size(); ++weight) {
+        m_cells[weight].clear();
+        if (!weightUsed[weight]) {
+            continue;
+        }
+        DisplayConfig weighted = m_config;
+        weighted.isBold = weight == 1;
+        if (!m_cells[weight].build(*m_rasterizer, weighted, GLYPH_SET)) {
+            std::cerr << "SoftwareRenderer: Glyph rasterizer produced no glyphs" << std::endl;
+            return false;
+        }
+    }
+
+    m_style = m_style < m_resolvedStyles.size() ? m_style : 0;
+    m_background = m_resolvedStyles[m_style].background;
+    m_foreground = m_resolvedStyles[m_style].foreground;
+    m_activeWeight = m_resolvedStyles[m_style].cells;
+    return true;
+}
+
+RenderRect SoftwareRenderer::render(const std::string& text) {
+    TTC_TRACE_SCOPE("SoftwareRenderer::render");
+    const int width = m_framebuffer.getWidth();
+    const int height = m_framebuffer.getHeight();
+    const int cellWidth = m_cells[m_activeWeight].getCellWidth();
+    const int cellHeight = m_cells[m_activeWeight].getCellHeight();
+    const int textWidth = static_cast<int>(text.size()) * cellWidth;
+    const int originX = (width - textWidth) / 2;
+    const int originY = (height - cellHeight) / 2;
+
+    RenderRect dirty;
+
+    // A length change moves every cell, so it needs a full redraw too
+    if (m_needsFullRedraw || text.size() != m_renderedText.size()) {
+        RenderRect all{0, 0, width, height};
+        m_framebuffer.fill(all, m_background);
+        for (std::size_t i = 0; i < text.size(); ++i) {
+            drawCell(originX + static_cast<int>(i) * cellWidth, originY, text[i]);
+        }
+        m_renderedText = text;
+        m_needsFullRedraw = false;
+        return all;
+    }
+
+    for (std::size_t i = 0; i < text.size(); ++i) {
+        if (text[i] == m_renderedText[i]) {
+            continue;
+        }
+
+        int x = originX + static_cast<int>(i) * cellWidth;
+        drawCell(x, originY, text[i]);
+        dirty.unite(RenderRect{x, originY, cellWidth, cellHeight});
+    }
+    m_renderedText = text;
+
+    // Report only the visible part
+    int left = std::max(0, dirty.x);
+    int top = std::max(0, dirty.y);
+    int right = std::min(width, dirty.x + dirty.width);
+    int bottom = std::min(height, dirty.y + dirty.height);
+    return dirty.isEmpty() || right <= left || bottom <= top
+        ? RenderRect{}
+        : RenderRect{left, top, right - left, bottom - top};
+}
+
+void SoftwareRenderer::invalidate() {
+    m_needsFullRedraw = true;
+}
+
+const Framebuffer& SoftwareRenderer::getFramebuffer() const {
+    return m_framebuffer;
+}
+
+void SoftwareRenderer::setSimdLevel(SimdLevel level) {
+    m_simdLevel = clampSimdLevel(level);
+}
+
+void SoftwareRenderer::drawCell(int x, int y, char ch) {
+    m_cells[m_activeWeight].drawCell(m_framebuffer, x, y, ch, m_background, m_foreground, m_simdLevel);
+}
+
+} // namespace TradingTimeCounter
@@ -0,0 +1,212 @@
+#include "tradingTimeCounter/StateFile.h"
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <utility>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace TradingTimeCounter {
+
+// Static member definition
+const std::size_t PersistedState::MAX_DASHBOARD_TIMERS;
+
+namespace {
+
+const std::uint32_t STATE_FILE_MAGIC = 0x53435454;       // "TTCS" read as little-endian
+const std::uint32_t STATE_FILE_VERSION = 1;
+const int SLOT_COUNT = 2;
+
+/**
+ * @brief On-disk state file header
+ */
+struct StateFileHeader {
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint32_t slotSize;
+    std::uint32_t reserved;
+};
+
+/**
+ * @brief One on-disk copy of the state; the checksum covers everything after it
+ */
+struct StateSlot {
+    std::uint64_t checksum;
+    std::uint64_t sequence;
+    PersistedState state;
+};
+
+static_assert(sizeof(StateFileHeader) == 16, "StateFileHeader must match the on-disk layout");
+static_assert(sizeof(StateSlot) == 16 + 1312, "StateSlot must match the on-disk layout");
+static_assert(offsetof(PersistedState, dashboard) % 8 == 0 && sizeof(PersistedDashboardTimer) % 8 == 0,
+              "The checksum reads whole 64-bit words");
+
+const std::size_t STATE_FILE_SIZE = sizeof(StateFileHeader) + SLOT_COUNT * sizeof(StateSlot);
+
+std::uint64_t slotChecksum(const StateSlot& slot) {
+    // FNV-1a over 64-bit words of the sequence number and the used part of the state
+    const std::size_t size = sizeof(slot.sequence) + offsetof(PersistedState, dashboard)
+        + slot.state.dashboardCount * sizeof(PersistedDashboardTimer);
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&slot.sequence);
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (std::size_t i = 0; i < size; i += sizeof(std::uint64_t)) {
+        std::uint64_t word;
+        std::memcpy(&word, bytes + i, sizeof(word));
+        hash = (hash ^ word) * 1099511628211ULL;
+        hash ^= hash >> 32;
+    }
+    return hash;
+}
+
+bool slotValid(const StateSlot& slot) {
+    return slot.sequence != 0 && slot.state.dashboardCount <= PersistedState::MAX_DASHBOARD_TIMERS
+        && slot.checksum == slotChecksum(slot);
+}
+
+StateSlot* slotAt(void* mapping, int index) {
+    return reinterpret_cast<StateSlot*>(static_cast<char*>(mapping) + sizeof(StateFileHeader)) + index;
+}
+
+} // namespace
+
+StateFile::StateFile()
+    : m_mapping(nullptr)
+    , m_mappingSize(0)
+    , m_sequence(0) {
+}
+
+StateFile::~StateFile() {
+    close();
+}
+
+bool StateFile::open(const std::string& path) {
+    close();
+
+#ifdef _WIN32
+    std::cerr << "StateFile: Memory-mapped state is not implemented for this platform (" << path << ")" << std::endl;
+    return false;
+#else
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        std::cerr << "StateFile: Failed to open " << path << " (errno " << errno << ")" << std::endl;
+        return false;
+    }
+
+    struct stat info {};
+    if (fstat(fd, &info) != 0) {
+        std::cerr << "StateFile: Failed to stat " << path << " (errno " << errno << ")" << std::endl;
+        ::close(fd);
+        return false;
+    }
+
+    // A missing, truncated or foreign file is started over
+    bool fresh = static_cast<std::size_t>(info.st_size) != STATE_FILE_SIZE;
+    if (fresh && ftruncate(fd, 0) != 0) {
+        std::cerr << "StateFile: Failed to truncate " << path << " (errno " << errno << ")" << std::endl;
+        ::close(fd);
+        return false;
+    }
+    if (fresh && ftruncate(fd, static_cast<off_t>(STATE_FILE_SIZE)) != 0) {
+        std::cerr << "StateFile: Failed to size " << path << " (errno " << errno << ")" << std::endl;
+        ::close(fd);
+        return false;
+    }
+
+    void* mapping = mmap(nullptr, STATE_FILE_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        std::cerr << "StateFile: Failed to map " << path << " (errno " << errno << ")" << std::endl;
+        return false;
+    }
+
+    StateFileHeader* header = static_cast<StateFileHeader*>(mapping);
+    if (header->magic != STATE_FILE_MAGIC || header->version != STATE_FILE_VERSION ||
+        header->slotSize != sizeof(StateSlot)) {
+        if (!fresh) {
+            std::cerr << "StateFile: " << path << " has an invalid header, starting over" << std::endl;
+        }
+        std::memset(mapping, 0, STATE_FILE_SIZE);
+        *header = StateFileHeader{STATE_FILE_MAGIC, STATE_FILE_VERSION, static_cast<std::uint32_t>(sizeof(StateSlot)), 0};
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_mapping = mapping;
+    m_mappingSize = STATE_FILE_SIZE;
+    m_sequence = 0;
+    for (int i = 0; i < SLOT_COUNT; ++i) {
+        const StateSlot* slot = slotAt(m_mapping, i);
+        if (slotValid(*slot) && slot->sequence > m_sequence) {
+            m_sequence = slot->sequence;
+        }
+    }
+    return true;
+#endif
+}
+
+void StateFile::close() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_mapping) {
+#ifndef _WIN32
+        // Start write-back without waiting for it
+        msync(m_mapping, m_mappingSize, MS_ASYNC);
+        munmap(m_mapping, m_mappingSize);
+#endif
+        m_mapping = nullptr;
+    }
+    m_mappingSize = 0;
+    m_sequence = 0;
+}
+
+bool StateFile::isOpen() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_mapping != nullptr;
+}
+
+bool StateFile::load(PersistedState& state) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_mapping) {
+        return false;
+    }
+
+    // Newest slot first; the older one only if the newest fails its checksum
+    const StateSlot* first = slotAt(m_mapping, 0);
+    const StateSlot* second = slotAt(m_mapping, 1);
+    if (second->sequence > first->sequence) {
+        std::swap(first, second);
+    }
+    const StateSlot* valid = slotValid(*first) ? first : (slotValid(*second) ? second : nullptr);
+    if (!valid) {
+        return false;
+    }
+
+    std::memcpy(&state, &valid->state, sizeof(PersistedState));
+    return true;
+}
+
+bool StateFile::save(const PersistedState& state) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_mapping) {
+        return false;
+    }
+
+    // Overwrite the older slot so the newest valid one survives a torn write
+    std::uint64_t sequence = m_sequence + 1;
+    StateSlot* slot = slotAt(m_mapping, static_cast<int>(sequence % SLOT_COUNT));
+    slot->checksum = 0;
+    slot->sequence = sequence;
+    std::memcpy(&slot->state, &state, sizeof(PersistedState));
+    if (slot->state.dashboardCount > PersistedState::MAX_DASHBOARD_TIMERS) {
+        slot->state.dashboardCount = static_cast<std::uint32_t>(PersistedState::MAX_DASHBOARD_TIMERS);
+    }
+    slot->checksum = slotChecksum(*slot);
+    m_sequence = sequence;
+    return true;
+}
+
+} // namespace TradingTimeCounter
@@ -0,0 +1,132 @@
+#include "tradingTimeCounter/TickFile.h"
+#include <cerrno>
+#include <cstdio>
+#include <iostream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace TradingTimeCounter {
+
+namespace {
+
+const std::uint32_t TICK_FILE_MAGIC = 0x54435454;        // "TTCT" read as little-endian
+const std::uint32_t TICK_FILE_VERSION = 1;
+
+/**
+ * @brief On-disk tick file header
+ */
+struct TickFileHeader {
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint64_t recordCount;
+};
+
+static_assert(sizeof(TickFileHeader) == 16, "TickFileHeader must match the on-disk layout");
+
+} // namespace
+
+TickFile::TickFile()
+    : m_mapping(nullptr)
+    , m_mappingSize(0)
+    , m_records(nullptr)
+    , m_recordCount(0) {
+}
+
+TickFile::~TickFile() {
+    close();
+}
+
+bool TickFile::open(const std::string& path) {
+    close();
+
+#ifdef _WIN32
+    std::cerr << "TickFile: Memory-mapped replay is not implemented for this platform (" << path << ")" << std::endl;
+    return false;
+#else
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        std::cerr << "TickFile: Failed to open " << path << " (errno " << errno << ")" << std::endl;
+        return false;
+    }
+
+    struct stat info {};
+    if (fstat(fd, &info) != 0 || static_cast<std::size_t>(info.st_size) < sizeof(TickFileHeader)) {
+        std::cerr << "TickFile: " << path << " is too small to be a tick file" << std::endl;
+        ::close(fd);
+        return false;
+    }
+
+    std::size_t fileSize = static_cast<std::size_t>(info.st_size);
+    void* mapping = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        std::cerr << "TickFile: Failed to map " << path << " (errno " << errno << ")" << std::endl;
+        return false;
+    }
+
+    // Replay reads front to back exactly once; advice values are not flags,
+    // so each hint needs its own call
+    madvise(mapping, fileSize, MADV_SEQUENTIAL);
+    madvise(mapping, fileSize, MADV_WILLNEED);
+
+    const TickFileHeader* header = static_cast<const TickFileHeader*>(mapping);
+    std::size_t available = (fileSize - sizeof(TickFileHeader)) / sizeof(TickRecord);
+    if (header->magic != TICK_FILE_MAGIC || header->version != TICK_FILE_VERSION ||
+        header->recordCount > available) {
+        std::cerr << "TickFile: " << path << " has an invalid header" << std::endl;
+        munmap(mapping, fileSize);
+        return false;
+    }
+
+    m_mapping = mapping;
+    m_mappingSize = fileSize;
+    m_records = reinterpret_cast<const TickRecord*>(static_cast<const char*>(mapping) + sizeof(TickFileHeader));
+    m_recordCount = static_cast<std::size_t>(header->recordCount);
+    return true;
+#endif
+}
+
+void TickFile::close() {
+    if (m_mapping) {
+#ifndef _WIN32
+        munmap(m_mapping, m_mappingSize);
+#endif
+        m_mapping = nullptr;
+    }
+    m_mappingSize = 0;
+    m_records = nullptr;
+    m_recordCount = 0;
+}
+
+const TickRecord* TickFile::records() const {
+    return m_records;
+}
+
+std::size_t TickFile::size() const {
+    return m_recordCount;
+}
+
+bool TickFile::write(const std::string& path, const TickRecord* records, std::size_t count) {
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        std::cerr << "TickFile: Failed to create " << path << std::endl;
+        return false;
+    }
+
+    TickFileHeader header{TICK_FILE_MAGIC, TICK_FILE_VERSION, static_cast<std::uint64_t>(count)};
+    bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1 &&
+              (count == 0 || std::fwrite(records, sizeof(TickRecord), count, file) == count);
+    ok = (std::fclose(file) == 0) && ok;
+
+    if (!ok) {
+        std::cerr << "TickFile: Failed to write " << path << std::endl;
+    }
+    return ok;
+}
+
+} // namespace TradingTimeCounter
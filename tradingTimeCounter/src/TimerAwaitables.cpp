@@ -0,0 +1,162 @@
+#include "tradingTimeCounter/TimerAwaitables.h"
+
+namespace TradingTimeCounter {
+
+namespace {
+
+const std::int64_t NS_PER_SECOND = 1000000000LL;
+const std::int64_t SECONDS_PER_DAY = 24 * 60 * 60;
+
+} // namespace
+
+DeadlineAwaitable::DeadlineAwaitable(DeadlineScheduler& scheduler, IExecutor& executor, std::int64_t deadlineNs)
+    : m_scheduler(scheduler)
+    , m_executor(executor)
+    , m_deadlineNs(deadlineNs) {
+}
+
+void DeadlineAwaitable::await_suspend(std::coroutine_handle<> handle) {
+    // The handle fits std::function's small buffer, so no allocation per wait
+    auto resume = [handle]() { handle.resume(); };
+    if (m_deadlineNs <= m_scheduler.nowNs()) {
+        m_executor.post(resume);
+    } else {
+        m_scheduler.schedule(m_deadlineNs, m_executor, resume);
+    }
+}
+
+std::chrono::system_clock::time_point DeadlineAwaitable::await_resume() const noexcept {
+    return std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(m_deadlineNs)));
+}
+
+CoroutineClock::CoroutineClock(DeadlineScheduler& scheduler, IExecutor& executor)
+    : m_scheduler(scheduler)
+    , m_executor(executor) {
+}
+
+DeadlineAwaitable CoroutineClock::until(std::chrono::system_clock::time_point when) const {
+    std::int64_t deadlineNs = std::chrono::duration_cast<std::chrono::nanoseconds>(when.time_since_epoch()).count();
+    return DeadlineAwaitable(m_scheduler, m_executor, deadlineNs);
+}
+
+DeadlineAwaitable CoroutineClock::sleepFor(std::chrono::nanoseconds duration) const {
+    return DeadlineAwaitable(m_scheduler, m_executor, m_scheduler.nowNs() + duration.count());
+}
+
+DeadlineAwaitable CoroutineClock::untilNextBar(std::chrono::seconds period, std::chrono::seconds offset) const {
+    std::int64_t deadlineNs = nextBoundaryNs(m_scheduler.nowNs(), period.count() * NS_PER_SECOND,
+                                             offset.count() * NS_PER_SECOND);
+    return DeadlineAwaitable(m_scheduler, m_executor, deadlineNs);
+}
+
+std::int64_t CoroutineClock::nextBoundaryNs(std::int64_t nowNs, std::int64_t periodNs, std::int64_t offsetNs) {
+    // Floor division, so offsets after now still land on the right grid
+    std::int64_t sinceOffset = nowNs - offsetNs;
+    std::int64_t bars = sinceOffset / periodNs;
+    if (sinceOffset % periodNs < 0) {
+        --bars;
+    }
+    return offsetNs + (bars + 1) * periodNs;
+}
+
+DeadlineScheduler& CoroutineClock::getScheduler() const {
+    return m_scheduler;
+}
+
+IExecutor& CoroutineClock::getExecutor() const {
+    return m_executor;
+}
+
+TradingSession::TradingSession(const CoroutineClock& clock, std::chrono::seconds openUtc, std::chrono::seconds closeUtc)
+    : m_clock(clock)
+    , m_openUtc(openUtc)
+    , m_closeUtc(closeUtc) {
+}
+
+DeadlineAwaitable TradingSession::open() const {
+    return m_clock.untilNextBar(std::chrono::seconds(SECONDS_PER_DAY), m_openUtc);
+}
+
+DeadlineAwaitable TradingSession::close() const {
+    return m_clock.untilNextBar(std::chrono::seconds(SECONDS_PER_DAY), m_closeUtc);
+}
+
+TimerEvents::TimerEvents(IExecutor& executor, std::shared_ptr<ITimerCallback> forward)
+    : m_executor(executor)
+    , m_forward(forward) {
+}
+
+TimerEvents::CompletionAwaitable TimerEvents::completed() {
+    return CompletionAwaitable(*this);
+}
+
+std::size_t TimerEvents::getWaiterCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_waiters.size();
+}
+
+void TimerEvents::onTimerUpdate(int remainingSeconds) {
+    if (m_forward) {
+        m_forward->onTimerUpdate(remainingSeconds);
+    }
+}
+
+void TimerEvents::onTimerCompleted() {
+    if (m_forward) {
+        m_forward->onTimerCompleted();
+    }
+    
+    // Awaiters that suspend while these resume wait for the next completion
+    std::vector<std::coroutine_handle<>> waiters;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        waiters.swap(m_waiters);
+    }
+    for (std::coroutine_handle<> handle : waiters) {
+        m_executor.post([handle]() { handle.resume(); });
+    }
+}
+
+void TimerEvents::onTimerBoundary(std::int64_t boundaryNs) {
+    if (m_forward) {
+        m_forward->onTimerBoundary(boundaryNs);
+    }
+}
+
+void TimerEvents::onTimerStarted() {
+    if (m_forward) {
+        m_forward->onTimerStarted();
+    }
+}
+
+void TimerEvents::onTimerStopped() {
+    if (m_forward) {
+        m_forward->onTimerStopped();
+    }
+}
+
+void TimerEvents::onTimerResync(int remainingSeconds) {
+    if (m_forward) {
+        m_forward->onTimerResync(remainingSeconds);
+    }
+}
+
+void TimerEvents::onTimerAlert(int stage) {
+    if (m_forward) {
+        m_forward->onTimerAlert(stage);
+    }
+}
+
+void TimerEvents::onTimerFlash(bool highlighted) {
+    if (m_forward) {
+        m_forward->onTimerFlash(highlighted);
+    }
+}
+
+void TimerEvents::addWaiter(std::coroutine_handle<> handle) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_waiters.push_back(handle);
+}
+
+} // namespace TradingTimeCounter
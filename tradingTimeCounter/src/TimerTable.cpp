@@ -0,0 +1,156 @@
+#include "tradingTimeCounter/TimerTable.h"
+
+namespace TradingTimeCounter {
+
+const std::int64_t TimerTable::NEVER;
+
+TimerTable::TimerTable(std::size_t capacity) {
+    m_deadlines.reserve(capacity);
+    m_periods.reserve(capacity);
+    m_states.reserve(capacity);
+    m_subscribers.reserve(capacity);
+    m_denseToSlot.reserve(capacity);
+    m_slotToDense.reserve(capacity);
+    m_slotGenerations.reserve(capacity);
+    m_freeSlots.reserve(capacity);
+}
+
+TimerHandle TimerTable::add(std::int64_t deadlineNs, std::int64_t periodNs, std::uint32_t subscriberId) {
+    std::uint32_t slot;
+    if (!m_freeSlots.empty()) {
+        slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    } else {
+        slot = static_cast<std::uint32_t>(m_slotToDense.size());
+        m_slotToDense.push_back(0);
+        m_slotGenerations.push_back(0);
+    }
+
+    m_slotToDense[slot] = static_cast<std::uint32_t>(m_deadlines.size());
+    m_deadlines.push_back(deadlineNs);
+    m_periods.push_back(periodNs);
+    m_states.push_back(TimerState::Running);
+    m_subscribers.push_back(subscriberId);
+    m_denseToSlot.push_back(slot);
+
+    TimerHandle handle;
+    handle.slot = slot;
+    handle.generation = m_slotGenerations[slot];
+    return handle;
+}
+
+bool TimerTable::remove(TimerHandle handle) {
+    std::size_t index = denseIndex(handle);
+    if (index == m_deadlines.size()) {
+        return false;
+    }
+
+    // Swap-remove keeps the arrays dense
+    std::size_t last = m_deadlines.size() - 1;
+    if (index != last) {
+        m_deadlines[index] = m_deadlines[last];
+        m_periods[index] = m_periods[last];
+        m_states[index] = m_states[last];
+        m_subscribers[index] = m_subscribers[last];
+        m_denseToSlot[index] = m_denseToSlot[last];
+        m_slotToDense[m_denseToSlot[index]] = static_cast<std::uint32_t>(index);
+    }
+    m_deadlines.pop_back();
+    m_periods.pop_back();
+    m_states.pop_back();
+    m_subscribers.pop_back();
+    m_denseToSlot.pop_back();
+
+    // Invalidate outstanding handles to this slot
+    ++m_slotGenerations[handle.slot];
+    m_freeSlots.push_back(handle.slot);
+    return true;
+}
+
+bool TimerTable::contains(TimerHandle handle) const {
+    return denseIndex(handle) != m_deadlines.size();
+}
+
+bool TimerTable::reschedule(TimerHandle handle, std::int64_t deadlineNs) {
+    std::size_t index = denseIndex(handle);
+    if (index == m_deadlines.size()) {
+        return false;
+    }
+
+    m_deadlines[index] = deadlineNs;
+    m_states[index] = TimerState::Running;
+    return true;
+}
+
+std::int64_t TimerTable::getDeadline(TimerHandle handle) const {
+    std::size_t index = denseIndex(handle);
+    return index == m_deadlines.size() ? NEVER : m_deadlines[index];
+}
+
+TimerState TimerTable::getState(TimerHandle handle) const {
+    std::size_t index = denseIndex(handle);
+    return index == m_deadlines.size() ? TimerState::Expired : m_states[index];
+}
+
+void TimerTable::shiftDeadlines(std::int64_t deltaNs) {
+    // Branch-free select so the loop vectorises
+    std::int64_t* deadlines = m_deadlines.data();
+    const std::size_t count = m_deadlines.size();
+    for (std::size_t i = 0; i < count; ++i) {
+        std::int64_t deadline = deadlines[i];
+        deadlines[i] = deadline == NEVER ? deadline : deadline + deltaNs;
+    }
+}
+
+std::size_t TimerTable::expire(std::int64_t nowNs, std::vector<ExpiredTimer>& expired) {
+    expired.clear();
+
+    // The scan touches only the deadline array; other arrays are read for hits
+    const std::int64_t* deadlines = m_deadlines.data();
+    const std::size_t count = m_deadlines.size();
+    for (std::size_t i = 0; i < count; ++i) {
+        if (deadlines[i] > nowNs) {
+            continue;
+        }
+
+        std::uint32_t slot = m_denseToSlot[i];
+        ExpiredTimer timer;
+        timer.handle.slot = slot;
+        timer.handle.generation = m_slotGenerations[slot];
+        timer.subscriberId = m_subscribers[i];
+        timer.deadlineNs = deadlines[i];
+        expired.push_back(timer);
+
+        std::int64_t period = m_periods[i];
+        if (period > 0) {
+            // Skip whole periods missed while the scheduler was late
+            std::int64_t missed = (nowNs - m_deadlines[i]) / period;
+            m_deadlines[i] += (missed + 1) * period;
+        } else {
+            m_deadlines[i] = NEVER;
+            m_states[i] = TimerState::Expired;
+        }
+    }
+    return expired.size();
+}
+
+std::int64_t TimerTable::nextDeadline() const {
+    std::int64_t earliest = NEVER;
+    for (std::int64_t deadline : m_deadlines) {
+        earliest = deadline < earliest ? deadline : earliest;
+    }
+    return earliest;
+}
+
+std::size_t TimerTable::size() const {
+    return m_deadlines.size();
+}
+
+std::size_t TimerTable::denseIndex(TimerHandle handle) const {
+    if (handle.slot >= m_slotToDense.size() || m_slotGenerations[handle.slot] != handle.generation) {
+        return m_deadlines.size();
+    }
+    return m_slotToDense[handle.slot];
+}
+
+} // namespace TradingTimeCounter
@@ -0,0 +1,263 @@
+#include "tradingTimeCounter/Trace.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace TradingTimeCounter {
+
+// Static member definitions
+const std::size_t Trace::BUFFER_EVENTS;
+const std::size_t Trace::RETIRED_BUFFERS;
+
+namespace {
+
+static_assert((Trace::BUFFER_EVENTS & (Trace::BUFFER_EVENTS - 1)) == 0, "BUFFER_EVENTS must be a power of two");
+
+/**
+ * @brief Single-producer ring of one thread's spans
+ */
+struct ThreadBuffer {
+    explicit ThreadBuffer(std::uint32_t id)
+        : threadId(id)
+        , head(0)
+        , events(Trace::BUFFER_EVENTS) {
+    }
+
+    std::uint32_t threadId;                              ///< tid in the exported trace (guarded by registry mutex)
+    std::string threadName;                              ///< Name set by setThreadName (guarded by registry mutex)
+    std::atomic<std::uint64_t> head;                     ///< Events ever written
+    std::vector<TraceEvent> events;                      ///< Ring storage
+};
+
+/**
+ * @brief All thread buffers, appended on a thread's first span unless an exited thread's can be reused
+ */
+struct BufferRegistry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;  ///< Every ring, in creation order
+    std::deque<ThreadBuffer*> retired;                   ///< Rings of exited threads not yet exported, oldest first
+    std::vector<ThreadBuffer*> reusable;                 ///< Rings of exited threads free for a new thread
+    std::uint32_t nextThreadId = 1;                      ///< tid for the next thread that traces
+};
+
+BufferRegistry& registry() {
+    static BufferRegistry* instance = new BufferRegistry(); // Never destroyed: threads may trace during exit
+    return *instance;
+}
+
+/**
+ * @brief Hands the thread's ring back to the registry when the thread exits
+ */
+struct BufferOwner {
+    ~BufferOwner();
+
+    ThreadBuffer* buffer = nullptr;                      ///< Ring owned by this thread
+};
+
+/**
+ * @brief Empty an exited thread's ring and make it reusable (caller holds the registry mutex)
+ *
+ * The ring has no writer any more; emptying it keeps later exports from
+ * repeating the exited thread's spans and name until a new thread takes it.
+ */
+void releaseBuffer(BufferRegistry& buffers, ThreadBuffer& buffer) {
+    buffer.threadName.clear();
+    buffer.head.store(0, std::memory_order_release);
+    buffers.reusable.push_back(&buffer);
+}
+
+/**
+ * @brief Make every exited thread's ring reusable (caller holds the registry mutex)
+ */
+void releaseRetired(BufferRegistry& buffers) {
+    for (ThreadBuffer* buffer : buffers.retired) {
+        releaseBuffer(buffers, *buffer);
+    }
+    buffers.retired.clear();
+}
+
+thread_local ThreadBuffer* t_buffer = nullptr;
+thread_local bool t_exiting = false;
+thread_local BufferOwner t_owner;
+
+BufferOwner::~BufferOwner() {
+    t_exiting = true;
+    t_buffer = nullptr;
+    if (!buffer) {
+        return;
+    }
+
+    // Keep the spans for the next export; past the cap the oldest exited
+    // thread's ring is handed on first
+    BufferRegistry& buffers = registry();
+    std::lock_guard<std::mutex> lock(buffers.mutex);
+    buffers.retired.push_back(buffer);
+    if (buffers.retired.size() > Trace::RETIRED_BUFFERS) {
+        releaseBuffer(buffers, *buffers.retired.front());
+        buffers.retired.pop_front();
+    }
+}
+
+ThreadBuffer& threadBuffer() {
+    if (!t_buffer) {
+        BufferRegistry& buffers = registry();
+        std::lock_guard<std::mutex> lock(buffers.mutex);
+        ThreadBuffer* buffer = nullptr;
+        if (!buffers.reusable.empty()) {
+            buffer = buffers.reusable.back();
+            buffers.reusable.pop_back();
+            buffer->threadId = buffers.nextThreadId++;
+        } else {
+            buffers.buffers.push_back(std::make_unique<ThreadBuffer>(buffers.nextThreadId++));
+            buffer = buffers.buffers.back().get();
+        }
+
+        // A span recorded from another thread_local's destructor after the
+        // owner is gone keeps its ring for the rest of the process
+        if (!t_exiting) {
+            t_owner.buffer = buffer;
+        }
+        t_buffer = buffer;
+    }
+    return *t_buffer;
+}
+
+/**
+ * @brief Copy the spans of a buffer that were not overwritten while copying
+ */
+void snapshotBuffer(const ThreadBuffer& buffer, std::vector<TraceEvent>& out) {
+    const std::uint64_t capacity = Trace::BUFFER_EVENTS;
+    std::uint64_t end = buffer.head.load(std::memory_order_acquire);
+    std::uint64_t begin = end > capacity ? end - capacity : 0;
+
+    std::size_t first = out.size();
+    for (std::uint64_t i = begin; i < end; ++i) {
+        out.push_back(buffer.events[i & (capacity - 1)]);
+    }
+
+    // The writer may have lapped the oldest copied slots meanwhile, and may
+    // be overwriting one more slot than it has published
+    std::uint64_t after = buffer.head.load(std::memory_order_acquire) + 1;
+    std::uint64_t safeBegin = after > capacity ? after - capacity : 0;
+    if (safeBegin > begin) {
+        std::size_t overwritten = static_cast<std::size_t>(std::min(safeBegin - begin, end - begin));
+        out.erase(out.begin() + static_cast<std::ptrdiff_t>(first),
+                  out.begin() + static_cast<std::ptrdiff_t>(first + overwritten));
+    }
+}
+
+void writeJsonString(std::FILE* file, const char* text) {
+    std::fputc('"', file);
+    for (const char* p = text; *p; ++p) {
+        if (*p == '"' || *p == '\\') {
+            std::fputc('\\', file);
+        }
+        if (static_cast<unsigned char>(*p) >= 0x20) {
+            std::fputc(*p, file);
+        }
+    }
+    std::fputc('"', file);
+}
+
+} // namespace
+
+bool Trace::isCompiledIn() {
+#ifdef TTC_ENABLE_TRACING
+    return true;
+#else
+    return false;
+#endif
+}
+
+void Trace::record(const char* name, std::int64_t startNs, std::int64_t endNs) {
+    ThreadBuffer& buffer = threadBuffer();
+    std::uint64_t head = buffer.head.load(std::memory_order_relaxed);
+    TraceEvent& event = buffer.events[head & (BUFFER_EVENTS - 1)];
+    event.name = name;
+    event.startNs = startNs;
+    event.durationNs = endNs - startNs;
+    buffer.head.store(head + 1, std::memory_order_release);
+}
+
+void Trace::setThreadName(const std::string& name) {
+    ThreadBuffer& buffer = threadBuffer();
+    std::lock_guard<std::mutex> lock(registry().mutex);
+    buffer.threadName = name;
+}
+
+bool Trace::writeChromeJson(const std::string& path) {
+    std::FILE* file = std::fopen(path.c_str(), "w");
+    if (!file) {
+        std::cerr << "Trace: Failed to create " << path << std::endl;
+        return false;
+    }
+
+    BufferRegistry& buffers = registry();
+    std::lock_guard<std::mutex> lock(buffers.mutex);
+
+    // Complete ("X") events with microsecond timestamps, plus thread-name metadata
+    std::fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", file);
+    bool first = true;
+    std::vector<TraceEvent> events;
+    for (const std::unique_ptr<ThreadBuffer>& buffer : buffers.buffers) {
+        if (!buffer->threadName.empty()) {
+            std::fprintf(file, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":",
+                         first ? "" : ",", buffer->threadId);
+            writeJsonString(file, buffer->threadName.c_str());
+            std::fputs("}}", file);
+            first = false;
+        }
+
+        events.clear();
+        snapshotBuffer(*buffer, events);
+        for (const TraceEvent& event : events) {
+            std::fprintf(file, "%s\n{\"name\":", first ? "" : ",");
+            writeJsonString(file, event.name);
+            std::fprintf(file, ",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}", buffer->threadId,
+                         static_cast<double>(event.startNs) / 1000.0, static_cast<double>(event.durationNs) / 1000.0);
+            first = false;
+        }
+    }
+    std::fputs("\n]}\n", file);
+    releaseRetired(buffers);
+
+    if (std::fclose(file) != 0) {
+        std::cerr << "Trace: Failed to write " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+std::size_t Trace::getBufferedCount() {
+    BufferRegistry& buffers = registry();
+    std::lock_guard<std::mutex> lock(buffers.mutex);
+
+    std::size_t count = 0;
+    for (const std::unique_ptr<ThreadBuffer>& buffer : buffers.buffers) {
+        count += static_cast<std::size_t>(std::min<std::uint64_t>(buffer->head.load(std::memory_order_acquire),
+                                                                  BUFFER_EVENTS));
+    }
+    return count;
+}
+
+void Trace::clear() {
+    BufferRegistry& buffers = registry();
+    std::lock_guard<std::mutex> lock(buffers.mutex);
+    for (const std::unique_ptr<ThreadBuffer>& buffer : buffers.buffers) {
+        buffer->head.store(0, std::memory_order_release);
+    }
+    releaseRetired(buffers);
+}
+
+std::size_t Trace::getBufferCount() {
+    BufferRegistry& buffers = registry();
+    std::lock_guard<std::mutex> lock(buffers.mutex);
+    return buffers.buffers.size();
+}
+
+} // namespace TradingTimeCounter
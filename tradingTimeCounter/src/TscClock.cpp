@@ -0,0 +1,224 @@
+#include "tradingTimeCounter/TscClock.h"
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace TradingTimeCounter {
+
+// Static member definitions
+const std::int64_t TscClock::CALIBRATION_NS;
+const std::int64_t TscClock::RECALIBRATION_NS;
+std::atomic<TscClockSource> TscClock::s_source(TscClockSource::Calibrating);
+std::atomic<std::uint32_t> TscClock::s_sequence(0);
+std::atomic<std::uint64_t> TscClock::s_baseCycles(0);
+std::atomic<std::int64_t> TscClock::s_baseNs(0);
+std::atomic<std::uint64_t> TscClock::s_mult(0);
+std::atomic<std::uint64_t> TscClock::s_intervalCycles(0);
+
+namespace {
+
+const double MIN_FREQUENCY_HZ = 1.0e8;
+const double MAX_FREQUENCY_HZ = 1.0e10;
+const double MAX_RATE_DRIFT = 0.01;          // Windows disagreeing by more than 1% mean an unreliable TSC
+const double MAX_SLEW = 0.001;               // Corrections change the rate by at most 0.1%
+
+/**
+ * @brief A TSC reading paired with the steady clock
+ */
+struct ClockSample {
+    std::uint64_t cycles = 0;
+    std::int64_t steadyNs = 0;
+};
+
+/**
+ * @brief Calibration bookkeeping, guarded by the mutex
+ */
+struct Calibration {
+    std::mutex mutex;
+    bool started = false;
+    ClockSample reference;          // Kernel-clock sample the current rate was measured from
+    double nsPerCycle = 0.0;        // Last measured rate
+};
+
+Calibration& calibration() {
+    static Calibration instance;
+    return instance;
+}
+
+std::int64_t steadyNowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+#ifdef TTC_SIMD_X86
+/**
+ * @brief Pair the TSC with the steady clock, keeping the tightest of a few brackets
+ */
+ClockSample takeSample() {
+    ClockSample best;
+    std::int64_t bestWidth = 0;
+    for (int i = 0; i < 5; ++i) {
+        std::int64_t before = steadyNowNs();
+        std::uint64_t cycles = __rdtsc();
+        std::int64_t after = steadyNowNs();
+        if (i == 0 || after - before < bestWidth) {
+            bestWidth = after - before;
+            best.cycles = cycles;
+            best.steadyNs = before + (after - before) / 2;
+        }
+    }
+    return best;
+}
+#endif
+
+/**
+ * @brief Check whether the kernel itself trusts the TSC (Linux)
+ */
+bool kernelUsesTsc() {
+#ifdef __linux__
+    std::ifstream file("/sys/devices/system/clocksource/clocksource0/current_clocksource");
+    std::string source;
+    if (file >> source) {
+        return source == "tsc";
+    }
+#endif
+    return true;
+}
+
+std::uint64_t toFixedPoint(double nsPerCycle) {
+    return static_cast<std::uint64_t>(std::llround(nsPerCycle * 4294967296.0));
+}
+
+} // namespace
+
+TscClockSource TscClock::getSource() {
+    slowNowNs();
+    return s_source.load(std::memory_order_acquire);
+}
+
+const char* TscClock::getSourceName(TscClockSource source) {
+    switch (source) {
+        case TscClockSource::Tsc:
+            return "TSC";
+        case TscClockSource::SteadyClock:
+            return "steady clock";
+        default:
+            return "calibrating";
+    }
+}
+
+double TscClock::getFrequencyHz() {
+    if (s_source.load(std::memory_order_acquire) != TscClockSource::Tsc) {
+        return 0.0;
+    }
+    return 4294967296.0e9 / static_cast<double>(s_mult.load(std::memory_order_relaxed));
+}
+
+TscClockSource TscClock::waitForCalibration() {
+    TscClockSource source = getSource();
+    while (source == TscClockSource::Calibrating) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        source = getSource();
+    }
+    return source;
+}
+
+std::int64_t TscClock::slowNowNs() {
+    std::int64_t now = steadyNowNs();
+    if (s_source.load(std::memory_order_acquire) != TscClockSource::Calibrating) {
+        return now;
+    }
+
+#ifdef TTC_SIMD_X86
+    Calibration& state = calibration();
+    std::unique_lock<std::mutex> lock(state.mutex, std::try_to_lock);
+    if (!lock.owns_lock() || s_source.load(std::memory_order_acquire) != TscClockSource::Calibrating) {
+        return now;
+    }
+
+    // First use: decide whether the TSC is usable and open the calibration window
+    if (!state.started) {
+        state.started = true;
+        if (!hasInvariantTsc() || !kernelUsesTsc()) {
+            s_source.store(TscClockSource::SteadyClock, std::memory_order_release);
+            return now;
+        }
+        state.reference = takeSample();
+        return now;
+    }
+    if (now - state.reference.steadyNs < CALIBRATION_NS) {
+        return now;
+    }
+
+    ClockSample sample = takeSample();
+    double nsPerCycle = static_cast<double>(sample.steadyNs - state.reference.steadyNs)
+        / static_cast<double>(sample.cycles - state.reference.cycles);
+    double frequency = 1.0e9 / nsPerCycle;
+    if (!(frequency >= MIN_FREQUENCY_HZ && frequency <= MAX_FREQUENCY_HZ)) {
+        std::cerr << "TscClock: Implausible TSC rate " << frequency << " Hz - using the steady clock" << std::endl;
+        s_source.store(TscClockSource::SteadyClock, std::memory_order_release);
+        return now;
+    }
+
+    state.reference = sample;
+    state.nsPerCycle = nsPerCycle;
+    s_baseCycles.store(sample.cycles, std::memory_order_relaxed);
+    s_baseNs.store(sample.steadyNs, std::memory_order_relaxed);
+    s_mult.store(toFixedPoint(nsPerCycle), std::memory_order_relaxed);
+    s_intervalCycles.store(static_cast<std::uint64_t>(RECALIBRATION_NS / nsPerCycle), std::memory_order_relaxed);
+    s_sequence.store(2, std::memory_order_release);
+    s_source.store(TscClockSource::Tsc, std::memory_order_release);
+#endif
+    return now;
+}
+
+void TscClock::recalibrate(std::uint64_t cycles) {
+#ifdef TTC_SIMD_X86
+    Calibration& state = calibration();
+    std::unique_lock<std::mutex> lock(state.mutex, std::try_to_lock);
+    std::int64_t elapsed = static_cast<std::int64_t>(cycles - s_baseCycles.load(std::memory_order_relaxed));
+    if (!lock.owns_lock() || elapsed < static_cast<std::int64_t>(s_intervalCycles.load(std::memory_order_relaxed))) {
+        return; // Another thread is on it, or just did it
+    }
+
+    // Rate from kernel-clock samples only, so conversion error never accumulates
+    ClockSample sample = takeSample();
+    double nsPerCycle = static_cast<double>(sample.steadyNs - state.reference.steadyNs)
+        / static_cast<double>(sample.cycles - state.reference.cycles);
+    if (std::fabs(nsPerCycle / state.nsPerCycle - 1.0) > MAX_RATE_DRIFT) {
+        std::cerr << "TscClock: TSC rate changed by more than " << MAX_RATE_DRIFT * 100
+                  << "% - using the steady clock" << std::endl;
+        s_source.store(TscClockSource::SteadyClock, std::memory_order_release);
+        return;
+    }
+
+    // Continue from the current converted time and slew onto the kernel
+    // clock over the next interval instead of stepping
+    std::uint64_t baseCycles = s_baseCycles.load(std::memory_order_relaxed);
+    std::int64_t converted = s_baseNs.load(std::memory_order_relaxed)
+        + scaleCycles(sample.cycles - baseCycles, s_mult.load(std::memory_order_relaxed));
+    double intervalCycles = RECALIBRATION_NS / nsPerCycle;
+    double correction = static_cast<double>(sample.steadyNs - converted) / intervalCycles;
+    double limit = nsPerCycle * MAX_SLEW;
+    correction = correction > limit ? limit : (correction < -limit ? -limit : correction);
+
+    state.reference = sample;
+    state.nsPerCycle = nsPerCycle;
+
+    std::uint32_t sequence = s_sequence.load(std::memory_order_relaxed);
+    s_sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    s_baseCycles.store(sample.cycles, std::memory_order_relaxed);
+    s_baseNs.store(converted, std::memory_order_relaxed);
+    s_mult.store(toFixedPoint(nsPerCycle + correction), std::memory_order_relaxed);
+    s_intervalCycles.store(static_cast<std::uint64_t>(intervalCycles), std::memory_order_relaxed);
+    s_sequence.store(sequence + 2, std::memory_order_release);
+#else
+    (void)cycles;
+#endif
+}
+
+} // namespace TradingTimeCounter
@@ -0,0 +1,22 @@
+#include "tradingTimeCounter/VirtualClock.h"
+
+namespace TradingTimeCounter {
+
+VirtualClock::VirtualClock(std::int64_t startNs)
+    : m_nowNs(startNs) {
+}
+
+void VirtualClock::advanceTo(std::int64_t nowNs) {
+    m_nowNs.store(nowNs, std::memory_order_release);
+}
+
+std::int64_t VirtualClock::nowNs() const {
+    return m_nowNs.load(std::memory_order_acquire);
+}
+
+std::chrono::system_clock::time_point VirtualClock::now() const {
+    return std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(nowNs())));
+}
+
+} // namespace TradingTimeCounter
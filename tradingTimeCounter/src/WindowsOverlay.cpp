@@ -1,6 +1,8 @@
 #ifdef _WIN32
 
 #include "tradingTimeCounter/WindowsOverlay.h"
+#include "tradingTimeCounter/Trace.h"
+#include <cstring>
 #include <iostream>
 #include <stdexcept>
 
@@ -10,14 +12,94 @@ namespace TradingTimeCounter {
 const wchar_t* WindowsOverlay::WINDOW_CLASS_NAME = L"TradingTimeCounterOverlay";
 bool WindowsOverlay::s_classRegistered = false;
 
+GdiGlyphRasterizer::GdiGlyphRasterizer()
+    : m_fonts{nullptr, nullptr} {
+}
+
+void GdiGlyphRasterizer::setFont(HFONT font, bool bold) {
+    m_fonts[bold ? 1 : 0] = font;
+}
+
+bool GdiGlyphRasterizer::rasterize(const DisplayConfig& config, char ch, GlyphBitmap& glyph) {
+    // Family and size are baked into the fonts; pick the weight, or the other one if missing
+    HFONT font = m_fonts[config.isBold ? 1 : 0] ? m_fonts[config.isBold ? 1 : 0] : m_fonts[config.isBold ? 0 : 1];
+    if (!font) {
+        return false;
+    }
+    
+    HDC screenDC = GetDC(nullptr);
+    HDC dc = CreateCompatibleDC(screenDC);
+    ReleaseDC(nullptr, screenDC);
+    if (!dc) {
+        return false;
+    }
+    
+    HGDIOBJ oldFont = SelectObject(dc, font);
+    wchar_t wch = static_cast<wchar_t>(static_cast<unsigned char>(ch));
+    SIZE size = {0, 0};
+    GetTextExtentPoint32W(dc, &wch, 1, &size);
+    
+    bool ok = false;
+    if (size.cx > 0 && size.cy > 0) {
+        // Top-down 32-bit DIB, zero-initialised by GDI
+        BITMAPINFO bmi = {};
+        bmi.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+        bmi.bmiHeader.biWidth = size.cx;
+        bmi.bmiHeader.biHeight = -size.cy;
+        bmi.bmiHeader.biPlanes = 1;
+        bmi.bmiHeader.biBitCount = 32;
+        bmi.bmiHeader.biCompression = BI_RGB;
+        
+        void* bits = nullptr;
+        HBITMAP bitmap = CreateDIBSection(dc, &bmi, DIB_RGB_COLORS, &bits, nullptr, 0);
+        if (bitmap && bits) {
+            HGDIOBJ oldBitmap = SelectObject(dc, bitmap);
+            SetTextColor(dc, RGB(255, 255, 255));
+            SetBkMode(dc, TRANSPARENT);
+            TextOutW(dc, 0, 0, &wch, 1);
+            GdiFlush();
+            
+            // White-on-black: any channel is the coverage
+            const std::uint32_t* pixels = static_cast<const std::uint32_t*>(bits);
+            glyph.width = size.cx;
+            glyph.height = size.cy;
+            glyph.coverage.resize(static_cast<std::size_t>(size.cx) * size.cy);
+            for (std::size_t i = 0; i < glyph.coverage.size(); ++i) {
+                glyph.coverage[i] = static_cast<std::uint8_t>((pixels[i] >> 8) & 0xff);
+            }
+            
+            SelectObject(dc, oldBitmap);
+            ok = true;
+        }
+        if (bitmap) {
+            DeleteObject(bitmap);
+        }
+    }
+    
+    SelectObject(dc, oldFont);
+    DeleteDC(dc);
+    return ok;
+}
+
 WindowsOverlay::WindowsOverlay()
     : m_hwnd(nullptr)
     , m_hdc(nullptr)
     , m_memDC(nullptr)
     , m_bitmap(nullptr)
     , m_oldBitmap(nullptr)
+    , m_surfaceBits(nullptr)
+    , m_surfaceWidth(0)
+    , m_surfaceHeight(0)
     , m_font(nullptr)
+    , m_boldFont(nullptr)
     , m_oldFont(nullptr)
+    , m_renderer(PixelFormat::BGRA8)
+    , m_glyphRasterizer(std::make_shared<GdiGlyphRasterizer>())
+    , m_configHash(0)
+    , m_style(0)
+    , m_surfaceMatchesRenderer(false)
+    , m_dashboard(PixelFormat::BGRA8)
+    , m_showingDashboard(false)
     , m_isVisible(false)
     , m_isDragging(false)
     , m_dragStartPoint{0, 0}
@@ -51,15 +133,21 @@ bool WindowsOverlay::initialize(const DisplayConfig& config) {
     
     std::cout << "WindowsOverlay: Window created successfully" << std::endl;
     
-    // Create font
+    // Create font (unless built-in) and rasterise glyphs
     updateFont();
+    if (!m_renderer.configure(m_config) || !m_dashboard.configure(m_config)) {
+        std::cerr << "WindowsOverlay: Failed to prepare renderer" << std::endl;
+        return false;
+    }
+    resolveStyleHashes();
+    updateText(m_currentText);
     
     return true;
 }
 
 bool WindowsOverlay::createWindow() {
     m_hwnd = CreateWindowExW(
-        WS_EX_TOPMOST | WS_EX_TOOLWINDOW,              // Remove WS_EX_LAYERED for now
+        WS_EX_TOPMOST | WS_EX_TOOLWINDOW | WS_EX_LAYERED, // Per-pixel alpha via UpdateLayeredWindow
         WINDOW_CLASS_NAME,                              // Class name
         L"Trading Time Counter",                        // Window title
         WS_POPUP,                                      // Window styles
@@ -81,11 +169,7 @@ bool WindowsOverlay::createWindow() {
     
     std::cout << "WindowsOverlay: Window created successfully, HWND: " << m_hwnd << std::endl;
     
-    // Set transparency using SetLayeredWindowAttributes instead
-    SetWindowLongPtr(m_hwnd, GWL_EXSTYLE, 
-                    GetWindowLongPtr(m_hwnd, GWL_EXSTYLE) | WS_EX_LAYERED);
-    SetLayeredWindowAttributes(m_hwnd, 0, m_config.opacity, LWA_ALPHA);
-    
+    // Opacity is baked into the premultiplied framebuffer; no SetLayeredWindowAttributes
     return true;
 }
 
@@ -115,72 +199,248 @@ void WindowsOverlay::updateText(const std::string& text) {
         return;
     }
     
-    // Trigger a repaint
-    InvalidateRect(m_hwnd, nullptr, TRUE);
-    UpdateWindow(m_hwnd);
+    // Leaving dashboard mode: the surface holds the dashboard
+    if (m_showingDashboard) {
+        m_showingDashboard = false;
+        m_surfaceMatchesRenderer = false;
+    }
+    
+    // A cached frame is already finished; copy it whole
+    std::shared_ptr<const Framebuffer> frame = m_frameCache.find(m_currentText, m_configHash);
+    if (frame) {
+        present(*frame, RenderRect{0, 0, frame->getWidth(), frame->getHeight()});
+        m_surfaceMatchesRenderer = false;
+        return;
+    }
+    
+    // Re-render changed cells; present only those if the surface holds the renderer's last frame
+    RenderRect dirty = m_renderer.render(m_currentText);
+    const Framebuffer& rendered = m_renderer.getFramebuffer();
+    if (!m_surfaceMatchesRenderer) {
+        dirty = RenderRect{0, 0, rendered.getWidth(), rendered.getHeight()};
+    }
+    present(rendered, dirty);
+    m_surfaceMatchesRenderer = true;
+    
+    m_frameCache.insert(m_currentText, m_configHash, std::make_shared<const Framebuffer>(rendered));
+}
+
+void WindowsOverlay::prewarmTexts(const std::vector<std::string>& texts) {
+    if (!m_hwnd) {
+        return;
+    }
+    
+    // Prewarming renders into m_renderer, so the surface no longer matches it
+    if (m_frameCache.prewarm(m_renderer, m_configHash, texts) > 0) {
+        m_surfaceMatchesRenderer = false;
+    }
+}
+
+bool WindowsOverlay::updateDashboard(const std::vector<DashboardRow>& rows) {
+    m_dashboardRows = rows;
+    
+    if (!m_hwnd) {
+        std::cerr << "WindowsOverlay: Cannot update dashboard - missing hwnd" << std::endl;
+        return false;
+    }
+    
+    // Only changed value cells are redrawn; the window follows the layout size
+    RenderRect dirty = m_dashboard.render(m_dashboardRows);
+    const Framebuffer& rendered = m_dashboard.getFramebuffer();
+    if (!m_showingDashboard) {
+        dirty = RenderRect{0, 0, rendered.getWidth(), rendered.getHeight()};
+    }
+    present(rendered, dirty);
+    m_showingDashboard = true;
+    m_surfaceMatchesRenderer = false;
+    return true;
+}
+
+bool WindowsOverlay::setStyles(const std::vector<DisplayStyle>& styles) {
+    // Resolved now (colors, glyphs per weight, frame-cache keys) and at every updateConfig()
+    m_styles = styles;
+    m_style = 0;
+    bool resolved = m_renderer.setStyles(m_styles);
+    resolveStyleHashes();
+    m_surfaceMatchesRenderer = false;
+    if (m_hwnd && !m_showingDashboard) {
+        updateText(m_currentText);
+    }
+    return resolved;
+}
+
+void WindowsOverlay::selectStyle(std::size_t index) {
+    if (index == m_style || !m_renderer.selectStyle(index)) {
+        return;
+    }
+    
+    // An index swap: the renderer and frame-cache key are already resolved
+    m_style = index;
+    m_configHash = m_styleHashes[index];
+    m_surfaceMatchesRenderer = false;
+    if (m_hwnd && !m_showingDashboard) {
+        updateText(m_currentText);
+    }
+}
+
+void WindowsOverlay::resolveStyleHashes() {
+    m_styleHashes.clear();
+    if (m_styles.empty()) {
+        m_styleHashes.push_back(FrameCache::hashConfig(m_config));
+    }
+    for (const DisplayStyle& style : m_styles) {
+        m_styleHashes.push_back(FrameCache::hashConfig(style.applyTo(m_config)));
+    }
+    m_style = m_style < m_styleHashes.size() ? m_style : 0;
+    m_configHash = m_styleHashes[m_style];
+}
+
+FrameCacheStats WindowsOverlay::getFrameCacheStats() const {
+    return m_frameCache.getStats();
 }
 
 void WindowsOverlay::updateFont() {
-    // Delete old font if exists
-    if (m_font) {
-        DeleteObject(m_font);
-        m_font = nullptr;
+    // Delete old fonts if they exist
+    m_glyphRasterizer->setFont(nullptr, false);
+    m_glyphRasterizer->setFont(nullptr, true);
+    for (HFONT* font : {&m_font, &m_boldFont}) {
+        if (*font) {
+            DeleteObject(*font);
+            *font = nullptr;
+        }
     }
     
-    // Create new font
-    int fontWeight = m_config.isBold ? FW_BOLD : FW_NORMAL;
+    // The built-in font is served from the compile-time glyph atlas; no GDI font needed
+    if (m_config.fontFamily == BuiltinGlyphRasterizer::FONT_FAMILY) {
+        auto builtin = std::make_shared<BuiltinGlyphRasterizer>();
+        m_renderer.setGlyphRasterizer(builtin);
+        m_dashboard.setGlyphRasterizer(builtin);
+        std::cout << "WindowsOverlay: Using built-in glyph atlas" << std::endl;
+        return;
+    }
+    
+    // Create both weights, so alert styles switch weight without a font rebuild
     std::wstring wFontFamily(m_config.fontFamily.begin(), m_config.fontFamily.end());
+    for (bool bold : {false, true}) {
+        HFONT font = CreateFontW(
+            m_config.fontSize,          // Height
+            0,                          // Width (0 = default)
+            0,                          // Escapement
+            0,                          // Orientation
+            bold ? FW_BOLD : FW_NORMAL, // Weight
+            FALSE,                      // Italic
+            FALSE,                      // Underline
+            FALSE,                      // StrikeOut
+            DEFAULT_CHARSET,            // CharSet
+            OUT_DEFAULT_PRECIS,         // OutPrecision
+            CLIP_DEFAULT_PRECIS,        // ClipPrecision
+            ANTIALIASED_QUALITY,        // Quality (grayscale coverage for the renderer)
+            DEFAULT_PITCH | FF_DONTCARE, // PitchAndFamily
+            wFontFamily.c_str()         // FaceName
+        );
+        
+        if (!font) {
+            std::cerr << "WindowsOverlay: Failed to create " << (bold ? "bold" : "regular") << " font" << std::endl;
+        }
+        (bold ? m_boldFont : m_font) = font;
+        m_glyphRasterizer->setFont(font, bold);
+    }
+    std::cout << "WindowsOverlay: Fonts created" << std::endl;
     
-    m_font = CreateFontW(
-        m_config.fontSize,          // Height
-        0,                          // Width (0 = default)
-        0,                          // Escapement
-        0,                          // Orientation
-        fontWeight,                 // Weight
-        FALSE,                      // Italic
-        FALSE,                      // Underline
-        FALSE,                      // StrikeOut
-        DEFAULT_CHARSET,            // CharSet
-        OUT_DEFAULT_PRECIS,         // OutPrecision
-        CLIP_DEFAULT_PRECIS,        // ClipPrecision
-        CLEARTYPE_QUALITY,          // Quality
-        DEFAULT_PITCH | FF_DONTCARE, // PitchAndFamily
-        wFontFamily.c_str()         // FaceName
-    );
+    m_renderer.setGlyphRasterizer(m_glyphRasterizer);
+    m_dashboard.setGlyphRasterizer(m_glyphRasterizer);
+}
+
+void WindowsOverlay::present(const Framebuffer& frame, const RenderRect& dirty) {
+    TTC_TRACE_SCOPE("WindowsOverlay::present");
+    if (!m_hwnd || dirty.isEmpty()) {
+        return;
+    }
     
-    if (!m_font) {
-        std::cerr << "WindowsOverlay: Failed to create font" << std::endl;
-    } else {
-        std::cout << "WindowsOverlay: Font created successfully" << std::endl;
+    // A new surface needs the whole frame
+    RenderRect region = dirty;
+    if (!m_bitmap || frame.getWidth() != m_surfaceWidth || frame.getHeight() != m_surfaceHeight) {
+        if (!ensureSurface(frame.getWidth(), frame.getHeight())) {
+            return;
+        }
+        region = RenderRect{0, 0, m_surfaceWidth, m_surfaceHeight};
+    }
+    
+    // Copy only the dirty rows/columns into the DIB
+    std::uint32_t* surface = static_cast<std::uint32_t*>(m_surfaceBits);
+    for (int y = region.y; y < region.y + region.height; ++y) {
+        std::memcpy(surface + static_cast<std::size_t>(y) * m_surfaceWidth + region.x,
+                    frame.row(y) + region.x,
+                    static_cast<std::size_t>(region.width) * sizeof(std::uint32_t));
     }
+    
+    SIZE size = {m_surfaceWidth, m_surfaceHeight};
+    POINT source = {0, 0};
+    BLENDFUNCTION blend = {AC_SRC_OVER, 0, 255, AC_SRC_ALPHA};
+    UpdateLayeredWindow(m_hwnd, nullptr, nullptr, &size, m_memDC, &source, 0, &blend, ULW_ALPHA);
 }
 
-SIZE WindowsOverlay::calculateTextSize(const std::string& text) {
-    SIZE size = {0, 0};
+bool WindowsOverlay::ensureSurface(int width, int height) {
+    if (m_bitmap && width == m_surfaceWidth && height == m_surfaceHeight) {
+        return true;
+    }
+    releaseSurface();
     
-    if (!m_hwnd || text.empty()) {
-        return size;
+    if (width <= 0 || height <= 0) {
+        return false;
     }
     
-    HDC hdc = GetDC(m_hwnd);
-    if (hdc) {
-        if (m_font) {
-            SelectObject(hdc, m_font);
-        }
-        
-        std::wstring wtext(text.begin(), text.end());
-        GetTextExtentPoint32W(hdc, wtext.c_str(), (int)wtext.length(), &size);
-        
-        ReleaseDC(m_hwnd, hdc);
+    HDC screenDC = GetDC(nullptr);
+    m_memDC = CreateCompatibleDC(screenDC);
+    ReleaseDC(nullptr, screenDC);
+    if (!m_memDC) {
+        return false;
+    }
+    
+    // Top-down premultiplied BGRA, matching the renderer's framebuffer
+    BITMAPINFO bmi = {};
+    bmi.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+    bmi.bmiHeader.biWidth = width;
+    bmi.bmiHeader.biHeight = -height;
+    bmi.bmiHeader.biPlanes = 1;
+    bmi.bmiHeader.biBitCount = 32;
+    bmi.bmiHeader.biCompression = BI_RGB;
+    
+    m_bitmap = CreateDIBSection(m_memDC, &bmi, DIB_RGB_COLORS, &m_surfaceBits, nullptr, 0);
+    if (!m_bitmap || !m_surfaceBits) {
+        std::cerr << "WindowsOverlay: Failed to create presentation surface" << std::endl;
+        releaseSurface();
+        return false;
     }
     
-    return size;
+    m_oldBitmap = static_cast<HBITMAP>(SelectObject(m_memDC, m_bitmap));
+    m_surfaceWidth = width;
+    m_surfaceHeight = height;
+    return true;
+}
+
+void WindowsOverlay::releaseSurface() {
+    if (m_memDC) {
+        if (m_oldBitmap) {
+            SelectObject(m_memDC, m_oldBitmap);
+            m_oldBitmap = nullptr;
+        }
+        DeleteDC(m_memDC);
+        m_memDC = nullptr;
+    }
+    if (m_bitmap) {
+        DeleteObject(m_bitmap);
+        m_bitmap = nullptr;
+    }
+    m_surfaceBits = nullptr;
+    m_surfaceWidth = 0;
+    m_surfaceHeight = 0;
 }
 
 void WindowsOverlay::updateConfig(const DisplayConfig& config) {
+    // Both weights always exist, so a weight change needs no new font
     bool needFontUpdate = (config.fontFamily != m_config.fontFamily ||
-                          config.fontSize != m_config.fontSize ||
-                          config.isBold != m_config.isBold);
+                          config.fontSize != m_config.fontSize);
     
     bool needResize = (config.windowWidth != m_config.windowWidth ||
                       config.windowHeight != m_config.windowHeight);
@@ -195,25 +455,26 @@ void WindowsOverlay::updateConfig(const DisplayConfig& config) {
                         m_config.windowWidth, m_config.windowHeight,
                         SWP_SHOWWINDOW);
             
-            // Recreate bitmap for new size
-            if (m_bitmap) {
-                SelectObject(m_memDC, m_oldBitmap);
-                DeleteObject(m_bitmap);
-                m_bitmap = CreateCompatibleBitmap(m_hdc, m_config.windowWidth, m_config.windowHeight);
-                m_oldBitmap = (HBITMAP)SelectObject(m_memDC, m_bitmap);
-            }
+            // Presentation surface is recreated at the new size on next present
+            releaseSurface();
         }
         
-        // Update transparency
-        SetLayeredWindowAttributes(m_hwnd, 0, m_config.opacity, LWA_ALPHA);
-        
         // Update font if needed
         if (needFontUpdate) {
             updateFont();
         }
         
-        // Redraw with current text
-        updateText(m_currentText);
+        // Resolve colors, opacity and glyphs, then redraw the current content
+        m_renderer.configure(m_config);
+        m_dashboard.configure(m_config);
+        resolveStyleHashes();
+        m_surfaceMatchesRenderer = false;
+        if (m_showingDashboard) {
+            m_showingDashboard = false;
+            updateDashboard(m_dashboardRows);
+        } else {
+            updateText(m_currentText);
+        }
     }
 }
 
@@ -248,10 +509,17 @@ bool WindowsOverlay::isVisible() const {
 }
 
 void WindowsOverlay::destroy() {
-    // Clean up font
-    if (m_font) {
-        DeleteObject(m_font);
-        m_font = nullptr;
+    // Clean up presentation surface
+    releaseSurface();
+    
+    // Clean up fonts
+    m_glyphRasterizer->setFont(nullptr, false);
+    m_glyphRasterizer->setFont(nullptr, true);
+    for (HFONT* font : {&m_font, &m_boldFont}) {
+        if (*font) {
+            DeleteObject(*font);
+            *font = nullptr;
+        }
     }
     
     // Destroy window
@@ -314,38 +582,9 @@ LRESULT WindowsOverlay::handleMessage(UINT uMsg, WPARAM wParam, LPARAM lParam) {
     switch (uMsg) {
         case WM_PAINT:
             {
+                // Content is presented with UpdateLayeredWindow; just validate
                 PAINTSTRUCT ps;
-                HDC hdc = BeginPaint(m_hwnd, &ps);
-                
-                // Set background color
-                HBRUSH bgBrush = CreateSolidBrush(RGB(m_config.backgroundColor.r, 
-                                                     m_config.backgroundColor.g, 
-                                                     m_config.backgroundColor.b));
-                FillRect(hdc, &ps.rcPaint, bgBrush);
-                DeleteObject(bgBrush);
-                
-                // Set text properties
-                SetTextColor(hdc, RGB(m_config.textColor.r, 
-                                     m_config.textColor.g, 
-                                     m_config.textColor.b));
-                SetBkMode(hdc, TRANSPARENT);
-                
-                // Select font
-                if (m_font) {
-                    SelectObject(hdc, m_font);
-                }
-                
-                // Calculate text position (center)
-                std::wstring wtext(m_currentText.begin(), m_currentText.end());
-                SIZE textSize;
-                GetTextExtentPoint32W(hdc, wtext.c_str(), (int)wtext.length(), &textSize);
-                
-                int x = (m_config.windowWidth - textSize.cx) / 2;
-                int y = (m_config.windowHeight - textSize.cy) / 2;
-                
-                // Draw text
-                TextOutW(hdc, x, y, wtext.c_str(), (int)wtext.length());
-                
+                BeginPaint(m_hwnd, &ps);
                 EndPaint(m_hwnd, &ps);
             }
             return 0;
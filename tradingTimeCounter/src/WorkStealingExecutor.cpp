@@ -0,0 +1,239 @@
+#include "tradingTimeCounter/WorkStealingExecutor.h"
+#include "tradingTimeCounter/Trace.h"
+#include <algorithm>
+#include <iterator>
+#include <string>
+
+namespace TradingTimeCounter {
+
+namespace {
+
+// Worker identity of the current thread, so posts from a task stay local
+thread_local const WorkStealingExecutor* t_executor = nullptr;
+thread_local std::size_t t_workerIndex = 0;
+
+} // namespace
+
+// Static member definitions
+const std::size_t WorkStealingExecutor::LANE_COUNT;
+const std::size_t WorkStealingExecutor::MAX_LANE_RUN;
+
+WorkStealingExecutor::WorkStealingExecutor(std::size_t threadCount)
+    : m_lanes(std::make_unique<Lane[]>(LANE_COUNT))
+    , m_queued(0)
+    , m_sleeping(0)
+    , m_nextWorker(0)
+    , m_shouldStop(false)
+    , m_posted(0)
+    , m_stolen(0)
+    , m_batches(0) {
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    
+    // Every deque exists before any worker can try to steal from it
+    for (std::size_t i = 0; i < threadCount; ++i) {
+        m_workers.push_back(std::make_unique<Worker>());
+    }
+    for (std::size_t i = 0; i < threadCount; ++i) {
+        m_workers[i]->thread = std::thread(&WorkStealingExecutor::workerThreadFunction, this, i);
+    }
+}
+
+WorkStealingExecutor::~WorkStealingExecutor() {
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_shouldStop = true;
+    }
+    m_sleepCondition.notify_all();
+    
+    for (std::unique_ptr<Worker>& worker : m_workers) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+}
+
+void WorkStealingExecutor::post(std::function<void()> task) {
+    m_posted.fetch_add(1, std::memory_order_relaxed);
+    push(targetWorker(), std::move(task));
+    wakeWorkers(1);
+}
+
+void WorkStealingExecutor::postOrdered(std::uint64_t key, std::function<void()> task) {
+    m_posted.fetch_add(1, std::memory_order_relaxed);
+    
+    // Fibonacci hashing spreads adjacent keys (addresses, ids) over the lanes
+    Lane& lane = m_lanes[(key * 0x9E3779B97F4A7C15ULL) >> 32 & (LANE_COUNT - 1)];
+    {
+        std::lock_guard<std::mutex> lock(lane.mutex);
+        lane.tasks.push_back(std::move(task));
+        if (lane.scheduled) {
+            return; // The queued drain will run it
+        }
+        lane.scheduled = true;
+    }
+    push(targetWorker(), [this, &lane]() { drainLane(lane); });
+    wakeWorkers(1);
+}
+
+void WorkStealingExecutor::postBatch(std::vector<std::function<void()>>& tasks) {
+    if (tasks.empty()) {
+        return;
+    }
+    
+    // One contiguous chunk per worker, each handed off under a single lock
+    const std::size_t count = tasks.size();
+    const std::size_t workers = m_workers.size();
+    const std::size_t chunk = (count + workers - 1) / workers;
+    const std::size_t first = m_nextWorker.fetch_add(1, std::memory_order_relaxed);
+    std::size_t offset = 0;
+    for (std::size_t i = 0; offset < count; ++i) {
+        Worker& worker = *m_workers[(first + i) % workers];
+        std::size_t end = std::min(count, offset + chunk);
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        for (; offset < end; ++offset) {
+            worker.tasks.push_back(std::move(tasks[offset]));
+        }
+    }
+    tasks.clear();
+    
+    m_posted.fetch_add(count, std::memory_order_relaxed);
+    m_batches.fetch_add(1, std::memory_order_relaxed);
+    m_queued.fetch_add(count);
+    wakeWorkers(count);
+}
+
+std::size_t WorkStealingExecutor::getThreadCount() const {
+    return m_workers.size();
+}
+
+ExecutorStats WorkStealingExecutor::getStats() const {
+    ExecutorStats stats;
+    stats.posted = m_posted.load();
+    stats.stolen = m_stolen.load();
+    stats.batches = m_batches.load();
+    return stats;
+}
+
+void WorkStealingExecutor::workerThreadFunction(std::size_t index) {
+    t_executor = this;
+    t_workerIndex = index;
+    TTC_TRACE_THREAD_NAME("WorkStealingExecutor worker " + std::to_string(index));
+    
+    std::function<void()> task;
+    while (true) {
+        if (popLocal(index, task) || steal(index, task)) {
+            m_queued.fetch_sub(1);
+            TTC_TRACE_SCOPE("WorkStealingExecutor::task");
+            task();
+            task = nullptr;
+            continue;
+        }
+        
+        // Sleep until work is queued; leave only once everything has run
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_sleeping.fetch_add(1);
+        m_sleepCondition.wait(lock, [this]() { return m_queued.load() > 0 || m_shouldStop; });
+        m_sleeping.fetch_sub(1);
+        if (m_shouldStop && m_queued.load() == 0) {
+            break;
+        }
+    }
+}
+
+bool WorkStealingExecutor::popLocal(std::size_t index, std::function<void()>& task) {
+    Worker& worker = *m_workers[index];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    if (worker.tasks.empty()) {
+        return false;
+    }
+    task = std::move(worker.tasks.front());
+    worker.tasks.pop_front();
+    return true;
+}
+
+bool WorkStealingExecutor::steal(std::size_t thief, std::function<void()>& task) {
+    const std::size_t workers = m_workers.size();
+    for (std::size_t i = 1; i < workers; ++i) {
+        Worker& victim = *m_workers[(thief + i) % workers];
+        std::deque<std::function<void()>> taken;
+        {
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (victim.tasks.empty()) {
+                continue;
+            }
+            
+            // Take the back half, leaving the victim the work it will reach first
+            std::size_t count = (victim.tasks.size() + 1) / 2;
+            auto begin = victim.tasks.end() - static_cast<std::ptrdiff_t>(count);
+            taken.assign(std::make_move_iterator(begin), std::make_move_iterator(victim.tasks.end()));
+            victim.tasks.erase(begin, victim.tasks.end());
+        }
+        m_stolen.fetch_add(taken.size(), std::memory_order_relaxed);
+        
+        task = std::move(taken.front());
+        taken.pop_front();
+        if (!taken.empty()) {
+            Worker& own = *m_workers[thief];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            own.tasks.insert(own.tasks.end(), std::make_move_iterator(taken.begin()),
+                             std::make_move_iterator(taken.end()));
+        }
+        return true;
+    }
+    return false;
+}
+
+void WorkStealingExecutor::push(std::size_t index, std::function<void()> task) {
+    Worker& worker = *m_workers[index];
+    {
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.tasks.push_back(std::move(task));
+    }
+    m_queued.fetch_add(1);
+}
+
+std::size_t WorkStealingExecutor::targetWorker() {
+    if (t_executor == this) {
+        return t_workerIndex;
+    }
+    return m_nextWorker.fetch_add(1, std::memory_order_relaxed) % m_workers.size();
+}
+
+void WorkStealingExecutor::wakeWorkers(std::size_t count) {
+    // Pairs with the sleeper's increment before it re-checks m_queued
+    if (m_sleeping.load() == 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_sleepMutex);
+    if (count == 1) {
+        m_sleepCondition.notify_one();
+    } else {
+        m_sleepCondition.notify_all();
+    }
+}
+
+void WorkStealingExecutor::drainLane(Lane& lane) {
+    for (std::size_t run = 0;; ++run) {
+        std::function<void()> task;
+        {
+            std::lock_guard<std::mutex> lock(lane.mutex);
+            if (lane.tasks.empty()) {
+                lane.scheduled = false;
+                return;
+            }
+            if (run == MAX_LANE_RUN) {
+                break; // Still scheduled; let other work run first
+            }
+            task = std::move(lane.tasks.front());
+            lane.tasks.pop_front();
+        }
+        task();
+    }
+    
+    push(targetWorker(), [this, &lane]() { drainLane(lane); });
+    wakeWorkers(1);
+}
+
+} // namespace TradingTimeCounter
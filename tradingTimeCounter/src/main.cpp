@@ -26,6 +26,14 @@ int main() {
         config.isLocked = false;
         config.opacity = 220;                    // Slightly transparent
         
+        // Resume timers across restarts
+        app.setStatePath("tradingTimeCounter.state");
+        
+#ifdef __linux__
+        // Wake local processes waiting on bar closes
+        app.setBoundarySignalPath("/dev/shm/tradingTimeCounter.boundaries");
+#endif
+        
         // Initialize application
         if (!app.initialize(config)) {
             std::cerr << "Failed to initialize application!" << std::endl;
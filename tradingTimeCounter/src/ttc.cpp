@@ -0,0 +1,233 @@
+#include "tradingTimeCounter/ttc.h"
+#include "tradingTimeCounter/BoundaryBatch.h"
+#include "tradingTimeCounter/CountdownTimer.h"
+#include <memory>
+
+using namespace TradingTimeCounter;
+
+/**
+ * @brief Object behind the opaque C handle
+ */
+struct ttc_timer {
+    std::unique_ptr<CountdownTimer> timer;               ///< Wrapped timer
+};
+
+namespace {
+
+const std::int64_t SECONDS_PER_DAY = 24 * 60 * 60;
+
+/**
+ * @brief Forwards ITimerCallback notifications to a C function pointer
+ */
+class CallbackBridge : public ITimerCallback {
+public:
+    CallbackBridge(ttc_callback callback, void* context, ttc_timer* handle)
+        : m_callback(callback)
+        , m_context(context)
+        , m_handle(handle) {
+    }
+    
+    void onTimerUpdate(int remainingSeconds) override { emit(TTC_EVENT_UPDATE, remainingSeconds); }
+    void onTimerCompleted() override { emit(TTC_EVENT_COMPLETED, 0); }
+    void onTimerStarted() override { emit(TTC_EVENT_STARTED, 0); }
+    void onTimerStopped() override { emit(TTC_EVENT_STOPPED, 0); }
+    void onTimerResync(int remainingSeconds) override { emit(TTC_EVENT_RESYNC, remainingSeconds); }
+
+private:
+    void emit(ttc_event event, int remainingSeconds) {
+        m_callback(m_context, m_handle, static_cast<std::int32_t>(event), static_cast<std::int32_t>(remainingSeconds));
+    }
+    
+    ttc_callback m_callback;                             ///< Host function
+    void* m_context;                                     ///< Host context
+    ttc_timer* m_handle;                                 ///< Handle passed back to the host
+};
+
+/**
+ * @brief Create a timer handle, reporting failure as NULL
+ */
+ttc_timer* createTimer(std::int32_t minutes, bool aligned) {
+    if (minutes <= 0) {
+        return nullptr;
+    }
+    try {
+        std::unique_ptr<ttc_timer> handle(new ttc_timer);
+        handle->timer = std::make_unique<CountdownTimer>(minutes);
+        handle->timer->setWallClockAligned(aligned);
+        return handle.release();
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+/**
+ * @brief Seconds to the first boundary strictly after now, in (0, period]
+ */
+std::int64_t secondsToBoundary(std::int64_t nowSeconds, std::int64_t periodSeconds, std::int64_t offsetSeconds) {
+    // Floored modulo, so times before the offset still land on the grid
+    std::int64_t phase = (nowSeconds - offsetSeconds) % periodSeconds;
+    if (phase < 0) {
+        phase += periodSeconds;
+    }
+    return periodSeconds - phase;
+}
+
+} // namespace
+
+extern "C" {
+
+uint32_t ttc_abi_version(void) {
+    return TTC_ABI_VERSION;
+}
+
+ttc_timer* ttc_timer_create(int32_t duration_minutes) {
+    return createTimer(duration_minutes, false);
+}
+
+ttc_timer* ttc_bar_timer_create(int32_t period_minutes) {
+    return createTimer(period_minutes, true);
+}
+
+void ttc_timer_destroy(ttc_timer* timer) {
+    delete timer;
+}
+
+int32_t ttc_timer_start(ttc_timer* timer) {
+    if (!timer) {
+        return TTC_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        timer->timer->start();
+        return TTC_OK;
+    } catch (...) {
+        return TTC_ERROR_INTERNAL;
+    }
+}
+
+int32_t ttc_timer_stop(ttc_timer* timer) {
+    if (!timer) {
+        return TTC_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        timer->timer->stop();
+        return TTC_OK;
+    } catch (...) {
+        return TTC_ERROR_INTERNAL;
+    }
+}
+
+int32_t ttc_timer_reset(ttc_timer* timer) {
+    if (!timer) {
+        return TTC_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        timer->timer->reset();
+        return TTC_OK;
+    } catch (...) {
+        return TTC_ERROR_INTERNAL;
+    }
+}
+
+int32_t ttc_timer_get_snapshot(const ttc_timer* timer, ttc_snapshot* snapshot) {
+    if (!timer || !snapshot) {
+        return TTC_ERROR_INVALID_ARGUMENT;
+    }
+    CountdownSnapshot current = timer->timer->getSnapshot();
+    snapshot->remaining_ms = current.remainingMs;
+    snapshot->state = static_cast<uint32_t>(current.state);
+    snapshot->generation = current.generation;
+    snapshot->reserved = 0;
+    return TTC_OK;
+}
+
+int32_t ttc_timer_format(const ttc_timer* timer, char* buffer, size_t size) {
+    if (!timer || !buffer) {
+        return TTC_ERROR_INVALID_ARGUMENT;
+    }
+    
+    // Written digit by digit: DisplayPrecisionPolicy::format would allocate
+    int seconds = timer->timer->getSnapshot().getRemainingSeconds();
+    int minutes = seconds / 60;
+    char digits[12];
+    int minuteDigits = 0;
+    do {
+        digits[minuteDigits++] = static_cast<char>('0' + minutes % 10);
+        minutes /= 10;
+    } while (minutes > 0 || minuteDigits < 2);
+    
+    const size_t length = static_cast<size_t>(minuteDigits) + 3;
+    if (size < length + 1) {
+        return TTC_ERROR_BUFFER_TOO_SMALL;
+    }
+    for (int i = 0; i < minuteDigits; ++i) {
+        buffer[i] = digits[minuteDigits - 1 - i];
+    }
+    buffer[minuteDigits] = ':';
+    buffer[minuteDigits + 1] = static_cast<char>('0' + seconds % 60 / 10);
+    buffer[minuteDigits + 2] = static_cast<char>('0' + seconds % 10);
+    buffer[length] = '\0';
+    return TTC_OK;
+}
+
+int32_t ttc_timer_set_callback(ttc_timer* timer, ttc_callback callback, void* context) {
+    if (!timer) {
+        return TTC_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        if (callback) {
+            timer->timer->setCallback(std::make_shared<CallbackBridge>(callback, context, timer));
+        } else {
+            timer->timer->setCallback(nullptr);
+        }
+        return TTC_OK;
+    } catch (...) {
+        return TTC_ERROR_INTERNAL;
+    }
+}
+
+int32_t ttc_seconds_to_boundary(int64_t now_seconds, int32_t period_seconds, int32_t offset_seconds) {
+    if (period_seconds <= 0) {
+        return TTC_ERROR_INVALID_ARGUMENT;
+    }
+    return static_cast<int32_t>(secondsToBoundary(now_seconds, period_seconds, offset_seconds));
+}
+
+int32_t ttc_seconds_to_boundary_batch(const int32_t* periods, const int32_t* offsets, size_t count,
+                                      int64_t now_seconds, int32_t* remaining) {
+    if (count > 0 && (!periods || !offsets || !remaining)) {
+        return TTC_ERROR_INVALID_ARGUMENT;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        if (periods[i] <= 0) {
+            return TTC_ERROR_INVALID_ARGUMENT;
+        }
+    }
+    BoundaryBatch::computeRemaining(periods, offsets, count, now_seconds, remaining);
+    
+    // The SIMD kernels assume now >= offset; floor the rest like the single-pair call
+    for (size_t i = 0; i < count; ++i) {
+        if (now_seconds < offsets[i]) {
+            remaining[i] = static_cast<int32_t>(secondsToBoundary(now_seconds, periods[i], offsets[i]));
+        }
+    }
+    return TTC_OK;
+}
+
+int32_t ttc_session_status_at(int64_t now_seconds, int32_t open_utc_seconds, int32_t close_utc_seconds,
+                              ttc_session_status* status) {
+    if (!status || open_utc_seconds < 0 || open_utc_seconds >= SECONDS_PER_DAY || close_utc_seconds < 0
+        || close_utc_seconds >= SECONDS_PER_DAY || open_utc_seconds == close_utc_seconds) {
+        return TTC_ERROR_INVALID_ARGUMENT;
+    }
+    
+    // Inside the session exactly when the next close comes before the next open
+    std::int64_t toOpen = secondsToBoundary(now_seconds, SECONDS_PER_DAY, open_utc_seconds);
+    std::int64_t toClose = secondsToBoundary(now_seconds, SECONDS_PER_DAY, close_utc_seconds);
+    status->in_session = toClose < toOpen ? 1 : 0;
+    status->seconds_to_open = static_cast<int32_t>(toOpen);
+    status->seconds_to_close = static_cast<int32_t>(toClose);
+    status->reserved = 0;
+    return TTC_OK;
+}
+
+} // extern "C"
@@ -0,0 +1,153 @@
+/*
+ * C99 host for libttc: checks argument validation, error codes, boundary
+ * and session math and callback delivery through the public header only.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "tradingTimeCounter/ttc.h"
+
+static int g_failures = 0;
+
+#define CHECK(condition) \
+    do { \
+        if (!(condition)) { \
+            fprintf(stderr, "capiHostTest: %s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            ++g_failures; \
+        } \
+    } while (0)
+
+typedef struct EventCounts {
+    int started;
+    int stopped;
+} EventCounts;
+
+static void countEvents(void* context, ttc_timer* timer, int32_t event, int32_t remaining_seconds) {
+    EventCounts* counts = (EventCounts*)context;
+    (void)timer;
+    (void)remaining_seconds;
+    if (event == TTC_EVENT_STARTED) {
+        ++counts->started;
+    } else if (event == TTC_EVENT_STOPPED) {
+        ++counts->stopped;
+    }
+}
+
+static void testArguments(void) {
+    ttc_snapshot snapshot;
+    char buffer[16];
+
+    CHECK(ttc_abi_version() == 1);
+    CHECK(ttc_timer_create(0) == NULL);
+    CHECK(ttc_bar_timer_create(-5) == NULL);
+    CHECK(ttc_timer_start(NULL) == TTC_ERROR_INVALID_ARGUMENT);
+    CHECK(ttc_timer_stop(NULL) == TTC_ERROR_INVALID_ARGUMENT);
+    CHECK(ttc_timer_reset(NULL) == TTC_ERROR_INVALID_ARGUMENT);
+    CHECK(ttc_timer_get_snapshot(NULL, &snapshot) == TTC_ERROR_INVALID_ARGUMENT);
+    CHECK(ttc_timer_format(NULL, buffer, sizeof(buffer)) == TTC_ERROR_INVALID_ARGUMENT);
+    CHECK(ttc_timer_set_callback(NULL, countEvents, NULL) == TTC_ERROR_INVALID_ARGUMENT);
+    CHECK(ttc_seconds_to_boundary(100, 0, 0) == TTC_ERROR_INVALID_ARGUMENT);
+    ttc_timer_destroy(NULL);
+}
+
+static void testTimer(void) {
+    ttc_timer* timer = ttc_timer_create(5);
+    ttc_snapshot snapshot;
+    char small[4];
+    char buffer[16];
+    EventCounts counts = {0, 0};
+
+    CHECK(timer != NULL);
+    if (!timer) {
+        return;
+    }
+    CHECK(ttc_timer_get_snapshot(timer, &snapshot) == TTC_OK);
+    CHECK(snapshot.state == TTC_STATE_STOPPED);
+    CHECK(snapshot.remaining_ms == 5 * 60 * 1000);
+    CHECK(ttc_timer_format(timer, small, sizeof(small)) == TTC_ERROR_BUFFER_TOO_SMALL);
+    CHECK(ttc_timer_format(timer, buffer, sizeof(buffer)) == TTC_OK);
+    CHECK(strcmp(buffer, "05:00") == 0);
+
+    CHECK(ttc_timer_set_callback(timer, countEvents, &counts) == TTC_OK);
+    CHECK(ttc_timer_start(timer) == TTC_OK);
+    CHECK(ttc_timer_get_snapshot(timer, &snapshot) == TTC_OK);
+    CHECK(snapshot.state == TTC_STATE_RUNNING);
+    CHECK(ttc_timer_stop(timer) == TTC_OK);
+    CHECK(counts.started == 1);
+    CHECK(counts.stopped == 1);
+    CHECK(ttc_timer_get_snapshot(timer, &snapshot) == TTC_OK);
+    CHECK(snapshot.state == TTC_STATE_STOPPED);
+    ttc_timer_destroy(timer);
+}
+
+static void testBoundaries(void) {
+    int32_t periods[64];
+    int32_t offsets[64];
+    int32_t remaining[64];
+    int64_t now = 1699833600 + 12345;
+    size_t i;
+
+    CHECK(ttc_seconds_to_boundary(100, 300, 500) == 100);
+    CHECK(ttc_seconds_to_boundary(300, 300, 0) == 300);
+
+    /* Batch and single-pair calls agree, including offsets after now */
+    srand(7);
+    for (i = 0; i < 64; ++i) {
+        periods[i] = 1 + rand() % 14400;
+        offsets[i] = (i % 4 == 0) ? (int32_t)(rand() % 100000) : rand() % 3600;
+    }
+    offsets[1] = 2000000000;
+    CHECK(ttc_seconds_to_boundary_batch(periods, offsets, 64, now, remaining) == TTC_OK);
+    for (i = 0; i < 64; ++i) {
+        CHECK(remaining[i] == ttc_seconds_to_boundary(now, periods[i], offsets[i]));
+    }
+
+    periods[0] = 300;
+    offsets[0] = 500;
+    CHECK(ttc_seconds_to_boundary_batch(periods, offsets, 1, 100, remaining) == TTC_OK);
+    CHECK(remaining[0] == 100);
+
+    /* A zero or negative period anywhere is rejected instead of trapping */
+    periods[40] = 0;
+    CHECK(ttc_seconds_to_boundary_batch(periods, offsets, 64, now, remaining) == TTC_ERROR_INVALID_ARGUMENT);
+    periods[40] = -60;
+    CHECK(ttc_seconds_to_boundary_batch(periods, offsets, 64, now, remaining) == TTC_ERROR_INVALID_ARGUMENT);
+    CHECK(ttc_seconds_to_boundary_batch(NULL, offsets, 1, now, remaining) == TTC_ERROR_INVALID_ARGUMENT);
+    CHECK(ttc_seconds_to_boundary_batch(NULL, NULL, 0, now, NULL) == TTC_OK);
+}
+
+static void testSessions(void) {
+    ttc_session_status status;
+    int64_t midnight = 1699833600;
+
+    /* 14:30-21:00 UTC day session at 15:00 */
+    CHECK(ttc_session_status_at(midnight + 15 * 3600, 14 * 3600 + 1800, 21 * 3600, &status) == TTC_OK);
+    CHECK(status.in_session == 1);
+    CHECK(status.seconds_to_close == 6 * 3600);
+    CHECK(status.reserved == 0);
+
+    /* 22:00-06:00 overnight session at 02:00 and at 12:00 */
+    CHECK(ttc_session_status_at(midnight + 2 * 3600, 22 * 3600, 6 * 3600, &status) == TTC_OK);
+    CHECK(status.in_session == 1);
+    CHECK(status.seconds_to_close == 4 * 3600);
+    CHECK(ttc_session_status_at(midnight + 12 * 3600, 22 * 3600, 6 * 3600, &status) == TTC_OK);
+    CHECK(status.in_session == 0);
+    CHECK(status.seconds_to_open == 10 * 3600);
+
+    CHECK(ttc_session_status_at(midnight, 3600, 3600, &status) == TTC_ERROR_INVALID_ARGUMENT);
+    CHECK(ttc_session_status_at(midnight, -1, 3600, &status) == TTC_ERROR_INVALID_ARGUMENT);
+    CHECK(ttc_session_status_at(midnight, 0, 3600, NULL) == TTC_ERROR_INVALID_ARGUMENT);
+}
+
+int main(void) {
+    testArguments();
+    testTimer();
+    testBoundaries();
+    testSessions();
+    if (g_failures > 0) {
+        fprintf(stderr, "capiHostTest: %d check(s) failed\n", g_failures);
+        return 1;
+    }
+    printf("capiHostTest: all checks passed\n");
+    return 0;
+}
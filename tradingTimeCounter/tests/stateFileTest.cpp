@@ -0,0 +1,221 @@
+// Recovery paths of the memory-mapped state file: torn slots, foreign and
+// wrongly sized files, and a plain round trip through close and reopen.
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "tradingTimeCounter/StateFile.h"
+
+using namespace TradingTimeCounter;
+
+#define CHECK(condition) \
+    do { \
+        if (!(condition)) { \
+            std::cerr << "stateFileTest: " << __FILE__ << ":" << __LINE__ << ": check failed: " #condition << std::endl; \
+            ++g_failures; \
+        } \
+    } while (0)
+
+namespace {
+
+int g_failures = 0;
+
+// File header, then two slots of checksum, sequence and state
+const long SLOT_SIZE = 16 + static_cast<long>(sizeof(PersistedState));
+const long FILE_SIZE = 16 + 2 * SLOT_SIZE;
+const long DEADLINE_OFFSET = 16 + 16 + 16;              // deadlineNs in the first slot's state
+
+PersistedState makeState(std::int64_t deadlineNs) {
+    PersistedState state{};
+    state.timer.durationSeconds = 5 * 60;
+    state.timer.state = 1;
+    state.timer.deadlineNs = deadlineNs;
+    state.dashboardCount = 2;
+    std::snprintf(state.dashboard[0].label, sizeof(state.dashboard[0].label), "ES 5m");
+    state.dashboard[0].periodSeconds = 300;
+    std::snprintf(state.dashboard[1].label, sizeof(state.dashboard[1].label), "NQ 1h");
+    state.dashboard[1].periodSeconds = 3600;
+    state.dashboard[1].offsetSeconds = 1800;
+    return state;
+}
+
+long fileSize(const std::string& path) {
+    struct stat info {};
+    return stat(path.c_str(), &info) == 0 ? static_cast<long>(info.st_size) : -1;
+}
+
+/**
+ * @brief Overwrite bytes of a file in place, as a crash mid-write would leave them
+ */
+void corrupt(const std::string& path, long offset, int count) {
+    std::FILE* file = std::fopen(path.c_str(), "r+b");
+    if (!file) {
+        return;
+    }
+    std::fseek(file, offset, SEEK_SET);
+    for (int i = 0; i < count; ++i) {
+        std::fputc(0x5A, file);
+    }
+    std::fclose(file);
+}
+
+void writeFile(const std::string& path, long size, int fill) {
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        return;
+    }
+    for (long i = 0; i < size; ++i) {
+        std::fputc(fill, file);
+    }
+    std::fclose(file);
+}
+
+/**
+ * @brief Write two states (sequence 1 lands in the second slot, sequence 2 in the first)
+ */
+void writeTwoStates(const std::string& path) {
+    StateFile file;
+    CHECK(file.open(path));
+    CHECK(file.save(makeState(1)));
+    CHECK(file.save(makeState(2)));
+}
+
+void testRoundTrip(const std::string& path) {
+    std::remove(path.c_str());
+    PersistedState loaded{};
+    {
+        StateFile file;
+        CHECK(!file.isOpen());
+        CHECK(!file.load(loaded));
+        CHECK(!file.save(makeState(1)));
+        CHECK(file.open(path));
+        CHECK(!file.load(loaded));
+        CHECK(file.save(makeState(42)));
+    }
+    CHECK(fileSize(path) == FILE_SIZE);
+
+    StateFile reopened;
+    CHECK(reopened.open(path));
+    CHECK(reopened.load(loaded));
+    CHECK(loaded.timer.deadlineNs == 42);
+    CHECK(loaded.dashboardCount == 2);
+    CHECK(std::string(loaded.dashboard[1].label) == "NQ 1h");
+    CHECK(loaded.dashboard[1].offsetSeconds == 1800);
+
+    // Saves after a reopen continue the sequence instead of overwriting the newest slot
+    CHECK(reopened.save(makeState(43)));
+    reopened.close();
+    CHECK(reopened.open(path));
+    CHECK(reopened.load(loaded));
+    CHECK(loaded.timer.deadlineNs == 43);
+}
+
+void testTornSlots(const std::string& path) {
+    PersistedState loaded{};
+
+    // A torn newest slot falls back to the previous state
+    std::remove(path.c_str());
+    writeTwoStates(path);
+    corrupt(path, DEADLINE_OFFSET, 1);
+    {
+        StateFile file;
+        CHECK(file.open(path));
+        CHECK(file.load(loaded));
+        CHECK(loaded.timer.deadlineNs == 1);
+
+        // The next save replaces the torn slot, not the surviving one
+        CHECK(file.save(makeState(3)));
+        CHECK(file.load(loaded));
+        CHECK(loaded.timer.deadlineNs == 3);
+    }
+
+    // Both slots torn: nothing to restore, and the file is still usable
+    std::remove(path.c_str());
+    writeTwoStates(path);
+    corrupt(path, DEADLINE_OFFSET, 1);
+    corrupt(path, DEADLINE_OFFSET + SLOT_SIZE, 1);
+    StateFile file;
+    CHECK(file.open(path));
+    CHECK(!file.load(loaded));
+    CHECK(file.save(makeState(4)));
+    CHECK(file.load(loaded));
+    CHECK(loaded.timer.deadlineNs == 4);
+}
+
+void testForeignFile(const std::string& path) {
+    PersistedState loaded{};
+
+    // Right size, wrong header: started over rather than trusted
+    writeFile(path, FILE_SIZE, 0x5A);
+    {
+        StateFile file;
+        CHECK(file.open(path));
+        CHECK(!file.load(loaded));
+        CHECK(file.save(makeState(5)));
+    }
+    CHECK(fileSize(path) == FILE_SIZE);
+
+    // Right size and header, garbage slots: the checksums reject them
+    writeTwoStates(path);
+    corrupt(path, 16, static_cast<int>(FILE_SIZE - 16));
+    StateFile file;
+    CHECK(file.open(path));
+    CHECK(!file.load(loaded));
+}
+
+void testWrongSize(const std::string& path) {
+    PersistedState loaded{};
+
+    // Truncated and empty files are reinitialised to the full size
+    for (long size : {0L, 100L, FILE_SIZE - 1}) {
+        writeFile(path, size, 0);
+        StateFile file;
+        CHECK(file.open(path));
+        CHECK(!file.load(loaded));
+        CHECK(fileSize(path) == FILE_SIZE);
+        CHECK(file.save(makeState(6)));
+        CHECK(file.load(loaded));
+    }
+
+    // A valid file with trailing bytes is not a state file of this version
+    std::remove(path.c_str());
+    writeTwoStates(path);
+    std::FILE* raw = std::fopen(path.c_str(), "ab");
+    if (raw) {
+        std::fputs("trailing", raw);
+        std::fclose(raw);
+    }
+    StateFile file;
+    CHECK(file.open(path));
+    CHECK(!file.load(loaded));
+    CHECK(fileSize(path) == FILE_SIZE);
+}
+
+} // namespace
+
+int main() {
+    char pathTemplate[] = "/tmp/ttcStateTestXXXXXX";
+    int fd = mkstemp(pathTemplate);
+    if (fd < 0) {
+        std::cerr << "stateFileTest: Failed to create a temporary file" << std::endl;
+        return 1;
+    }
+    close(fd);
+    const std::string path = pathTemplate;
+
+    testRoundTrip(path);
+    testTornSlots(path);
+    testForeignFile(path);
+    testWrongSize(path);
+    std::remove(path.c_str());
+
+    if (g_failures > 0) {
+        std::cerr << "stateFileTest: " << g_failures << " check(s) failed" << std::endl;
+        return 1;
+    }
+    std::cout << "stateFileTest: all checks passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,247 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include "tradingTimeCounter/ExchangeClockSync.h"
+#include "tradingTimeCounter/TimestampMessage.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using namespace TradingTimeCounter;
+
+namespace {
+
+/**
+ * @brief Simulated exchange feed parameters
+ */
+struct FeedOptions {
+    double rateHz = 10.0;               // Messages per second
+    double durationSeconds = 600.0;     // Simulated feed length
+    double offsetMs = 250.0;            // Exchange clock ahead of local clock
+    double driftPpm = 20.0;             // Exchange clock rate error
+    double latencyUs = 50.0;            // Fixed one-way latency
+    double jitterUs = 20.0;             // Mean exponential jitter on top of latency
+    double toleranceUs = 100.0;         // Convergence tolerance
+    double alpha = 0.1;                 // Offset filter gain
+    double beta = 0.005;                // Drift filter gain
+    unsigned seed = 42;                 // Jitter RNG seed
+    int udpPort = 0;                    // Send live over UDP loopback when non-zero
+    std::string unixPath;               // Send live over a Unix socket when non-empty
+};
+
+void printUsage() {
+    std::cout << "Usage: feedSimulator [options]" << std::endl
+              << "  --rate HZ          messages per second (default 10)" << std::endl
+              << "  --duration S       simulated seconds (default 600)" << std::endl
+              << "  --offset-ms MS     exchange clock offset (default 250)" << std::endl
+              << "  --drift-ppm PPM    exchange clock drift (default 20)" << std::endl
+              << "  --latency-us US    one-way latency (default 50)" << std::endl
+              << "  --jitter-us US     mean exponential jitter (default 20)" << std::endl
+              << "  --tolerance-us US  convergence tolerance (default 100)" << std::endl
+              << "  --alpha A          offset filter gain (default 0.1)" << std::endl
+              << "  --beta B           drift filter gain (default 0.005)" << std::endl
+              << "  --seed N           jitter RNG seed (default 42)" << std::endl
+              << "  --udp PORT         send the feed live to 127.0.0.1:PORT" << std::endl
+              << "  --unix PATH        send the feed live to a Unix datagram socket" << std::endl;
+}
+
+bool parseOptions(int argc, char* argv[], FeedOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || i + 1 >= argc) {
+            return false;
+        }
+        const char* value = argv[++i];
+        if (arg == "--rate") options.rateHz = std::atof(value);
+        else if (arg == "--duration") options.durationSeconds = std::atof(value);
+        else if (arg == "--offset-ms") options.offsetMs = std::atof(value);
+        else if (arg == "--drift-ppm") options.driftPpm = std::atof(value);
+        else if (arg == "--latency-us") options.latencyUs = std::atof(value);
+        else if (arg == "--jitter-us") options.jitterUs = std::atof(value);
+        else if (arg == "--tolerance-us") options.toleranceUs = std::atof(value);
+        else if (arg == "--alpha") options.alpha = std::atof(value);
+        else if (arg == "--beta") options.beta = std::atof(value);
+        else if (arg == "--seed") options.seed = static_cast<unsigned>(std::atoi(value));
+        else if (arg == "--udp") options.udpPort = std::atoi(value);
+        else if (arg == "--unix") options.unixPath = value;
+        else return false;
+    }
+    return options.rateHz > 0.0 && options.durationSeconds > 0.0;
+}
+
+/**
+ * @brief Replay the feed through the filter offline and report convergence
+ */
+void runOffline(const FeedOptions& options) {
+    ExchangeClockSync sync;
+    sync.setFilterGains(options.alpha, options.beta);
+    sync.setLatencyCompensation(static_cast<std::int64_t>(options.latencyUs * 1000.0));
+
+    std::mt19937 rng(options.seed);
+    std::exponential_distribution<double> jitter(options.jitterUs > 0.0 ? 1.0 / options.jitterUs : 1.0);
+
+    const std::int64_t startNs = 1700000000LL * 1000000000LL;
+    const double intervalNs = 1e9 / options.rateHz;
+    const std::int64_t messages = static_cast<std::int64_t>(options.durationSeconds * options.rateHz);
+    const double toleranceNs = options.toleranceUs * 1000.0;
+
+    unsigned char buffer[TimestampWire::MESSAGE_SIZE];
+    double convergedAt = -1.0;
+    double maxErrorAfterConvergence = 0.0;
+    double lastError = 0.0;
+
+    for (std::int64_t i = 0; i < messages; ++i) {
+        double elapsedNs = static_cast<double>(i) * intervalNs;
+        std::int64_t localSendNs = startNs + static_cast<std::int64_t>(elapsedNs);
+        double trueOffsetNs = options.offsetMs * 1e6 + options.driftPpm * 1e-6 * elapsedNs;
+        double delayNs = options.latencyUs * 1000.0 + (options.jitterUs > 0.0 ? jitter(rng) * 1000.0 : 0.0);
+
+        TimestampMessageView::encode(buffer, static_cast<std::uint64_t>(i + 1),
+                                     localSendNs + static_cast<std::int64_t>(trueOffsetNs));
+        std::int64_t localReceiveNs = localSendNs + static_cast<std::int64_t>(delayNs);
+        sync.processMessage(buffer, sizeof(buffer), localReceiveNs);
+
+        // Error of the estimate at the receive instant
+        double trueOffsetAtReceive = trueOffsetNs + options.driftPpm * 1e-6 * delayNs;
+        lastError = static_cast<double>(sync.getEstimate().offsetNs) - trueOffsetAtReceive;
+        if (std::fabs(lastError) <= toleranceNs) {
+            if (convergedAt < 0.0) {
+                convergedAt = elapsedNs / 1e9;
+                maxErrorAfterConvergence = 0.0;
+            }
+            maxErrorAfterConvergence = std::max(maxErrorAfterConvergence, std::fabs(lastError));
+        } else {
+            convergedAt = -1.0;
+        }
+    }
+
+    ClockOffsetEstimate estimate = sync.getEstimate();
+    std::cout << "Offline replay: " << messages << " messages over " << options.durationSeconds << " s" << std::endl;
+    std::cout << "  Estimated offset: " << estimate.offsetNs / 1e6 << " ms" << std::endl;
+    std::cout << "  Estimated drift:  " << estimate.drift * 1e6 << " ppm (true " << options.driftPpm << ")" << std::endl;
+    std::cout << "  Final error:      " << lastError / 1000.0 << " us" << std::endl;
+    if (convergedAt >= 0.0) {
+        std::cout << "  Converged within " << options.toleranceUs << " us after " << convergedAt
+                  << " s (max error since " << maxErrorAfterConvergence / 1000.0 << " us)" << std::endl;
+    } else {
+        std::cout << "  Did not converge within " << options.toleranceUs << " us" << std::endl;
+    }
+}
+
+/**
+ * @brief Measure per-message parse and filter cost
+ */
+void runParseBenchmark() {
+    const int iterations = 10000000;
+    unsigned char buffer[TimestampWire::MESSAGE_SIZE];
+    TimestampMessageView::encode(buffer, 1, 1700000000LL * 1000000000LL);
+
+    // Parse only: validate and decode every field in place
+    std::int64_t checksum = 0;
+    auto parseStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        buffer[8] = static_cast<unsigned char>(i);
+        TimestampMessageView message(buffer, sizeof(buffer));
+        if (message.isValid()) {
+            checksum += message.exchangeTimeNs() + static_cast<std::int64_t>(message.sequence());
+        }
+    }
+    auto parseEnd = std::chrono::steady_clock::now();
+
+    // Parse plus filter update
+    ExchangeClockSync sync;
+    const int filterIterations = iterations / 10;
+    auto filterStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < filterIterations; ++i) {
+        std::int64_t t = 1700000000LL * 1000000000LL + static_cast<std::int64_t>(i) * 100000000LL;
+        TimestampMessageView::encode(buffer, static_cast<std::uint64_t>(i + 1), t);
+        sync.processMessage(buffer, sizeof(buffer), t);
+    }
+    auto filterEnd = std::chrono::steady_clock::now();
+
+    double parseNs = std::chrono::duration<double, std::nano>(parseEnd - parseStart).count() / iterations;
+    double filterNs = std::chrono::duration<double, std::nano>(filterEnd - filterStart).count() / filterIterations;
+    std::cout << "Parse cost:          " << parseNs << " ns/message (checksum " << (checksum & 0xff) << ")" << std::endl;
+    std::cout << "Parse + filter cost: " << filterNs << " ns/message" << std::endl;
+}
+
+/**
+ * @brief Send the feed in real time to a running ExchangeClockSync
+ */
+int runLive(const FeedOptions& options) {
+    int family = options.unixPath.empty() ? AF_INET : AF_UNIX;
+    int sock = socket(family, SOCK_DGRAM, 0);
+    if (sock < 0) {
+        std::cerr << "feedSimulator: Failed to create socket" << std::endl;
+        return 1;
+    }
+
+    sockaddr_in inAddr{};
+    sockaddr_un unAddr{};
+    const sockaddr* target = nullptr;
+    socklen_t targetLength = 0;
+    if (family == AF_INET) {
+        inAddr.sin_family = AF_INET;
+        inAddr.sin_port = htons(static_cast<std::uint16_t>(options.udpPort));
+        inAddr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        target = reinterpret_cast<const sockaddr*>(&inAddr);
+        targetLength = sizeof(inAddr);
+    } else {
+        unAddr.sun_family = AF_UNIX;
+        std::strncpy(unAddr.sun_path, options.unixPath.c_str(), sizeof(unAddr.sun_path) - 1);
+        target = reinterpret_cast<const sockaddr*>(&unAddr);
+        targetLength = sizeof(unAddr);
+    }
+
+    std::mt19937 rng(options.seed);
+    std::exponential_distribution<double> jitter(options.jitterUs > 0.0 ? 1.0 / options.jitterUs : 1.0);
+    auto interval = std::chrono::duration<double>(1.0 / options.rateHz);
+    auto start = std::chrono::steady_clock::now();
+    std::int64_t messages = static_cast<std::int64_t>(options.durationSeconds * options.rateHz);
+
+    unsigned char buffer[TimestampWire::MESSAGE_SIZE];
+    for (std::int64_t i = 0; i < messages; ++i) {
+        std::this_thread::sleep_until(start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(interval * static_cast<double>(i)));
+
+        double elapsedNs = static_cast<double>(i) * 1e9 / options.rateHz;
+        double delayNs = options.latencyUs * 1000.0 + (options.jitterUs > 0.0 ? jitter(rng) * 1000.0 : 0.0);
+        std::int64_t localNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+
+        // Stamp as if sent delayNs ago on the exchange clock
+        std::int64_t exchangeNs = localNs + static_cast<std::int64_t>(options.offsetMs * 1e6 + options.driftPpm * 1e-6 * elapsedNs - delayNs);
+        TimestampMessageView::encode(buffer, static_cast<std::uint64_t>(i + 1), exchangeNs);
+        sendto(sock, buffer, sizeof(buffer), 0, target, targetLength);
+    }
+
+    close(sock);
+    std::cout << "Sent " << messages << " messages" << std::endl;
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    FeedOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage();
+        return 1;
+    }
+
+    if (options.udpPort != 0 || !options.unixPath.empty()) {
+        return runLive(options);
+    }
+
+    runOffline(options);
+    runParseBenchmark();
+    return 0;
+}
@@ -0,0 +1,128 @@
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "tradingTimeCounter/ReplayEngine.h"
+#include "tradingTimeCounter/TickFile.h"
+
+using namespace TradingTimeCounter;
+
+namespace {
+
+/**
+ * @brief Subscriber that counts replayed timer events
+ */
+class CountingSubscriber : public ITimerCallback {
+public:
+    void onTimerUpdate(int remainingSeconds) override { ++updates; lastRemaining = remainingSeconds; }
+    void onTimerCompleted() override { ++completions; }
+    void onTimerStarted() override {}
+    void onTimerStopped() override {}
+    void onTimerAlert(int stage) override { alerts += stage >= 0 ? 1 : 0; }
+
+    std::uint64_t updates = 0;
+    std::uint64_t completions = 0;
+    std::uint64_t alerts = 0;
+    int lastRemaining = 0;
+};
+
+void printUsage() {
+    std::cout << "Usage: replayRunner FILE [--speed X] [--bar MINUTES]... [--alert SECONDS]... [--precision P]" << std::endl
+              << "       replayRunner --generate COUNT FILE" << std::endl
+              << "  --speed X        multiple of real time, 0 = as fast as possible (default 0)" << std::endl
+              << "  --bar MINUTES    add a bar-aligned countdown (default: 1 and 5)" << std::endl
+              << "  --alert SECONDS  add an alert stage this long before each bar close" << std::endl
+              << "  --precision P    display precision: seconds (default) or adaptive" << std::endl
+              << "  --generate       write COUNT synthetic ticks (mean spacing 5 ms) to FILE" << std::endl;
+}
+
+int generate(std::size_t count, const std::string& path) {
+    std::mt19937_64 rng(7);
+    std::exponential_distribution<double> spacingMs(1.0 / 5.0);
+
+    // Start at 2023-11-14 14:30:00 UTC, a typical US cash open
+    std::int64_t timestampNs = 1699972200LL * 1000000000LL;
+    std::vector<TickRecord> records(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        timestampNs += static_cast<std::int64_t>(spacingMs(rng) * 1e6);
+        records[i] = TickRecord{timestampNs, 1, static_cast<std::uint32_t>(i)};
+    }
+
+    if (!TickFile::write(path, records.data(), records.size())) {
+        return 1;
+    }
+    std::cout << "Wrote " << count << " ticks spanning "
+              << (records.back().timestampNs - records.front().timestampNs) / 1e9 << " s to " << path << std::endl;
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc >= 4 && std::string(argv[1]) == "--generate") {
+        return generate(static_cast<std::size_t>(std::atoll(argv[2])), argv[3]);
+    }
+    if (argc < 2 || std::string(argv[1]).rfind("--", 0) == 0) {
+        printUsage();
+        return 1;
+    }
+
+    ReplayEngine engine;
+    std::vector<int> bars;
+    AlertPlan alerts;
+    DisplayPrecisionPolicy policy = DisplayPrecisionPolicy::fixedSeconds();
+    for (int i = 2; i + 1 < argc; i += 2) {
+        std::string arg = argv[i];
+        if (arg == "--speed") {
+            engine.setSpeed(std::atof(argv[i + 1]));
+        } else if (arg == "--bar") {
+            bars.push_back(std::atoi(argv[i + 1]));
+        } else if (arg == "--alert") {
+            std::size_t style = alerts.getStages().size() + 1;
+            alerts.addStage(AlertStage{static_cast<std::uint32_t>(std::atoi(argv[i + 1])) * 1000, style, AlertAction::None});
+        } else if (arg == "--precision" && std::string(argv[i + 1]) == "adaptive") {
+            policy = DisplayPrecisionPolicy::adaptive();
+        } else if (arg == "--precision" && std::string(argv[i + 1]) == "seconds") {
+            policy = DisplayPrecisionPolicy::fixedSeconds();
+        } else {
+            printUsage();
+            return 1;
+        }
+    }
+    if (bars.empty()) {
+        bars = {1, 5};
+    }
+
+    std::vector<std::shared_ptr<CountingSubscriber>> subscribers;
+    for (int bar : bars) {
+        subscribers.push_back(std::make_shared<CountingSubscriber>());
+        engine.addCountdown(bar, subscribers.back(), alerts, policy);
+    }
+
+    TickFile file;
+    if (!file.open(argv[1])) {
+        return 1;
+    }
+
+    std::uint64_t checksum = 0;
+    engine.setRecordCallback([&checksum](const TickRecord& record) { checksum += record.value; });
+
+    ReplayStats stats = engine.run(file);
+    double virtualSeconds = (stats.virtualEndNs - stats.virtualStartNs) / 1e9;
+
+    std::cout << "Replayed " << stats.recordsProcessed << " ticks covering " << virtualSeconds
+              << " s in " << stats.wallSeconds << " s" << std::endl;
+    std::cout << "  Throughput:   " << stats.recordsProcessed / stats.wallSeconds / 1e6 << " M ticks/s" << std::endl;
+    std::cout << "  Timer events: " << stats.timerEvents << " (checksum " << checksum << ")" << std::endl;
+    if (stats.outOfOrderRecords > 0) {
+        std::cout << "  Out of order: " << stats.outOfOrderRecords << " ticks replayed at the preceding tick's time"
+                  << std::endl;
+    }
+    for (std::size_t i = 0; i < bars.size(); ++i) {
+        std::cout << "  " << bars[i] << "m countdown: " << subscribers[i]->completions << " bar closes, "
+                  << subscribers[i]->updates << " updates, " << subscribers[i]->alerts << " alerts" << std::endl;
+    }
+    return 0;
+}
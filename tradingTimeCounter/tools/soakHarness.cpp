@@ -0,0 +1,896 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "tradingTimeCounter/BasicCountdownTimer.h"
+#include "tradingTimeCounter/ClockWatcher.h"
+#include "tradingTimeCounter/CoalescingDisplayManager.h"
+#include "tradingTimeCounter/CountdownTimer.h"
+#include "tradingTimeCounter/DeadlineScheduler.h"
+#include "tradingTimeCounter/InlineExecutor.h"
+#include "tradingTimeCounter/ShardedTimerScheduler.h"
+#include "tradingTimeCounter/StateFile.h"
+#include "tradingTimeCounter/VirtualClock.h"
+#include "tradingTimeCounter/WorkStealingExecutor.h"
+
+using namespace TradingTimeCounter;
+
+namespace {
+
+const std::int64_t NS_PER_SECOND = 1000000000;
+const std::int64_t FIRST_DAY_NS = 1699833600LL * NS_PER_SECOND;      // Monday 2023-11-13 00:00 UTC
+const std::int64_t SESSION_OPEN_NS = 8LL * 3600 * NS_PER_SECOND;     // 08:00 pre-open
+const std::int64_t SESSION_CLOSE_NS = 16LL * 3600 * NS_PER_SECOND + 30LL * 60 * NS_PER_SECOND; // 16:30
+const std::int64_t BAR_PERIODS_S[] = {60, 300, 900, 3600};
+const std::size_t MAX_REPORTED_VIOLATIONS = 20;
+const int LIVE_ROUND_MS = 25;                                        // Real time between live churn rounds
+const std::size_t LIVE_OPERATIONS_PER_ROUND = 2;                     // Live timers churned per round
+const std::int64_t LIVE_LEAD_MS = 100;                               // Live reference clock sits this far before a bar close
+
+/**
+ * @brief Harness parameters
+ */
+struct SoakOptions {
+    int days = 10;                      // Simulated trading days
+    std::uint64_t timers = 20000;       // Bar-aligned keyed timers on the sharded scheduler
+    std::size_t countdowns = 500;       // Independent countdowns with start/stop/reset/config churn
+    std::size_t subscribers = 500;      // One-shot bar-close subscribers on the deadline scheduler
+    std::int64_t stepMs = 1000;         // Virtual clock step
+    std::uint64_t seed = 1;             // Churn RNG seed
+    std::int64_t rssToleranceKiB = 2048; // Allowed RSS growth after the first day
+    std::size_t liveTimers = 8;         // Threaded CountdownTimers churned in real time each day
+    int liveRounds = 40;                // Churn rounds per day, LIVE_ROUND_MS apart
+    std::int64_t liveLateMs = 250;      // Allowed real-time lateness of a live completion
+    std::string reportPath = "soakReport.txt";
+};
+
+void printUsage() {
+    std::cout << "Usage: soakHarness [options]" << std::endl
+              << "  --days N           simulated trading days, 08:00-16:30 (default 10)" << std::endl
+              << "  --timers N         bar-aligned keyed timers (default 20000)" << std::endl
+              << "  --countdowns N     churned countdowns (default 500)" << std::endl
+              << "  --subscribers N    bar-close subscribers (default 500)" << std::endl
+              << "  --step-ms MS       virtual clock step (default 1000)" << std::endl
+              << "  --seed N           churn RNG seed (default 1)" << std::endl
+              << "  --rss-kib KIB      allowed RSS growth after day 1 (default 2048)" << std::endl
+              << "  --live-timers N    threaded CountdownTimers churned each day (default 8)" << std::endl
+              << "  --live-rounds N    live churn rounds per day, 25 ms apart (default 40)" << std::endl
+              << "  --live-late-ms MS  allowed lateness of a live completion (default 250)" << std::endl
+              << "  --report FILE      summary report path (default soakReport.txt)" << std::endl;
+}
+
+bool parseOptions(int argc, char* argv[], SoakOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || i + 1 >= argc) {
+            return false;
+        }
+        const char* value = argv[++i];
+        if (arg == "--days") options.days = std::atoi(value);
+        else if (arg == "--timers") options.timers = std::strtoull(value, nullptr, 10);
+        else if (arg == "--countdowns") options.countdowns = static_cast<std::size_t>(std::atoll(value));
+        else if (arg == "--subscribers") options.subscribers = static_cast<std::size_t>(std::atoll(value));
+        else if (arg == "--step-ms") options.stepMs = std::atoll(value);
+        else if (arg == "--seed") options.seed = std::strtoull(value, nullptr, 10);
+        else if (arg == "--rss-kib") options.rssToleranceKiB = std::atoll(value);
+        else if (arg == "--live-timers") options.liveTimers = static_cast<std::size_t>(std::atoll(value));
+        else if (arg == "--live-rounds") options.liveRounds = std::atoi(value);
+        else if (arg == "--live-late-ms") options.liveLateMs = std::atoll(value);
+        else if (arg == "--report") options.reportPath = value;
+        else return false;
+    }
+    return options.days > 0 && options.stepMs > 0 && options.stepMs <= 60000;
+}
+
+/**
+ * @brief Read a "Name: value" line of /proc/self/status (Linux), -1 elsewhere
+ */
+long readProcStatus(const char* name) {
+    long value = -1;
+#ifdef __linux__
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    std::string prefix = std::string(name) + ":";
+    while (std::getline(status, line)) {
+        if (line.compare(0, prefix.size(), prefix) == 0) {
+            value = std::atol(line.c_str() + prefix.size());
+            break;
+        }
+    }
+#else
+    (void)name;
+#endif
+    return value;
+}
+
+/**
+ * @brief Violation counter that keeps the first few messages
+ */
+struct Invariants {
+    std::uint64_t checks = 0;
+    std::uint64_t violations = 0;
+    std::vector<std::string> messages;
+
+    void check(bool condition, const std::string& what) {
+        ++checks;
+        if (!condition) {
+            ++violations;
+            if (messages.size() < MAX_REPORTED_VIOLATIONS) {
+                messages.push_back(what);
+            }
+        }
+    }
+};
+
+/**
+ * @brief Per-day results
+ */
+struct DayResult {
+    std::uint64_t barExpiries = 0;
+    std::uint64_t countdownUpdates = 0;
+    std::uint64_t countdownCompletions = 0;
+    std::uint64_t subscriberWakeups = 0;
+    std::uint64_t churnOperations = 0;
+    std::int64_t maxLatenessNs = 0;
+    std::uint64_t liveOperations = 0;
+    std::uint64_t liveEvents = 0;
+    std::uint64_t liveCompletions = 0;
+    std::int64_t liveMaxLatenessNs = 0;
+    long rssKiB = -1;
+    long threads = -1;
+    std::uint64_t violations = 0;
+};
+
+// ---------------------------------------------------------------------------
+// Bar timers: keyed periodic timers on the sharded scheduler
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Expected state of one keyed bar timer
+ */
+struct BarTimer {
+    std::int64_t periodNs = 0;
+    std::int64_t expectedNs = 0;        // Next boundary it must fire for
+    bool active = false;
+};
+
+std::int64_t nextBoundary(std::int64_t nowNs, std::int64_t periodNs) {
+    return (nowNs / periodNs + 1) * periodNs;
+}
+
+// ---------------------------------------------------------------------------
+// Countdowns: BasicCountdownTimer on the shared virtual clock
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief What the harness expects of one countdown
+ */
+struct CountdownProbe {
+    DisplayPrecisionPolicy policy;
+    std::uint32_t durationMs = 0;
+    bool repeating = false;
+    std::uint32_t lastRemainingMs = 0;
+    bool hasLast = false;               // lastRemainingMs is from the current run
+    std::int64_t expectedCompletionNs = 0;
+};
+
+/**
+ * @brief Sink that checks every update and completion against its probe
+ */
+struct CheckingSink {
+    CountdownProbe* probe = nullptr;
+    const VirtualClock* clock = nullptr;
+    Invariants* invariants = nullptr;
+    DayResult* day = nullptr;
+    std::int64_t stepNs = 0;
+
+    void onUpdate(const CountdownText& text, std::uint32_t remainingMs) {
+        ++day->countdownUpdates;
+        invariants->check(remainingMs <= probe->durationMs, "countdown remaining exceeds its duration");
+        invariants->check(text.toString() == probe->policy.format(remainingMs), "countdown text does not match its policy");
+        if (probe->hasLast) {
+            // The text must change within one step of when it was due to
+            std::uint32_t dueMs = probe->policy.nextChangeMs(probe->lastRemainingMs);
+            invariants->check(remainingMs <= dueMs, "countdown update before its text changed");
+            invariants->check(static_cast<std::int64_t>(dueMs - remainingMs) * 1000000 < stepNs, "countdown update late");
+        }
+        probe->lastRemainingMs = remainingMs;
+        probe->hasLast = true;
+    }
+
+    void onCompleted() {
+        ++day->countdownCompletions;
+        std::int64_t latenessNs = clock->nowNs() - probe->expectedCompletionNs;
+        invariants->check(latenessNs >= 0 && latenessNs < stepNs, "countdown completion off schedule");
+        day->maxLatenessNs = std::max(day->maxLatenessNs, latenessNs);
+        probe->expectedCompletionNs += static_cast<std::int64_t>(probe->durationMs) * 1000000;
+        probe->hasLast = false;
+    }
+};
+
+using SoakCountdown = BasicCountdownTimer<VirtualTimeSource, PolicyResolution, RuntimeRepeat, CheckingSink>;
+
+// ---------------------------------------------------------------------------
+// Live timers: the threaded CountdownTimer the application runs
+// ---------------------------------------------------------------------------
+
+std::int64_t steadyNowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Display backend that only counts what reaches it
+ */
+class NullDisplay : public IDisplayManager {
+public:
+    bool initialize(const DisplayConfig&) override { return true; }
+    void show() override { m_visible = true; }
+    void hide() override { m_visible = false; }
+    void updateText(const std::string&) override { ++texts; }
+    void updateConfig(const DisplayConfig&) override {}
+    void setPositionLocked(bool) override {}
+    void getPosition(int& x, int& y) const override { x = 0; y = 0; }
+    void setPosition(int, int) override {}
+    bool isVisible() const override { return m_visible; }
+    void destroy() override {}
+    void setCloseCallback(std::function<void()>) override {}
+    void setPositionChangeCallback(std::function<void(int, int)>) override {}
+
+    std::atomic<std::uint64_t> texts{0};
+
+private:
+    bool m_visible = false;
+};
+
+/**
+ * @brief Callback of one live timer that checks the order and timing of its events
+ *
+ * Events of one timer arrive one at a time, in order, through the
+ * executor's ordered lane, so the state below needs no lock; the harness
+ * reads the counters only after the executor has drained. Before each
+ * start() or resync() that arms the timer the harness queues when that arm
+ * must complete; the matching Started or Resync event takes it off the
+ * queue, so a completion is judged against its own arm even when it is
+ * delivered after the next one was requested.
+ */
+class LiveProbe : public ITimerCallback {
+public:
+    LiveProbe(bool aligned, IDisplayManager* display, std::int64_t lateLimitNs)
+        : m_aligned(aligned)
+        , m_display(display)
+        , m_lateLimitNs(lateLimitNs) {
+    }
+
+    void onTimerUpdate(int remainingSeconds) override {
+        expectRunning();
+        m_display->updateText(std::to_string(remainingSeconds));
+        ++events;
+    }
+
+    /**
+     * @brief Queue the completion time of an arm about to be requested
+     * @param inMs Time from now to the completion
+     */
+    void expectArm(std::int64_t inMs) {
+        std::lock_guard<std::mutex> lock(m_armMutex);
+        m_arms.push_back(steadyNowNs() + inMs * 1000000);
+    }
+
+    void onTimerBoundary(std::int64_t boundaryNs) override {
+        expectRunning();
+        if (m_aligned && boundaryNs % (60 * NS_PER_SECOND) != 0) {
+            ++offSchedule;                               // Not the 1-minute bar close the timer targeted
+        }
+        m_boundaryPending = true;
+    }
+
+    void onTimerCompleted() override {
+        expectRunning();
+        if (!m_boundaryPending) {
+            ++outOfOrder;
+        }
+        m_boundaryPending = false;
+        std::int64_t nowNs = steadyNowNs();
+        std::int64_t latenessNs = nowNs - m_expectedCompletionNs;
+        if (!isOnSchedule(latenessNs)) {
+            // A resync racing the thread's own completion is delivered first; the completion is the earlier arm's
+            latenessNs = nowNs - m_previousCompletionNs;
+            if (!isOnSchedule(latenessNs)) {
+                ++offSchedule;
+            }
+        }
+        maxLatenessNs = std::max(maxLatenessNs, latenessNs);
+        m_previousCompletionNs = m_expectedCompletionNs;
+        m_expectedCompletionNs += 60 * NS_PER_SECOND;    // Aligned timers re-arm for the next 1-minute bar
+        m_running = m_aligned;
+        ++completions;
+        ++events;
+    }
+
+    void onTimerStarted() override {
+        if (m_running) {
+            ++outOfOrder;
+        }
+        m_running = true;
+        takeArm();
+        ++events;
+    }
+
+    void onTimerStopped() override {
+        expectRunning();
+        m_running = false;
+        ++events;
+    }
+
+    void onTimerResync(int) override {
+        expectRunning();
+        takeArm();
+        ++events;
+    }
+
+    void onTimerAlert(int) override {
+        expectRunning();
+        ++events;
+    }
+
+    std::uint64_t events = 0;
+    std::uint64_t completions = 0;
+    std::uint64_t outOfOrder = 0;                        // Events impossible in the delivered state
+    std::uint64_t offSchedule = 0;                       // Completions early or later than the limit
+    std::int64_t maxLatenessNs = 0;
+
+private:
+    void expectRunning() {
+        if (!m_running) {
+            ++outOfOrder;
+        }
+    }
+
+    void takeArm() {
+        std::lock_guard<std::mutex> lock(m_armMutex);
+        if (m_arms.empty()) {
+            ++outOfOrder;
+            return;
+        }
+        m_previousCompletionNs = m_expectedCompletionNs;
+        m_expectedCompletionNs = m_arms.front();
+        m_arms.pop_front();
+    }
+
+    bool isOnSchedule(std::int64_t latenessNs) const {
+        // Remaining time is rounded up to the millisecond
+        return latenessNs >= -1000000 && latenessNs <= m_lateLimitNs;
+    }
+
+    bool m_aligned;
+    IDisplayManager* m_display;
+    std::int64_t m_lateLimitNs;
+    bool m_running = false;                              // Running as seen through the delivered events
+    bool m_boundaryPending = false;                      // onTimerBoundary seen, its completion not yet
+    std::int64_t m_expectedCompletionNs = 0;             // Steady time the current arm must reach zero
+    std::int64_t m_previousCompletionNs = 0;             // Same for the arm before it
+    std::mutex m_armMutex;
+    std::deque<std::int64_t> m_arms;                     // Requested arms not yet seen as events
+};
+
+/**
+ * @brief The whole simulated deployment
+ */
+class SoakHarness {
+public:
+    explicit SoakHarness(const SoakOptions& options)
+        : m_options(options)
+        , m_stepNs(options.stepMs * 1000000)
+        , m_rng(options.seed)
+        , m_clock(std::make_shared<VirtualClock>(FIRST_DAY_NS))
+        , m_liveClock(std::make_shared<VirtualClock>(FIRST_DAY_NS + 60 * NS_PER_SECOND - LIVE_LEAD_MS * 1000000))
+        , m_bars(options.timers)
+        , m_barScheduler([this](std::uint64_t key, std::int64_t deadlineNs) { onBarExpired(key, deadlineNs); }, 4)
+        , m_deadlines(m_clock)
+        , m_probes(options.countdowns)
+        , m_day(nullptr) {
+    }
+
+    /**
+     * @brief Run one trading session
+     * @param index Day number from 0
+     * @param day Receives the day's results
+     */
+    void runDay(int index, DayResult& day) {
+        m_day = &day;
+        std::int64_t openNs = FIRST_DAY_NS + index * 24LL * 3600 * NS_PER_SECOND + SESSION_OPEN_NS;
+        std::int64_t closeNs = openNs - SESSION_OPEN_NS + SESSION_CLOSE_NS;
+        m_clock->advanceTo(openNs);
+        openSession();
+
+        for (std::int64_t nowNs = openNs + m_stepNs; nowNs <= closeNs; nowNs += m_stepNs) {
+            m_clock->advanceTo(nowNs);
+            churn();
+            m_barScheduler.runDue(nowNs);
+            m_deadlines.runDue(nowNs);
+            for (SoakCountdown& countdown : m_countdowns) {
+                countdown.tick();
+            }
+        }
+
+        closeSession();
+        runLiveTimers();
+        exerciseThreads();
+        day.violations = m_invariants.violations;
+        m_day = nullptr;
+    }
+
+    const Invariants& getInvariants() const { return m_invariants; }
+
+    Invariants& getInvariants() { return m_invariants; }
+
+private:
+    // -- Session lifecycle ---------------------------------------------------
+
+    void openSession() {
+        std::int64_t nowNs = m_clock->nowNs();
+        for (std::uint64_t key = 0; key < m_bars.size(); ++key) {
+            armBar(key, BAR_PERIODS_S[key % 4] * NS_PER_SECOND, nowNs);
+        }
+
+        m_countdowns.clear();
+        m_countdowns.reserve(m_probes.size());
+        for (std::size_t i = 0; i < m_probes.size(); ++i) {
+            m_countdowns.push_back(makeCountdown(i));
+            startCountdown(i);
+        }
+
+        m_activeSubscribers = 0;
+        m_closing = false;
+        for (std::size_t i = 0; i < m_options.subscribers; ++i) {
+            subscribe(nowNs);
+        }
+    }
+
+    void closeSession() {
+        std::int64_t nowNs = m_clock->nowNs();
+
+        // No bar boundary up to the close may be missing
+        for (std::uint64_t key = 0; key < m_bars.size(); ++key) {
+            const BarTimer& bar = m_bars[key];
+            if (bar.active) {
+                m_invariants.check(bar.expectedNs == nextBoundary(nowNs, bar.periodNs), "bar timer missed a boundary");
+            }
+            m_barScheduler.cancel(key);
+            m_bars[key].active = false;
+        }
+        m_barScheduler.runDue(nowNs);
+        std::uint64_t leftover = 0;
+        for (std::size_t shard = 0; shard < m_barScheduler.getShardCount(); ++shard) {
+            leftover += m_barScheduler.getStats(shard).timers;
+        }
+        m_invariants.check(leftover == 0, "timers left in the scheduler after close");
+
+        // Subscribers still waiting are released without lateness checks
+        m_closing = true;
+        m_deadlines.runDue(TimerTable::NEVER - 1);
+        m_invariants.check(m_deadlines.getPendingCount() == 0, "deadline scheduler kept wakeups after close");
+        m_invariants.check(m_scheduledWakeups == m_ranWakeups, "a subscriber wakeup was lost");
+
+        for (SoakCountdown& countdown : m_countdowns) {
+            countdown.stop();
+        }
+    }
+
+    /**
+     * @brief Churn real CountdownTimers the way App runs them, in real time
+     *
+     * Each timer has its own thread, dispatches through a shared
+     * WorkStealingExecutor into a CoalescingDisplayManager, is watched by a
+     * ClockWatcher and is persisted to a StateFile every round. Aligned
+     * timers read a VirtualClock parked LIVE_LEAD_MS before a bar close,
+     * so every start, reset and resync completes within the phase.
+     */
+    void runLiveTimers() {
+        if (m_options.liveTimers == 0) {
+            return;
+        }
+        std::int64_t lateLimitNs = m_options.liveLateMs * 1000000;
+        auto display = std::unique_ptr<CoalescingDisplayManager>(
+            new CoalescingDisplayManager(std::unique_ptr<IDisplayManager>(new NullDisplay()), std::chrono::milliseconds(1)));
+        display->initialize(DisplayConfig());
+        display->show();
+        auto executor = std::make_shared<WorkStealingExecutor>(2);
+        ClockWatcher watcher;
+        StateFile stateFile;
+        std::string statePath = m_options.reportPath + ".state";
+        m_invariants.check(stateFile.open(statePath), "state file could not be opened");
+
+        AlertPlan alerts;
+        alerts.addStage(AlertStage{60000, 1, AlertAction::None});
+        alerts.addStage(AlertStage{100, 2, AlertAction::Flash});
+
+        std::vector<std::shared_ptr<LiveProbe>> probes;
+        std::vector<std::unique_ptr<CountdownTimer>> timers;
+        for (std::size_t i = 0; i < m_options.liveTimers; ++i) {
+            bool aligned = i % 2 == 0;
+            probes.push_back(std::make_shared<LiveProbe>(aligned, display.get(), lateLimitNs));
+            timers.emplace_back(new CountdownTimer(1));
+            CountdownTimer& timer = *timers.back();
+            timer.setReferenceClock(m_liveClock);
+            timer.setCallbackExecutor(executor);
+            timer.setPrecisionPolicy(DisplayPrecisionPolicy::adaptive());
+            timer.setAlertPlan(alerts);
+            timer.setWallClockAligned(aligned);
+            timer.setCallback(probes.back());
+            watcher.addTimer(&timer);
+        }
+        watcher.start();
+
+        for (int round = 0; round < m_options.liveRounds; ++round) {
+            // A few timers per round, so most armed countdowns get to complete
+            for (std::size_t n = 0; n < LIVE_OPERATIONS_PER_ROUND; ++n) {
+                std::size_t i = m_rng() % timers.size();
+                churnLiveTimer(*timers[i], *probes[i]);
+                ++m_day->liveOperations;
+            }
+            if (round == m_options.liveRounds / 2) {
+                // As after a wall-clock step: every running aligned timer re-arms
+                for (std::size_t i = 0; i < timers.size(); ++i) {
+                    if (timers[i]->isRunning() && timers[i]->isWallClockAligned()) {
+                        probes[i]->expectArm(LIVE_LEAD_MS);
+                    }
+                }
+                watcher.resyncAll(ClockDiscontinuity::WallClockSet);
+            }
+            persistLiveTimer(stateFile, *timers[round % timers.size()]);
+            std::this_thread::sleep_for(std::chrono::milliseconds(LIVE_ROUND_MS));
+        }
+
+        // Tear down in dependency order: timers post to the executor, which posts to the display
+        watcher.stop();
+        for (std::unique_ptr<CountdownTimer>& timer : timers) {
+            watcher.removeTimer(timer.get());
+            timer->stop();
+        }
+        timers.clear();
+        executor.reset();
+        DisplayUpdateStats displayStats = display->getStats();
+        display.reset();
+        stateFile.close();
+        std::remove(statePath.c_str());
+
+        std::uint64_t completions = 0;
+        for (const std::shared_ptr<LiveProbe>& probe : probes) {
+            m_invariants.check(probe->outOfOrder == 0, "live timer event out of order");
+            m_invariants.check(probe->offSchedule == 0, "live timer completion off schedule");
+            m_day->liveEvents += probe->events;
+            completions += probe->completions;
+            m_day->liveMaxLatenessNs = std::max(m_day->liveMaxLatenessNs, probe->maxLatenessNs);
+        }
+        m_day->liveCompletions += completions;
+        m_invariants.check(completions > 0, "no live timer completed");
+        m_invariants.check(displayStats.textUpdates > 0, "no live update reached the display");
+    }
+
+    /**
+     * @brief Apply one random operation to a live timer
+     *
+     * Only the timer thread of a free-running countdown changes its state
+     * on its own (to Completed), so operations on those stop first where
+     * whether they arm would otherwise depend on that race.
+     */
+    void churnLiveTimer(CountdownTimer& timer, LiveProbe& probe) {
+        bool aligned = timer.isWallClockAligned();
+        switch (m_rng() % 5) {
+        case 0:
+            if (!timer.isRunning()) {
+                probe.expectArm(aligned ? LIVE_LEAD_MS : timer.getSnapshot().remainingMs);
+            }
+            timer.start();
+            break;
+        case 1:
+            timer.stop();
+            break;
+        case 2:
+            if (aligned) {
+                // reset() restarts a running timer
+                if (timer.isRunning()) {
+                    probe.expectArm(LIVE_LEAD_MS);
+                }
+                timer.reset();
+            } else {
+                timer.stop();
+                timer.reset();
+                probe.expectArm(60000);
+                timer.start();
+            }
+            break;
+        case 3:
+            if (aligned && timer.isRunning()) {
+                probe.expectArm(LIVE_LEAD_MS);
+            }
+            timer.resync();
+            break;
+        default: {
+            // A short countdown, so free-running timers complete within the phase
+            std::uint32_t remainingMs = static_cast<std::uint32_t>(20 + m_rng() % 100);
+            timer.stop();
+            timer.restoreRemaining(remainingMs);
+            probe.expectArm(aligned ? LIVE_LEAD_MS : remainingMs);
+            timer.start();
+            break;
+        }
+        }
+    }
+
+    /**
+     * @brief Save a live timer's state and check it reads back unchanged
+     */
+    void persistLiveTimer(StateFile& stateFile, const CountdownTimer& timer) {
+        PersistedState saved = {};
+        CountdownSnapshot snapshot = timer.getSnapshot();
+        saved.timer.durationSeconds = 60;
+        saved.timer.state = static_cast<std::uint8_t>(snapshot.state);
+        saved.timer.wallClockAligned = timer.isWallClockAligned() ? 1 : 0;
+        saved.timer.remainingMs = snapshot.remainingMs;
+        saved.timer.deadlineNs = timer.getDeadlineNs();
+        PersistedState loaded = {};
+        m_invariants.check(stateFile.save(saved) && stateFile.load(loaded)
+                           && loaded.timer.remainingMs == saved.timer.remainingMs
+                           && loaded.timer.deadlineNs == saved.timer.deadlineNs
+                           && loaded.timer.state == saved.timer.state, "state file round trip changed the timer");
+    }
+
+    /**
+     * @brief Start and stop threaded components so a leaked thread would show up
+     */
+    void exerciseThreads() {
+        {
+            ShardedTimerScheduler threaded([](std::uint64_t, std::int64_t) {}, 2);
+            threaded.start();
+            threaded.add(1, 0);
+            threaded.add(2, 0, NS_PER_SECOND);
+            threaded.cancel(2);
+            threaded.stop();
+        }
+        {
+            WorkStealingExecutor executor(2);
+            for (int i = 0; i < 100; ++i) {
+                executor.post([]() {});
+            }
+        }
+    }
+
+    // -- Bar timers ----------------------------------------------------------
+
+    void armBar(std::uint64_t key, std::int64_t periodNs, std::int64_t nowNs) {
+        BarTimer& bar = m_bars[key];
+        bar.periodNs = periodNs;
+        bar.expectedNs = nextBoundary(nowNs, periodNs);
+        bar.active = true;
+        m_barScheduler.add(key, bar.expectedNs, periodNs);
+    }
+
+    void onBarExpired(std::uint64_t key, std::int64_t deadlineNs) {
+        BarTimer& bar = m_bars[key];
+        std::int64_t latenessNs = m_clock->nowNs() - deadlineNs;
+        m_invariants.check(bar.active, "bar timer fired after it was cancelled");
+        m_invariants.check(deadlineNs == bar.expectedNs, "bar timer skipped or repeated a boundary");
+        m_invariants.check(latenessNs >= 0 && latenessNs < m_stepNs, "bar timer late");
+        m_day->maxLatenessNs = std::max(m_day->maxLatenessNs, latenessNs);
+        bar.expectedNs = deadlineNs + bar.periodNs;
+        ++m_day->barExpiries;
+    }
+
+    // -- Countdowns ----------------------------------------------------------
+
+    SoakCountdown makeCountdown(std::size_t index) {
+        CountdownProbe& probe = m_probes[index];
+        probe.policy = m_rng() % 2 == 0 ? DisplayPrecisionPolicy::fixedSeconds() : DisplayPrecisionPolicy::adaptive();
+        probe.durationMs = static_cast<std::uint32_t>(10000 + m_rng() % (15 * 60000));
+        probe.repeating = m_rng() % 2 == 0;
+        probe.hasLast = false;
+
+        CheckingSink sink;
+        sink.probe = &probe;
+        sink.clock = m_clock.get();
+        sink.invariants = &m_invariants;
+        sink.day = m_day;
+        sink.stepNs = m_stepNs;
+        return SoakCountdown(probe.durationMs, sink, VirtualTimeSource{m_clock.get()},
+                             PolicyResolution{probe.policy}, RuntimeRepeat{probe.repeating});
+    }
+
+    void startCountdown(std::size_t index) {
+        SoakCountdown& countdown = m_countdowns[index];
+        if (countdown.isRunning()) {
+            return;
+        }
+        CountdownProbe& probe = m_probes[index];
+        probe.expectedCompletionNs = m_clock->nowNs() + static_cast<std::int64_t>(countdown.getRemainingMs()) * 1000000;
+        probe.hasLast = false;
+        countdown.getSink().day = m_day;
+        countdown.start();
+    }
+
+    // -- Subscribers ---------------------------------------------------------
+
+    void subscribe(std::int64_t nowNs) {
+        std::int64_t deadlineNs = nextBoundary(nowNs, 300 * NS_PER_SECOND);
+        ++m_activeSubscribers;
+        ++m_scheduledWakeups;
+        m_deadlines.schedule(deadlineNs, m_executor, [this, deadlineNs]() { onSubscriberWakeup(deadlineNs); });
+    }
+
+    void onSubscriberWakeup(std::int64_t deadlineNs) {
+        ++m_ranWakeups;
+        --m_activeSubscribers;
+        if (m_closing) {
+            return;
+        }
+        std::int64_t nowNs = m_clock->nowNs();
+        std::int64_t latenessNs = nowNs - deadlineNs;
+        m_invariants.check(latenessNs >= 0 && latenessNs < m_stepNs, "subscriber wakeup late");
+        m_day->maxLatenessNs = std::max(m_day->maxLatenessNs, latenessNs);
+        ++m_day->subscriberWakeups;
+
+        // Most subscribers stay for the next bar; the rest leave
+        if (m_rng() % 10 != 0) {
+            subscribe(nowNs);
+        }
+    }
+
+    // -- Churn ---------------------------------------------------------------
+
+    void churn() {
+        std::int64_t nowNs = m_clock->nowNs();
+
+        // Bar timers: cancel, re-add with another period (config change), or restore
+        for (std::uint64_t i = 0, count = std::max<std::uint64_t>(1, m_bars.size() / 1000); i < count && !m_bars.empty(); ++i) {
+            std::uint64_t key = m_rng() % m_bars.size();
+            if (m_bars[key].active && m_rng() % 2 == 0) {
+                m_barScheduler.cancel(key);
+                m_bars[key].active = false;
+            } else {
+                armBar(key, BAR_PERIODS_S[m_rng() % 4] * NS_PER_SECOND, nowNs);
+            }
+            ++m_day->churnOperations;
+        }
+
+        // Countdowns: start, stop, reset or reconfigure
+        for (std::size_t i = 0, count = std::max<std::size_t>(1, m_countdowns.size() / 200); i < count && !m_countdowns.empty(); ++i) {
+            std::size_t index = m_rng() % m_countdowns.size();
+            switch (m_rng() % 4) {
+            case 0:
+                startCountdown(index);
+                break;
+            case 1:
+                m_countdowns[index].stop();
+                break;
+            case 2:
+                m_countdowns[index].reset();
+                break;
+            default:
+                m_countdowns[index] = makeCountdown(index);
+                startCountdown(index);
+                break;
+            }
+            ++m_day->churnOperations;
+        }
+
+        // Subscribers: new ones join to replace those that left
+        while (m_activeSubscribers < m_options.subscribers && m_rng() % 4 != 0) {
+            subscribe(nowNs);
+            ++m_day->churnOperations;
+        }
+    }
+
+private:
+    SoakOptions m_options;
+    std::int64_t m_stepNs;
+    std::mt19937_64 m_rng;
+    std::shared_ptr<VirtualClock> m_clock;
+    std::shared_ptr<VirtualClock> m_liveClock;                // Reference clock of the live timers
+    Invariants m_invariants;
+
+    std::vector<BarTimer> m_bars;
+    ShardedTimerScheduler m_barScheduler;
+
+    InlineExecutor m_executor;
+    DeadlineScheduler m_deadlines;
+    std::size_t m_activeSubscribers = 0;
+    std::uint64_t m_scheduledWakeups = 0;
+    std::uint64_t m_ranWakeups = 0;
+    bool m_closing = false;
+
+    std::vector<CountdownProbe> m_probes;               // Fixed size: sinks point into it
+    std::vector<SoakCountdown> m_countdowns;
+
+    DayResult* m_day;
+};
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    SoakOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage();
+        return 1;
+    }
+
+    std::cout << "Soak: " << options.days << " days, " << options.timers << " bar timers, " << options.countdowns
+              << " countdowns, " << options.subscribers << " subscribers, " << options.liveTimers << " live timers, "
+              << options.stepMs << " ms steps" << std::endl;
+
+    // Every thread a day starts (live timers, executors, watchers, shards) must be gone by its end
+    long baselineThreads = readProcStatus("Threads");
+    auto wallStart = std::chrono::steady_clock::now();
+    SoakHarness harness(options);
+    std::vector<DayResult> days(options.days);
+    for (int day = 0; day < options.days; ++day) {
+        harness.runDay(day, days[day]);
+        days[day].rssKiB = readProcStatus("VmRSS");
+        days[day].threads = readProcStatus("Threads");
+        std::cout << "  day " << day + 1 << ": " << days[day].barExpiries << " bar expiries, "
+                  << days[day].countdownCompletions << " completions, " << days[day].liveCompletions
+                  << " live completions, RSS " << days[day].rssKiB << " KiB, "
+                  << days[day].threads << " threads" << std::endl;
+    }
+    double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+
+    // Flat memory from the end of day 1 on, thread count back to the baseline after every day
+    Invariants& invariants = harness.getInvariants();
+    for (std::size_t day = 0; day < days.size(); ++day) {
+        if (day > 0 && days[0].rssKiB >= 0) {
+            invariants.check(days[day].rssKiB - days[0].rssKiB <= options.rssToleranceKiB,
+                             "RSS grew on day " + std::to_string(day + 1));
+        }
+        if (baselineThreads >= 0) {
+            invariants.check(days[day].threads == baselineThreads, "thread count changed on day " + std::to_string(day + 1));
+        }
+    }
+
+    std::ostringstream report;
+    report << "Soak report" << std::endl
+           << "  days " << options.days << ", bar timers " << options.timers << ", countdowns " << options.countdowns
+           << ", subscribers " << options.subscribers << ", live timers " << options.liveTimers << ", step " << options.stepMs << " ms, seed " << options.seed << std::endl
+           << "  wall time " << std::fixed << std::setprecision(1) << wallSeconds << " s" << std::endl << std::endl
+           << "  baseline threads " << baselineThreads << std::endl << std::endl
+           << "  day  bar-expiries  updates     completions  wakeups  churn     max-late-ms  live-ops  live-events"
+              "  live-done  live-late-ms  RSS-KiB  threads" << std::endl;
+    for (std::size_t day = 0; day < days.size(); ++day) {
+        const DayResult& result = days[day];
+        report << "  " << std::setw(3) << day + 1 << "  " << std::setw(12) << result.barExpiries
+               << "  " << std::setw(10) << result.countdownUpdates << "  " << std::setw(11) << result.countdownCompletions
+               << "  " << std::setw(7) << result.subscriberWakeups << "  " << std::setw(8) << result.churnOperations
+               << "  " << std::setw(11) << std::setprecision(3) << result.maxLatenessNs / 1e6
+               << "  " << std::setw(8) << result.liveOperations << "  " << std::setw(11) << result.liveEvents
+               << "  " << std::setw(9) << result.liveCompletions
+               << "  " << std::setw(12) << result.liveMaxLatenessNs / 1e6
+               << "  " << std::setw(7) << result.rssKiB << "  " << std::setw(7) << result.threads << std::endl;
+    }
+    report << std::endl << "  invariant checks " << invariants.checks << ", violations " << invariants.violations << std::endl;
+    for (const std::string& message : invariants.messages) {
+        report << "    " << message << std::endl;
+    }
+    report << "  result: " << (invariants.violations == 0 ? "PASS" : "FAIL") << std::endl;
+
+    std::cout << std::endl << report.str();
+    std::ofstream file(options.reportPath);
+    if (!file) {
+        std::cerr << "soakHarness: Failed to write report to " << options.reportPath << std::endl;
+        return 1;
+    }
+    file << report.str();
+    return invariants.violations == 0 ? 0 : 1;
+}